@@ -0,0 +1,28 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/Aws.h>
+
+int main(int argc, char** argv)
+{
+    Aws::SDKOptions options;
+    Aws::InitAPI(options);
+
+    ::benchmark::Initialize(&argc, argv);
+    int retVal = 0;
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        retVal = 1;
+    }
+    else
+    {
+        ::benchmark::RunSpecifiedBenchmarks();
+    }
+    ::benchmark::Shutdown();
+
+    Aws::ShutdownAPI(options);
+    return retVal;
+}
@@ -0,0 +1,68 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+static const char ALLOCATION_TAG[] = "AWSAuthSignerBenchmark";
+
+static std::shared_ptr<AWSCredentialsProvider> MakeCredentialsProvider()
+{
+    return Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+}
+
+// A typical S3 GetObject: virtual host style, query string and a handful of headers.
+static void MakeGetObjectRequest(Standard::StandardHttpRequest& request)
+{
+    request.SetHeaderValue("amz-sdk-invocation-id", "6C7E0F88-4A5C-4C4A-8E9E-0B1D4D8F1A2B");
+    request.SetHeaderValue("amz-sdk-request", "attempt=1");
+    request.SetHeaderValue("range", "bytes=0-1048575");
+    request.SetHeaderValue("x-amz-security-token", "AQoDYXdzEJr//////////wEa4AN1bHJTk1YlhHUTcHp9WgdHMkzB0hBHi9p6gy5oR1Y4Q4sQ0nYg3wcTyg");
+}
+
+static void BM_SignGetObject(benchmark::State& state)
+{
+    AWSAuthV4Signer signer(MakeCredentialsProvider(), "s3", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Standard::StandardHttpRequest request("https://examplebucket.s3.us-east-1.amazonaws.com/photos/2020/08/IMG_0001.jpg?versionId=3HL4kqtJlcpXroDTDmJ.rmSpXd3dIbrHY", HttpMethod::HTTP_GET);
+        MakeGetObjectRequest(request);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(signer.SignRequest(request));
+    }
+}
+BENCHMARK(BM_SignGetObject);
+
+// A json protocol call (e.g. DynamoDB) whose body is hashed for the signature, body size given by the argument.
+static void BM_SignJsonRequestWithPayload(benchmark::State& state)
+{
+    AWSAuthV4Signer signer(MakeCredentialsProvider(), "dynamodb", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Always);
+    const Aws::String payload(static_cast<size_t>(state.range(0)), 'x');
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Standard::StandardHttpRequest request("https://dynamodb.us-east-1.amazonaws.com/", HttpMethod::HTTP_POST);
+        request.SetHeaderValue("x-amz-target", "DynamoDB_20120810.PutItem");
+        request.SetHeaderValue("content-type", "application/x-amz-json-1.0");
+        request.SetContentLength(Aws::Utils::StringUtils::to_string(payload.size()));
+        auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, payload);
+        request.AddContentBody(body);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(signer.SignRequest(request));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_SignJsonRequestWithPayload)->Arg(1024)->Arg(64 * 1024)->Arg(1024 * 1024);
@@ -0,0 +1,76 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/http/URI.h>
+#include <aws/core/utils/StringUtils.h>
+
+using namespace Aws::Http;
+
+static const char S3_OBJECT_URI[] = "https://examplebucket.s3.us-west-2.amazonaws.com/photos/2020/08/summer%20holidays/IMG_0001.jpg?versionId=3HL4kqtJlcpXroDTDmJ.rmSpXd3dIbrHY&partNumber=2";
+
+static void BM_URIParse(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        URI uri(S3_OBJECT_URI);
+        benchmark::DoNotOptimize(uri.GetPath());
+    }
+}
+BENCHMARK(BM_URIParse);
+
+static void BM_URIGetURIString(benchmark::State& state)
+{
+    URI uri(S3_OBJECT_URI);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(uri.GetURIString());
+    }
+}
+BENCHMARK(BM_URIGetURIString);
+
+static void BM_URIEncodePath(benchmark::State& state)
+{
+    const Aws::String path = "/photos/2020/08/summer holidays/IMG_0001 (copy).jpg";
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(URI::URLEncodePath(path));
+    }
+}
+BENCHMARK(BM_URIEncodePath);
+
+static void BM_URIEncodePathRFC3986(benchmark::State& state)
+{
+    const Aws::String path = "/photos/2020/08/summer holidays/IMG_0001 (copy)+final.jpg";
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(URI::URLEncodePathRFC3986(path));
+    }
+}
+BENCHMARK(BM_URIEncodePathRFC3986);
+
+static void BM_URICanonicalizeQueryString(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        URI uri("https://sqs.us-east-1.amazonaws.com/?Action=SendMessage&Version=2012-11-05&QueueUrl=https%3A%2F%2Fsqs.us-east-1.amazonaws.com%2F123456789012%2Fqueue&MessageBody=hello%20world&DelaySeconds=0");
+        state.ResumeTiming();
+
+        uri.CanonicalizeQueryString();
+        benchmark::DoNotOptimize(uri.GetQueryString());
+    }
+}
+BENCHMARK(BM_URICanonicalizeQueryString);
+
+static void BM_StringUtilsURLEncode(benchmark::State& state)
+{
+    const Aws::String value = "arn:aws:sqs:us-east-1:123456789012:queue name with spaces/and+reserved&chars=";
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Aws::Utils::StringUtils::URLEncode(value.c_str()));
+    }
+}
+BENCHMARK(BM_StringUtilsURLEncode);
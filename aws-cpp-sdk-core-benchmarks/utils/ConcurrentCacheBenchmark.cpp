@@ -0,0 +1,44 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/utils/ConcurrentCache.h>
+#include <aws/core/utils/StringUtils.h>
+
+using namespace Aws::Utils;
+
+static const int KEY_COUNT = 64;
+
+// Endpoint discovery style lookups: all threads read a small set of hot keys, with a refresh every 1000 lookups.
+static void BM_ConcurrentCacheGet(benchmark::State& state)
+{
+    static ConcurrentCache<Aws::String, Aws::String> cache;
+    Aws::Vector<Aws::String> keys;
+    for (int i = 0; i < KEY_COUNT; ++i)
+    {
+        keys.push_back("dynamodb.us-east-1." + StringUtils::to_string(i));
+        if (state.thread_index() == 0)
+        {
+            cache.Put(keys.back(), "https://" + keys.back() + ".amazonaws.com", std::chrono::minutes(10));
+        }
+    }
+
+    Aws::String endpoint;
+    int64_t i = state.thread_index();
+    for (auto _ : state)
+    {
+        const Aws::String& key = keys[static_cast<size_t>(i++ % KEY_COUNT)];
+        if (i % 1000 == 0)
+        {
+            cache.Put(key, "https://" + key + ".amazonaws.com", std::chrono::minutes(10));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(cache.Get(key, endpoint));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ConcurrentCacheGet)->ThreadRange(1, 64)->UseRealTime();
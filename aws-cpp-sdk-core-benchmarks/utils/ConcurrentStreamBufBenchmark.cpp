@@ -0,0 +1,45 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/utils/stream/ConcurrentStreamBuf.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <thread>
+
+using namespace Aws::Utils::Stream;
+
+static const size_t BYTES_PER_ITERATION = 1024 * 1024;
+
+// One thread writes and flushes audio-sized chunks (the argument) while another reads them, as event stream uploads do.
+static void BM_ConcurrentStreamBufTransfer(benchmark::State& state)
+{
+    const size_t chunkSize = static_cast<size_t>(state.range(0));
+    Aws::Vector<char> chunk(chunkSize, 'x');
+    Aws::Vector<char> readBuf(16 * 1024);
+    for (auto _ : state)
+    {
+        ConcurrentStreamBuf streamBuf;
+        Aws::IOStream ioStream(&streamBuf);
+        std::thread writer([&] {
+            for (size_t written = 0; written < BYTES_PER_ITERATION; written += chunkSize)
+            {
+                ioStream.write(chunk.data(), chunkSize);
+                ioStream.flush();
+            }
+            streamBuf.SetEof();
+        });
+
+        size_t read = 0;
+        while (ioStream.read(readBuf.data(), readBuf.size()) || ioStream.gcount() > 0)
+        {
+            read += static_cast<size_t>(ioStream.gcount());
+        }
+        writer.join();
+        benchmark::DoNotOptimize(read);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * BYTES_PER_ITERATION));
+}
+BENCHMARK(BM_ConcurrentStreamBufTransfer)->Arg(320)->Arg(4096)->UseRealTime();
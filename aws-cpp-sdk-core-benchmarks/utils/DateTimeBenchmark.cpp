@@ -0,0 +1,51 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/utils/DateTime.h>
+
+using namespace Aws::Utils;
+
+// The formats every signed request or parsed response goes through.
+static void BM_DateTimeToGmtString(benchmark::State& state)
+{
+    const DateFormat format = static_cast<DateFormat>(state.range(0));
+    const DateTime now = DateTime::Now();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(now.ToGmtString(format));
+    }
+}
+BENCHMARK(BM_DateTimeToGmtString)
+    ->Arg(static_cast<int>(DateFormat::RFC822))
+    ->Arg(static_cast<int>(DateFormat::ISO_8601))
+    ->Arg(static_cast<int>(DateFormat::ISO_8601_BASIC));
+
+static void BM_DateTimeSignerDateStamp(benchmark::State& state)
+{
+    const DateTime now = DateTime::Now();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(now.ToGmtString("%Y%m%d"));
+    }
+}
+BENCHMARK(BM_DateTimeSignerDateStamp);
+
+static void BM_DateTimeParse(benchmark::State& state)
+{
+    const DateFormat format = static_cast<DateFormat>(state.range(0));
+    const Aws::String timestamp = DateTime(static_cast<int64_t>(1597234567890)).ToGmtString(
+        format == DateFormat::AutoDetect ? DateFormat::ISO_8601 : format);
+    for (auto _ : state)
+    {
+        DateTime parsed(timestamp, format);
+        benchmark::DoNotOptimize(parsed.Millis());
+    }
+}
+BENCHMARK(BM_DateTimeParse)
+    ->Arg(static_cast<int>(DateFormat::RFC822))
+    ->Arg(static_cast<int>(DateFormat::ISO_8601))
+    ->Arg(static_cast<int>(DateFormat::ISO_8601_BASIC))
+    ->Arg(static_cast<int>(DateFormat::AutoDetect));
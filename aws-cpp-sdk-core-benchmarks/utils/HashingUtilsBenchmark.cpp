@@ -0,0 +1,65 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Array.h>
+
+using namespace Aws::Utils;
+
+static ByteBuffer MakeBuffer(size_t size)
+{
+    ByteBuffer buffer(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        buffer[i] = static_cast<unsigned char>(i * 31 + 7);
+    }
+    return buffer;
+}
+
+// 16 bytes is an MD5 digest (Content-MD5), 32 a SHA256 digest (signatures), larger sizes are payloads.
+static void BM_Base64Encode(benchmark::State& state)
+{
+    const ByteBuffer buffer = MakeBuffer(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(HashingUtils::Base64Encode(buffer));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Base64Encode)->Arg(16)->Arg(1024)->Arg(64 * 1024);
+
+static void BM_Base64Decode(benchmark::State& state)
+{
+    const Aws::String encoded = HashingUtils::Base64Encode(MakeBuffer(static_cast<size_t>(state.range(0))));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(HashingUtils::Base64Decode(encoded));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Base64Decode)->Arg(16)->Arg(1024)->Arg(64 * 1024);
+
+static void BM_HexEncode(benchmark::State& state)
+{
+    const ByteBuffer buffer = MakeBuffer(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(HashingUtils::HexEncode(buffer));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_HexEncode)->Arg(32)->Arg(1024)->Arg(64 * 1024);
+
+static void BM_HexDecode(benchmark::State& state)
+{
+    const Aws::String encoded = HashingUtils::HexEncode(MakeBuffer(static_cast<size_t>(state.range(0))));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(HashingUtils::HexDecode(encoded));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_HexDecode)->Arg(32)->Arg(1024)->Arg(64 * 1024);
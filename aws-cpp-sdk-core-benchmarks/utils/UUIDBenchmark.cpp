@@ -0,0 +1,28 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/utils/UUID.h>
+
+using namespace Aws::Utils;
+
+// Every API call generates an invocation id.
+static void BM_RandomUUID(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(UUID::RandomUUID());
+    }
+}
+BENCHMARK(BM_RandomUUID)->ThreadRange(1, 8);
+
+static void BM_RandomUUIDToString(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Aws::String(UUID::RandomUUID()));
+    }
+}
+BENCHMARK(BM_RandomUUIDToString);
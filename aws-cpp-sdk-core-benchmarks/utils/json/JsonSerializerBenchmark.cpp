@@ -0,0 +1,86 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Utils::Json;
+
+// A DynamoDB Query response with the given number of items.
+static Aws::String MakeQueryResponse(int itemCount)
+{
+    Aws::StringStream ss;
+    ss << "{\"Count\":" << itemCount << ",\"Items\":[";
+    for (int i = 0; i < itemCount; ++i)
+    {
+        if (i > 0)
+        {
+            ss << ",";
+        }
+        ss << "{\"pk\":{\"S\":\"customer#" << i << "\"},"
+           << "\"sk\":{\"S\":\"order#2020-08-12T10:15:" << (i % 60) << "Z\"},"
+           << "\"total\":{\"N\":\"" << (i * 17 % 1000) << ".99\"},"
+           << "\"shipped\":{\"BOOL\":" << (i % 2 ? "true" : "false") << "},"
+           << "\"tags\":{\"SS\":[\"priority\",\"gift\",\"international\"]},"
+           << "\"address\":{\"M\":{\"street\":{\"S\":\"410 Terry Ave N\"},\"city\":{\"S\":\"Seattle\"},\"zip\":{\"S\":\"98109\"}}}}";
+    }
+    ss << "],\"ScannedCount\":" << itemCount << "}";
+    return ss.str();
+}
+
+static void BM_JsonParse(benchmark::State& state)
+{
+    const Aws::String payload = MakeQueryResponse(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+    {
+        JsonValue value(payload);
+        benchmark::DoNotOptimize(value.WasParseSuccessful());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+}
+BENCHMARK(BM_JsonParse)->Arg(1)->Arg(100);
+
+static void BM_JsonReadItems(benchmark::State& state)
+{
+    const JsonValue value(MakeQueryResponse(static_cast<int>(state.range(0))));
+    for (auto _ : state)
+    {
+        auto items = value.View().GetArray("Items");
+        for (size_t i = 0; i < items.GetLength(); ++i)
+        {
+            benchmark::DoNotOptimize(items[i].GetObject("pk").GetString("S"));
+            benchmark::DoNotOptimize(items[i].GetObject("address").GetObject("M").GetAllObjects());
+        }
+    }
+}
+BENCHMARK(BM_JsonReadItems)->Arg(100);
+
+static void BM_JsonSerialize(benchmark::State& state)
+{
+    const JsonValue value(MakeQueryResponse(static_cast<int>(state.range(0))));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value.View().WriteCompact());
+    }
+}
+BENCHMARK(BM_JsonSerialize)->Arg(1)->Arg(100);
+
+// Building a PutItem request body the way generated models do.
+static void BM_JsonBuildRequest(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        JsonValue item;
+        item.WithObject("pk", JsonValue().WithString("S", "customer#42"))
+            .WithObject("sk", JsonValue().WithString("S", "order#2020-08-12T10:15:00Z"))
+            .WithObject("total", JsonValue().WithString("N", "123.99"))
+            .WithObject("shipped", JsonValue().WithBool("BOOL", true));
+        JsonValue request;
+        request.WithString("TableName", "Orders").WithObject("Item", std::move(item));
+        benchmark::DoNotOptimize(request.View().WriteCompact());
+    }
+}
+BENCHMARK(BM_JsonBuildRequest);
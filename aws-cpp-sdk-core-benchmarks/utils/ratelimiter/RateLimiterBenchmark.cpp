@@ -0,0 +1,25 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/utils/ratelimiter/DefaultRateLimiter.h>
+
+using namespace Aws::Utils::RateLimits;
+
+// Curl transfers data in chunks of up to 16KB, the limiter is charged for every chunk.
+static const int64_t CHUNK_SIZE = 16 * 1024;
+static const int64_t MAX_RATE = 1024 * 1024 * 1024;
+
+static void BM_RateLimiterApplyCost(benchmark::State& state)
+{
+    // Shared by all the threads of the benchmark, as a limiter is shared by all the requests of a client.
+    static DefaultRateLimiter<> limiter(MAX_RATE);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(limiter.ApplyCost(CHUNK_SIZE));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * CHUNK_SIZE);
+}
+BENCHMARK(BM_RateLimiterApplyCost)->ThreadRange(1, 8)->UseRealTime();
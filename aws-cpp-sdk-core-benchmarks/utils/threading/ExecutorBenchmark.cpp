@@ -0,0 +1,35 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <atomic>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+static const char ALLOCATION_TAG[] = "ExecutorBenchmark";
+static const int TASKS_PER_BATCH = 100;
+
+// Submits a batch of small tasks, as async operations do, and waits for all of them to run. Argument is the pool size.
+static void BM_PooledThreadExecutorSubmit(benchmark::State& state)
+{
+    auto executor = Aws::MakeShared<PooledThreadExecutor>(ALLOCATION_TAG, static_cast<size_t>(state.range(0)));
+    std::atomic<int> completed(0);
+    for (auto _ : state)
+    {
+        completed = 0;
+        for (int i = 0; i < TASKS_PER_BATCH; ++i)
+        {
+            executor->Submit([&completed]() { completed.fetch_add(1, std::memory_order_relaxed); });
+        }
+        while (completed.load(std::memory_order_relaxed) < TASKS_PER_BATCH)
+        {
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * TASKS_PER_BATCH);
+}
+BENCHMARK(BM_PooledThreadExecutorSubmit)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
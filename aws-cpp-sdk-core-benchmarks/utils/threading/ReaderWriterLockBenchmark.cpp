@@ -0,0 +1,49 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/utils/threading/ReaderWriterLock.h>
+
+using namespace Aws::Utils::Threading;
+
+static ReaderWriterLock s_rwlock;
+static int64_t s_protectedValue = 0;
+
+// Every thread takes the lock in reader mode, as requests do when reading cached credentials or endpoints.
+static void BM_ReaderWriterLockReaders(benchmark::State& state)
+{
+    int64_t sum = 0;
+    for (auto _ : state)
+    {
+        ReaderLockGuard guard(s_rwlock);
+        sum += s_protectedValue;
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ReaderWriterLockReaders)->ThreadRange(1, 128)->UseRealTime();
+
+// Readers with one write (e.g. a credentials reload) every 1000 acquisitions per thread.
+static void BM_ReaderWriterLockMostlyReaders(benchmark::State& state)
+{
+    int64_t sum = 0;
+    int64_t i = 0;
+    for (auto _ : state)
+    {
+        if (++i % 1000 == 0)
+        {
+            WriterLockGuard guard(s_rwlock);
+            ++s_protectedValue;
+        }
+        else
+        {
+            ReaderLockGuard guard(s_rwlock);
+            sum += s_protectedValue;
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ReaderWriterLockMostlyReaders)->ThreadRange(1, 128)->UseRealTime();
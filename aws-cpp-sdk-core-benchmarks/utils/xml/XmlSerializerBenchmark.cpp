@@ -0,0 +1,79 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <benchmark/benchmark.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Utils::Xml;
+
+// An S3 ListObjectsV2 response with the given number of keys.
+static Aws::String MakeListObjectsResponse(int keyCount)
+{
+    Aws::StringStream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+       << "<Name>examplebucket</Name><Prefix>photos/2020/</Prefix><KeyCount>" << keyCount << "</KeyCount>"
+       << "<MaxKeys>1000</MaxKeys><IsTruncated>false</IsTruncated>";
+    for (int i = 0; i < keyCount; ++i)
+    {
+        ss << "<Contents><Key>photos/2020/08/IMG_" << i << ".jpg</Key>"
+           << "<LastModified>2020-08-12T17:50:30.000Z</LastModified>"
+           << "<ETag>&quot;fba9dede5f27731c9771645a39863328&quot;</ETag>"
+           << "<Size>" << (434234 + i) << "</Size><StorageClass>STANDARD</StorageClass></Contents>";
+    }
+    ss << "</ListBucketResult>";
+    return ss.str();
+}
+
+static void BM_XmlCreateFromXmlStream(benchmark::State& state)
+{
+    const Aws::String payload = MakeListObjectsResponse(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Aws::StringStream stream(payload);
+        state.ResumeTiming();
+
+        XmlDocument document = XmlDocument::CreateFromXmlStream(stream);
+        benchmark::DoNotOptimize(document.WasParseSuccessful());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+}
+BENCHMARK(BM_XmlCreateFromXmlStream)->Arg(1)->Arg(1000);
+
+static void BM_XmlReadContents(benchmark::State& state)
+{
+    const XmlDocument document = XmlDocument::CreateFromXmlString(MakeListObjectsResponse(static_cast<int>(state.range(0))));
+    for (auto _ : state)
+    {
+        XmlNode contents = document.GetRootElement().FirstChild("Contents");
+        while (!contents.IsNull())
+        {
+            benchmark::DoNotOptimize(contents.FirstChild("Key").GetText());
+            benchmark::DoNotOptimize(contents.FirstChild("Size").GetText());
+            contents = contents.NextNode("Contents");
+        }
+    }
+}
+BENCHMARK(BM_XmlReadContents)->Arg(1000);
+
+// Building a DeleteObjects request body the way generated models do.
+static void BM_XmlBuildRequest(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        XmlDocument document = XmlDocument::CreateWithRootNode("Delete");
+        XmlNode root = document.GetRootElement();
+        root.SetAttributeValue("xmlns", "http://s3.amazonaws.com/doc/2006-03-01/");
+        for (int i = 0; i < state.range(0); ++i)
+        {
+            XmlNode object = root.CreateChildElement("Object");
+            object.CreateChildElement("Key").SetText("photos/2020/08/IMG_0001.jpg");
+        }
+        benchmark::DoNotOptimize(document.ConvertToString());
+    }
+}
+BENCHMARK(BM_XmlBuildRequest)->Arg(100);
@@ -18,7 +18,13 @@
 #include <aws/core/auth/AWSCredentialsProvider.h>
 #include <aws/core/platform/Environment.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/monitoring/RequestTiming.h>
+#include <aws/core/utils/threading/TimerScheduler.h>
+#include <aws/core/client/RequestCompression.h>
+#include <aws/core/client/CircuitBreaker.h>
+#include <atomic>
 #include <fstream>
+#include <future>
 #include <thread>
 
 using namespace Aws;
@@ -34,6 +40,19 @@ using namespace Aws::Http::Standard;
 
 static const char ALLOCATION_TAG[] = "AWSClientTest";
 
+class RecordingRequestTracer : public Aws::Monitoring::RequestTracer
+{
+public:
+    void OnSpan(const Aws::Monitoring::RequestTiming& timing, const Aws::Monitoring::RequestSpan& span) const override
+    {
+        invocationIds.push_back(timing.GetInvocationId());
+        spans.push_back(span);
+    }
+
+    mutable Aws::Vector<Aws::String> invocationIds;
+    mutable Aws::Vector<Aws::Monitoring::RequestSpan> spans;
+};
+
 class AccessViolatingAWSClient : public AWSClient
 {
 public:
@@ -209,6 +228,124 @@ TEST_F(AWSClientTestSuite, TestClockSkewWithinAcceptableRange)
     ASSERT_EQ(0, client->GetRequestAttemptedRetries());
 }
 
+TEST_F(AWSClientTestSuite, TestClientsShareTheConfiguredHttpClient)
+{
+    auto sharedHttpClient = Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG);
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG);
+    config.httpClient = sharedHttpClient;
+    MockAWSClient firstClient(config);
+    MockAWSClient secondClient(config);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        auto httpRequest = CreateHttpRequest(URI("http://www.uri.com/path/to/res"),
+                HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto httpResponse = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, httpRequest);
+        httpResponse->SetResponseCode(HttpResponseCode::OK);
+        sharedHttpClient->AddResponseToReturn(httpResponse);
+    }
+
+    AmazonWebServiceRequestMock request;
+    ASSERT_TRUE(firstClient.MakeRequest(request).IsSuccess());
+    ASSERT_TRUE(secondClient.MakeRequest(request).IsSuccess());
+    ASSERT_EQ(2u, sharedHttpClient->GetAllRequestsMade().size());
+    ASSERT_TRUE(mockHttpClient->GetAllRequestsMade().empty());
+}
+
+TEST_F(AWSClientTestSuite, TestResponseBodySinkIsPassedToHttpRequest)
+{
+    unsigned char buffer[16];
+    auto sink = Aws::MakeShared<BufferResponseBodySink>(ALLOCATION_TAG, buffer, sizeof(buffer));
+    AmazonWebServiceRequestMock request;
+    request.SetResponseBodySink(sink);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    auto outcome = client->MakeRequest(request);
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(sink, mockHttpClient->GetMostRecentHttpRequest().GetResponseBodySink());
+}
+
+TEST_F(AWSClientTestSuite, TestRequestCompressionAboveThreshold)
+{
+    if (!RequestCompression::IsSupported(CompressionAlgorithm::GZIP))
+    {
+        return;
+    }
+
+    Aws::String payload;
+    for (int i = 0; i < 1000; ++i)
+    {
+        payload += "{\"MetricName\":\"Latency\",\"Value\":42}";
+    }
+    AmazonWebServiceRequestMock request;
+    request.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, payload));
+    request.SetRequestCompressionAlgorithm(CompressionAlgorithm::GZIP);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    ASSERT_TRUE(client->MakeRequest(request).IsSuccess());
+
+    const auto& httpRequest = mockHttpClient->GetMostRecentHttpRequest();
+    ASSERT_EQ("gzip", httpRequest.GetHeaderValue(CONTENT_ENCODING_HEADER));
+    ASSERT_LT(std::stoul(httpRequest.GetContentLength().c_str()), payload.size());
+    auto body = httpRequest.GetContentBody();
+    body->seekg(0, body->beg);
+    auto decompressed = RequestCompression::Decompress(*body, CompressionAlgorithm::GZIP);
+    ASSERT_NE(nullptr, decompressed);
+    Aws::StringStream original;
+    original << decompressed->rdbuf();
+    ASSERT_EQ(payload, original.str());
+
+    // Below the minimum size of the client configuration, 10KB by default.
+    AmazonWebServiceRequestMock smallRequest;
+    smallRequest.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, "{\"MetricName\":\"Latency\"}"));
+    smallRequest.SetRequestCompressionAlgorithm(CompressionAlgorithm::GZIP);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    ASSERT_TRUE(client->MakeRequest(smallRequest).IsSuccess());
+    ASSERT_FALSE(mockHttpClient->GetMostRecentHttpRequest().HasHeader(CONTENT_ENCODING_HEADER));
+}
+
+TEST_F(AWSClientTestSuite, TestRequestCompressedOnceAcrossRetries)
+{
+    if (!RequestCompression::IsSupported(CompressionAlgorithm::GZIP))
+    {
+        return;
+    }
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<CountedStandardRetryStrategy>(ALLOCATION_TAG);
+    MockAWSClientWithStandardRetryStrategy clientWithStandardRetryStrategy(config);
+
+    Aws::String payload;
+    for (int i = 0; i < 1000; ++i)
+    {
+        payload += "{\"MetricName\":\"Latency\",\"Value\":42}";
+    }
+    AmazonWebServiceRequestMock request;
+    request.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, payload));
+    request.SetRequestCompressionAlgorithm(CompressionAlgorithm::GZIP);
+    // The content-length and content-md5 of the uncompressed body don't match the compressed one.
+    HeaderValueCollection requestHeaders;
+    requestHeaders.emplace(CONTENT_LENGTH_HEADER, Utils::StringUtils::to_string(payload.size()));
+    requestHeaders.emplace(CONTENT_MD5_HEADER, Utils::HashingUtils::Base64Encode(Utils::HashingUtils::CalculateMD5(payload)));
+    request.SetHeaders(requestHeaders);
+
+    HeaderValueCollection responseHeaders;
+    QueueMockResponse(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, true), responseHeaders);
+    QueueMockResponse(HttpResponseCode::OK, responseHeaders);
+    ASSERT_TRUE(clientWithStandardRetryStrategy.MakeRequest(request).IsSuccess());
+    ASSERT_EQ(1, clientWithStandardRetryStrategy.GetRequestAttemptedRetries());
+
+    const auto& requestsMade = mockHttpClient->GetAllRequestsMade();
+    ASSERT_EQ(2u, requestsMade.size());
+    ASSERT_EQ(requestsMade[0].GetContentBody(), requestsMade[1].GetContentBody());
+    const auto& retry = requestsMade[1];
+    ASSERT_EQ("gzip", retry.GetHeaderValue(CONTENT_ENCODING_HEADER));
+    auto body = retry.GetContentBody();
+    body->seekg(0, body->end);
+    ASSERT_EQ(Utils::StringUtils::to_string(static_cast<long long>(body->tellg())), retry.GetContentLength());
+    body->seekg(0, body->beg);
+    ASSERT_EQ(Utils::HashingUtils::Base64Encode(Utils::HashingUtils::CalculateMD5(*body)), retry.GetHeaderValue(CONTENT_MD5_HEADER));
+}
+
 TEST_F(AWSClientTestSuite, TestClockSkewConsecutiveRequests)
 {
     // first request should set the skew offset and retry, but following requests should not
@@ -316,6 +453,120 @@ TEST_F(AWSClientTestSuite, TestRetryHeaders)
     ASSERT_STREQ("11", ExtractFromRequestInfo(requestInfo, "max").c_str());
 }
 
+// Standard retries, waiting the same time before each of them.
+class FixedDelayRetryStrategy : public CountedStandardRetryStrategy
+{
+public:
+    FixedDelayRetryStrategy(long maxAttempts, long delayMs) : CountedStandardRetryStrategy(maxAttempts), m_delayMs(delayMs) {}
+
+    long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>&, long) const override { return m_delayMs; }
+
+private:
+    long m_delayMs;
+};
+
+TEST_F(AWSClientTestSuite, TestCallDeadlineStopsRetries)
+{
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<FixedDelayRetryStrategy>(ALLOCATION_TAG, 10, 40);
+    MockAWSClientWithStandardRetryStrategy clientWithStandardRetryStrategy(config);
+
+    AWSError<CoreErrors> connectionError(CoreErrors::NETWORK_CONNECTION, true);
+    for (int i = 0; i < 10; ++i)
+    {
+        QueueMockResponse(connectionError, HeaderValueCollection());
+    }
+    AmazonWebServiceRequestMock request;
+    // Room for a few attempts 40ms apart, not for the 10 the retry strategy allows.
+    const auto start = std::chrono::steady_clock::now();
+    request.SetCallDeadline(start + std::chrono::milliseconds(100));
+    auto outcome = clientWithStandardRetryStrategy.MakeRequest(request);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(CoreErrors::NETWORK_CONNECTION, outcome.GetError().GetErrorType());
+    const auto& requests = mockHttpClient->GetAllRequestsMade();
+    ASSERT_GE(requests.size(), 2u);
+    ASSERT_LT(requests.size(), 10u);
+    // The retry that would have overrun the deadline was not waited for.
+    ASSERT_LT(elapsed, std::chrono::milliseconds(100));
+    for (const auto& httpRequest : requests)
+    {
+        ASSERT_TRUE(httpRequest.GetDeadline() == request.GetCallDeadline());
+    }
+}
+
+TEST_F(AWSClientTestSuite, TestCallPastItsDeadlineIsNotSent)
+{
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    AmazonWebServiceRequestMock request;
+    request.SetCallDeadline(std::chrono::steady_clock::now() - std::chrono::milliseconds(1));
+    auto outcome = client->MakeRequest(request);
+
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(CoreErrors::REQUEST_TIMEOUT, outcome.GetError().GetErrorType());
+    ASSERT_EQ(0u, mockHttpClient->GetAllRequestsMade().size());
+    ASSERT_EQ(0, client->GetRequestAttemptedRetries());
+}
+
+TEST_F(AWSClientTestSuite, TestPayloadlessCallDeadline)
+{
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<FixedDelayRetryStrategy>(ALLOCATION_TAG, 10, 0);
+    MockAWSClientWithStandardRetryStrategy clientWithStandardRetryStrategy(config);
+
+    auto outcome = clientWithStandardRetryStrategy.MakeRequest("ListBuckets", std::chrono::steady_clock::now() - std::chrono::milliseconds(1));
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(CoreErrors::REQUEST_TIMEOUT, outcome.GetError().GetErrorType());
+    ASSERT_EQ(0u, mockHttpClient->GetAllRequestsMade().size());
+
+    // The http request carries the deadline, for the http client to cap its timeouts with.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    ASSERT_TRUE(clientWithStandardRetryStrategy.MakeRequest("ListBuckets", deadline).IsSuccess());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+    ASSERT_TRUE(deadline == mockHttpClient->GetMostRecentHttpRequest().GetDeadline());
+}
+
+TEST_F(AWSClientTestSuite, TestOpenCircuitFailsFast)
+{
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<FixedDelayRetryStrategy>(ALLOCATION_TAG, 10, 0);
+    CircuitBreakerConfiguration circuitBreakerConfig;
+    circuitBreakerConfig.minimumAttempts = 2;
+    circuitBreakerConfig.openDuration = std::chrono::hours(1);
+    config.circuitBreaker = Aws::MakeShared<CircuitBreaker>(ALLOCATION_TAG, circuitBreakerConfig);
+    MockAWSClientWithStandardRetryStrategy clientWithStandardRetryStrategy(config);
+
+    AWSError<CoreErrors> connectionError(CoreErrors::NETWORK_CONNECTION, true);
+    for (int i = 0; i < 10; ++i)
+    {
+        QueueMockResponse(connectionError, HeaderValueCollection());
+    }
+    AmazonWebServiceRequestMock request;
+
+    // The second failed attempt opens the circuit, which stops the retries.
+    auto outcome = clientWithStandardRetryStrategy.MakeRequest(request);
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(CoreErrors::NETWORK_CONNECTION, outcome.GetError().GetErrorType());
+    ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+    ASSERT_EQ(CircuitState::OPEN, config.circuitBreaker->GetState(config.circuitBreaker->GetCircuitName("domain.com", request.GetServiceRequestName())));
+
+    // The next call is not sent at all.
+    outcome = clientWithStandardRetryStrategy.MakeRequest(request);
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(CoreErrors::SERVICE_UNAVAILABLE, outcome.GetError().GetErrorType());
+    ASSERT_STREQ("CircuitBreakerOpen", outcome.GetError().GetExceptionName().c_str());
+    ASSERT_FALSE(outcome.GetError().ShouldRetry());
+    ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+
+    // Nor is a payloadless request of the same operation.
+    outcome = clientWithStandardRetryStrategy.MakeRequest(request.GetServiceRequestName());
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_STREQ("CircuitBreakerOpen", outcome.GetError().GetExceptionName().c_str());
+    ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+}
+
 TEST_F(AWSClientTestSuite, TestStandardRetryStrategy)
 {
     ClientConfiguration config;
@@ -377,6 +628,168 @@ TEST_F(AWSClientTestSuite, TestStandardRetryStrategy)
     ASSERT_EQ(3, clientWithStandardRetryStrategy.GetRetryQuotaContainer()->GetRetryQuota());
 }
 
+TEST_F(AWSClientTestSuite, TestAsyncRetriesResumeOnTheExecutor)
+{
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<CountedStandardRetryStrategy>(ALLOCATION_TAG);
+    config.retryScheduler = Aws::MakeShared<Aws::Utils::Threading::TimerScheduler>(ALLOCATION_TAG, std::chrono::milliseconds(1));
+    MockAWSClientWithStandardRetryStrategy clientWithStandardRetryStrategy(config);
+
+    HeaderValueCollection responseHeaders;
+    AWSError<CoreErrors> connectionError(CoreErrors::NETWORK_CONNECTION, true);
+    QueueMockResponse(connectionError, responseHeaders);
+    QueueMockResponse(connectionError, responseHeaders);
+    QueueMockResponse(HttpResponseCode::OK, responseHeaders);
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+
+    std::promise<std::thread::id> lastAttemptThread;
+    bool success = false;
+    clientWithStandardRetryStrategy.MakeRequestAsync(request, [&](HttpResponseOutcome&& outcome)
+    {
+        success = outcome.IsSuccess();
+        lastAttemptThread.set_value(std::this_thread::get_id());
+    });
+
+    // The calling thread only made the first attempt, the retries were scheduled.
+    ASSERT_NE(std::this_thread::get_id(), lastAttemptThread.get_future().get());
+    ASSERT_TRUE(success);
+    ASSERT_EQ(2, clientWithStandardRetryStrategy.GetRequestAttemptedRetries());
+    ASSERT_EQ(3u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+TEST_F(AWSClientTestSuite, TestAsyncRetriesEndWithTheClient)
+{
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<CountedStandardRetryStrategy>(ALLOCATION_TAG);
+    // The retry is only due in an hour, the client is destroyed before.
+    auto retryScheduler = Aws::MakeShared<Aws::Utils::Threading::TimerScheduler>(ALLOCATION_TAG, std::chrono::hours(1));
+    config.retryScheduler = retryScheduler;
+
+    HeaderValueCollection responseHeaders;
+    QueueMockResponse(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, true), responseHeaders);
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+
+    std::atomic<int> handlerCalls(0);
+    CoreErrors lastError = CoreErrors::UNKNOWN;
+    std::promise<std::thread::id> handlerThread;
+    {
+        MockAWSClientWithStandardRetryStrategy clientWithStandardRetryStrategy(config);
+        clientWithStandardRetryStrategy.MakeRequestAsync(request, [&](HttpResponseOutcome&& outcome)
+        {
+            lastError = outcome.IsSuccess() ? CoreErrors::UNKNOWN : outcome.GetError().GetErrorType();
+            ++handlerCalls;
+            handlerThread.set_value(std::this_thread::get_id());
+        });
+        ASSERT_EQ(0, handlerCalls.load());
+        ASSERT_EQ(1u, retryScheduler->GetPendingCount());
+    }
+
+    // The pending retry was cancelled and the call ended with the error of its last attempt, on the executor rather than
+    // on the thread destroying the client.
+    ASSERT_NE(std::this_thread::get_id(), handlerThread.get_future().get());
+    ASSERT_EQ(1, handlerCalls.load());
+    ASSERT_EQ(CoreErrors::NETWORK_CONNECTION, lastError);
+    ASSERT_EQ(0u, retryScheduler->GetPendingCount());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+TEST_F(AWSClientTestSuite, TestRequestTimingAttachedToOutcome)
+{
+    using Aws::Monitoring::RequestPhase;
+
+    // Requests are not timed unless asked to.
+    HeaderValueCollection responseHeaders;
+    QueueMockResponse(HttpResponseCode::OK, responseHeaders);
+    AmazonWebServiceRequestMock request;
+    auto outcome = client->MakeRequest(request);
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(nullptr, outcome.GetResult()->GetRequestTiming());
+
+    ClientConfiguration config;
+    config.scheme = Scheme::HTTP;
+    config.retryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG);
+    config.enableRequestTiming = true;
+    MockAWSClient timedClient(config);
+
+    QueueMockResponse(HttpResponseCode::OK, responseHeaders);
+    outcome = timedClient.MakeRequest(request);
+    ASSERT_TRUE(outcome.IsSuccess());
+    std::shared_ptr<const Aws::Monitoring::RequestTiming> timing = outcome.GetResult()->GetRequestTiming();
+    ASSERT_NE(nullptr, timing);
+    ASSERT_EQ(1, timing->GetAttemptCount());
+    ASSERT_FALSE(timing->GetInvocationId().empty());
+    bool serialized = false, signed_ = false;
+    for (const auto& span : timing->GetSpans())
+    {
+        ASSERT_EQ(1, span.attempt);
+        serialized |= span.phase == RequestPhase::Serialization;
+        signed_ |= span.phase == RequestPhase::Signing;
+    }
+    ASSERT_TRUE(serialized);
+    ASSERT_TRUE(signed_);
+    ASSERT_EQ(std::chrono::microseconds(0), timing->GetPhaseDuration(RequestPhase::RetryDelay));
+
+    // Errors carry the timing of every attempt, the first one fails because of clock skew.
+    DateTime serverTime = DateTime::Now() + std::chrono::hours(1);
+    QueueMockResponse(HttpResponseCode::REQUEST_NOT_MADE, HeaderValueCollection{std::make_pair("Date", serverTime.ToGmtString(DateFormat::RFC822))});
+    QueueMockResponse(HttpResponseCode::FORBIDDEN, responseHeaders);
+    outcome = timedClient.MakeRequest(request);
+    ASSERT_FALSE(outcome.IsSuccess());
+    timing = outcome.GetError().GetRequestTiming();
+    ASSERT_NE(nullptr, timing);
+    ASSERT_EQ(2, timing->GetAttemptCount());
+    ASSERT_LE(timing->GetPhaseDuration(RequestPhase::Signing, 2), timing->GetPhaseDuration(RequestPhase::Signing));
+    ASSERT_LE(timing->GetPhaseDuration(RequestPhase::RetryDelay), timing->GetTotalDuration());
+}
+
+TEST_F(AWSClientTestSuite, TestRequestTracerReceivesSpans)
+{
+    ClientConfiguration config;
+    config.scheme = Scheme::HTTP;
+    config.retryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG);
+    auto tracer = Aws::MakeShared<RecordingRequestTracer>(ALLOCATION_TAG);
+    config.requestTracer = tracer;
+    MockAWSClient tracedClient(config);
+
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    AmazonWebServiceRequestMock request;
+    auto outcome = tracedClient.MakeRequest(request);
+    ASSERT_TRUE(outcome.IsSuccess());
+    const auto& spans = outcome.GetResult()->GetRequestTiming()->GetSpans();
+    ASSERT_EQ(spans.size(), tracer->spans.size());
+    for (size_t i = 0; i < spans.size(); ++i)
+    {
+        ASSERT_EQ(spans[i].phase, tracer->spans[i].phase);
+        ASSERT_EQ(spans[i].duration, tracer->spans[i].duration);
+        ASSERT_STREQ(mockHttpClient->GetMostRecentHttpRequest().GetHeaders()[Http::SDK_INVOCATION_ID_HEADER].c_str(), tracer->invocationIds[i].c_str());
+    }
+}
+
+TEST(RequestTimingTest, TestPhaseDurations)
+{
+    using namespace Aws::Monitoring;
+
+    auto tracer = Aws::MakeShared<RecordingRequestTracer>(ALLOCATION_TAG);
+    RequestTiming timing("service", "Operation", "id", tracer);
+    auto start = timing.GetStartTime();
+    timing.StartAttempt();
+    timing.AddSpan(RequestPhase::Signing, start, std::chrono::microseconds(10));
+    timing.AddSpan(RequestPhase::TimeToFirstByte, start + std::chrono::microseconds(10), std::chrono::microseconds(100));
+    timing.AddSpan(RequestPhase::RetryDelay, start + std::chrono::microseconds(110), std::chrono::microseconds(1000));
+    timing.StartAttempt();
+    timing.AddSpan(RequestPhase::Signing, start + std::chrono::microseconds(1110), std::chrono::microseconds(20));
+
+    ASSERT_EQ(2, timing.GetAttemptCount());
+    ASSERT_EQ(4u, timing.GetSpans().size());
+    ASSERT_EQ(4u, tracer->spans.size());
+    ASSERT_EQ(2, tracer->spans.back().attempt);
+    ASSERT_EQ(std::chrono::microseconds(30), timing.GetPhaseDuration(RequestPhase::Signing));
+    ASSERT_EQ(std::chrono::microseconds(20), timing.GetPhaseDuration(RequestPhase::Signing, 2));
+    ASSERT_EQ(std::chrono::microseconds(0), timing.GetPhaseDuration(RequestPhase::TlsHandshake));
+    ASSERT_EQ(std::chrono::microseconds(1130), timing.GetTotalDuration());
+    ASSERT_STREQ("TimeToFirstByte", GetRequestPhaseName(RequestPhase::TimeToFirstByte));
+}
+
 TEST(AWSClientTest, TestBuildHttpRequestWithHeadersOnly)
 {
     HeaderValueCollection headerValues;
@@ -0,0 +1,140 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CircuitBreaker.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+using namespace Aws::Client;
+
+static const char SERVICE_NAME[] = "CircuitBreakerTest";
+static const char CIRCUIT_NAME[] = "dynamodb.us-east-1.amazonaws.com/GetItem";
+
+class ManualClockCircuitBreaker : public CircuitBreaker
+{
+public:
+    ManualClockCircuitBreaker(const CircuitBreakerConfiguration& configuration) : CircuitBreaker(configuration) {}
+
+    void Advance(std::chrono::milliseconds duration) { m_now += duration; }
+
+protected:
+    std::chrono::steady_clock::time_point Now() const override { return m_now; }
+
+private:
+    std::chrono::steady_clock::time_point m_now;
+};
+
+static CircuitBreakerConfiguration TestConfiguration()
+{
+    CircuitBreakerConfiguration configuration;
+    configuration.failureRateThreshold = 0.5;
+    configuration.minimumAttempts = 4;
+    configuration.window = std::chrono::seconds(10);
+    configuration.openDuration = std::chrono::seconds(5);
+    configuration.halfOpenProbes = 1;
+    return configuration;
+}
+
+static void Attempt(CircuitBreaker& circuitBreaker, bool failed)
+{
+    ASSERT_TRUE(circuitBreaker.AllowAttempt(SERVICE_NAME, CIRCUIT_NAME));
+    circuitBreaker.OnAttemptFinished(SERVICE_NAME, CIRCUIT_NAME, failed);
+}
+
+TEST(CircuitBreakerTest, TestOpensOnFailureRate)
+{
+    ManualClockCircuitBreaker circuitBreaker(TestConfiguration());
+    ASSERT_EQ(CircuitState::CLOSED, circuitBreaker.GetState(CIRCUIT_NAME));
+
+    // Failing attempts under the minimum don't open the circuit.
+    Attempt(circuitBreaker, true);
+    Attempt(circuitBreaker, true);
+    Attempt(circuitBreaker, false);
+    ASSERT_EQ(CircuitState::CLOSED, circuitBreaker.GetState(CIRCUIT_NAME));
+
+    // Counts start over with the next window.
+    circuitBreaker.Advance(std::chrono::seconds(10));
+    Attempt(circuitBreaker, true);
+    Attempt(circuitBreaker, false);
+    Attempt(circuitBreaker, false);
+    ASSERT_EQ(CircuitState::CLOSED, circuitBreaker.GetState(CIRCUIT_NAME));
+    Attempt(circuitBreaker, true);
+    ASSERT_EQ(CircuitState::OPEN, circuitBreaker.GetState(CIRCUIT_NAME));
+    ASSERT_FALSE(circuitBreaker.AllowAttempt(SERVICE_NAME, CIRCUIT_NAME));
+
+    // Other circuits are not affected.
+    ASSERT_TRUE(circuitBreaker.AllowAttempt(SERVICE_NAME, "dynamodb.us-east-1.amazonaws.com/PutItem"));
+}
+
+TEST(CircuitBreakerTest, TestHalfOpenProbes)
+{
+    ManualClockCircuitBreaker circuitBreaker(TestConfiguration());
+    for (int i = 0; i < 4; ++i)
+    {
+        Attempt(circuitBreaker, true);
+    }
+    ASSERT_EQ(CircuitState::OPEN, circuitBreaker.GetState(CIRCUIT_NAME));
+
+    circuitBreaker.Advance(std::chrono::milliseconds(4999));
+    ASSERT_FALSE(circuitBreaker.AllowAttempt(SERVICE_NAME, CIRCUIT_NAME));
+
+    // A single probe at a time, its failure opens the circuit again.
+    circuitBreaker.Advance(std::chrono::milliseconds(1));
+    ASSERT_TRUE(circuitBreaker.AllowAttempt(SERVICE_NAME, CIRCUIT_NAME));
+    ASSERT_EQ(CircuitState::HALF_OPEN, circuitBreaker.GetState(CIRCUIT_NAME));
+    ASSERT_FALSE(circuitBreaker.AllowAttempt(SERVICE_NAME, CIRCUIT_NAME));
+    circuitBreaker.OnAttemptFinished(SERVICE_NAME, CIRCUIT_NAME, true);
+    ASSERT_EQ(CircuitState::OPEN, circuitBreaker.GetState(CIRCUIT_NAME));
+    ASSERT_FALSE(circuitBreaker.AllowAttempt(SERVICE_NAME, CIRCUIT_NAME));
+
+    // A successful probe closes it, with fresh counts.
+    circuitBreaker.Advance(std::chrono::seconds(5));
+    Attempt(circuitBreaker, false);
+    ASSERT_EQ(CircuitState::CLOSED, circuitBreaker.GetState(CIRCUIT_NAME));
+    Attempt(circuitBreaker, true);
+    Attempt(circuitBreaker, true);
+    Attempt(circuitBreaker, true);
+    ASSERT_EQ(CircuitState::CLOSED, circuitBreaker.GetState(CIRCUIT_NAME));
+}
+
+TEST(CircuitBreakerTest, TestAbandonedProbeIsGivenBack)
+{
+    ManualClockCircuitBreaker circuitBreaker(TestConfiguration());
+    for (int i = 0; i < 4; ++i)
+    {
+        Attempt(circuitBreaker, true);
+    }
+    circuitBreaker.Advance(std::chrono::seconds(5));
+    ASSERT_TRUE(circuitBreaker.AllowAttempt(SERVICE_NAME, CIRCUIT_NAME));
+    ASSERT_FALSE(circuitBreaker.AllowAttempt(SERVICE_NAME, CIRCUIT_NAME));
+
+    // The probe had no outcome, the circuit stays half open and lets another one through.
+    circuitBreaker.OnAttemptAbandoned(CIRCUIT_NAME);
+    ASSERT_EQ(CircuitState::HALF_OPEN, circuitBreaker.GetState(CIRCUIT_NAME));
+    Attempt(circuitBreaker, false);
+    ASSERT_EQ(CircuitState::CLOSED, circuitBreaker.GetState(CIRCUIT_NAME));
+}
+
+TEST(CircuitBreakerTest, TestCircuitNamesAndFailures)
+{
+    CircuitBreakerConfiguration configuration;
+    CircuitBreaker perOperation(configuration);
+    ASSERT_STREQ("s3.amazonaws.com/GetObject", perOperation.GetCircuitName("s3.amazonaws.com", "GetObject").c_str());
+    configuration.perOperation = false;
+    CircuitBreaker perEndpoint(configuration);
+    ASSERT_STREQ("s3.amazonaws.com", perEndpoint.GetCircuitName("s3.amazonaws.com", "GetObject").c_str());
+
+    ASSERT_TRUE(perOperation.IsFailure(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, true)));
+    ASSERT_TRUE(perOperation.IsFailure(AWSError<CoreErrors>(CoreErrors::THROTTLING, true)));
+    AWSError<CoreErrors> serverError(CoreErrors::INTERNAL_FAILURE, false);
+    serverError.SetResponseCode(Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR);
+    ASSERT_TRUE(perOperation.IsFailure(serverError));
+    AWSError<CoreErrors> clientError(CoreErrors::VALIDATION, false);
+    clientError.SetResponseCode(Aws::Http::HttpResponseCode::BAD_REQUEST);
+    ASSERT_FALSE(perOperation.IsFailure(clientError));
+}
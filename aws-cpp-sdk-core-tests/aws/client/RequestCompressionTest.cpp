@@ -0,0 +1,77 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/RequestCompression.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Client;
+
+static Aws::String RoundTrip(const Aws::String& payload, CompressionAlgorithm algorithm, Aws::String& compressedBytes)
+{
+    Aws::StringStream input(payload);
+    auto compressed = RequestCompression::Compress(input, algorithm);
+    EXPECT_NE(nullptr, compressed);
+    Aws::StringStream compressedCopy;
+    compressedCopy << compressed->rdbuf();
+    compressedBytes = compressedCopy.str();
+
+    compressed->seekg(0, compressed->beg);
+    auto decompressed = RequestCompression::Decompress(*compressed, algorithm);
+    EXPECT_NE(nullptr, decompressed);
+    Aws::StringStream output;
+    output << decompressed->rdbuf();
+    return output.str();
+}
+
+TEST(RequestCompressionTest, TestContentEncoding)
+{
+    ASSERT_STREQ("gzip", RequestCompression::GetContentEncoding(CompressionAlgorithm::GZIP));
+    ASSERT_STREQ("deflate", RequestCompression::GetContentEncoding(CompressionAlgorithm::DEFLATE));
+    ASSERT_EQ(nullptr, RequestCompression::GetContentEncoding(CompressionAlgorithm::NONE));
+    ASSERT_FALSE(RequestCompression::IsSupported(CompressionAlgorithm::NONE));
+}
+
+TEST(RequestCompressionTest, TestRoundTrip)
+{
+    if (!RequestCompression::IsSupported(CompressionAlgorithm::GZIP))
+    {
+        return;
+    }
+
+    // Larger than the chunks the body is read in.
+    Aws::String payload;
+    for (int i = 0; i < 5000; ++i)
+    {
+        payload += "{\"Namespace\":\"App\",\"MetricName\":\"Latency\",\"Value\":" + Aws::String(1, static_cast<char>('0' + i % 10)) + "}";
+    }
+
+    Aws::String gzipped;
+    ASSERT_EQ(payload, RoundTrip(payload, CompressionAlgorithm::GZIP, gzipped));
+    ASSERT_LT(gzipped.size(), payload.size() / 5);
+    ASSERT_EQ('\x1f', gzipped[0]);
+    ASSERT_EQ('\x8b', gzipped[1]);
+
+    Aws::String deflated;
+    ASSERT_EQ(payload, RoundTrip(payload, CompressionAlgorithm::DEFLATE, deflated));
+    ASSERT_EQ('\x78', deflated[0]);
+
+    Aws::String empty;
+    ASSERT_EQ("", RoundTrip("", CompressionAlgorithm::GZIP, empty));
+}
+
+TEST(RequestCompressionTest, TestDecompressRejectsTruncatedInput)
+{
+    if (!RequestCompression::IsSupported(CompressionAlgorithm::GZIP))
+    {
+        return;
+    }
+
+    Aws::String gzipped;
+    RoundTrip(Aws::String(4096, 'a'), CompressionAlgorithm::GZIP, gzipped);
+    Aws::StringStream truncated(gzipped.substr(0, gzipped.size() / 2));
+    ASSERT_EQ(nullptr, RequestCompression::Decompress(truncated, CompressionAlgorithm::GZIP));
+}
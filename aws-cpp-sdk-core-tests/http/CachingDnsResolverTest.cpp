@@ -0,0 +1,116 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/http/CachingDnsResolver.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Http;
+
+static const char ALLOCATION_TAG[] = "CachingDnsResolverTest";
+
+// Stands in for the system resolver, returns whatever the test set up.
+class StubLookup
+{
+public:
+    StubLookup() : m_lookups(0) {}
+
+    void SetAddresses(const Aws::Vector<Aws::String>& addresses)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_addresses = addresses;
+    }
+
+    CachingDnsResolver::LookupFunction GetFunction()
+    {
+        return [this](const Aws::String& host)
+        {
+            ++m_lookups;
+            std::lock_guard<std::mutex> locker(m_lock);
+            return host == "s3.us-east-1.amazonaws.com" ? m_addresses : Aws::Vector<Aws::String>();
+        };
+    }
+
+    int GetLookupCount() const { return m_lookups.load(); }
+
+private:
+    std::mutex m_lock;
+    Aws::Vector<Aws::String> m_addresses;
+    std::atomic<int> m_lookups;
+};
+
+TEST(CachingDnsResolverTest, TestRoundRobinSpreadsConnections)
+{
+    StubLookup stub;
+    stub.SetAddresses({"10.0.0.1", "10.0.0.2", "10.0.0.3"});
+    CachingDnsResolver resolver(std::chrono::seconds(60), AddressSelectionPolicy::ROUND_ROBIN, stub.GetFunction());
+
+    const Aws::String host("s3.us-east-1.amazonaws.com");
+    ASSERT_EQ("10.0.0.1", resolver.AcquireAddress(host));
+    ASSERT_EQ("10.0.0.2", resolver.AcquireAddress(host));
+    ASSERT_EQ("10.0.0.3", resolver.AcquireAddress(host));
+    ASSERT_EQ("10.0.0.1", resolver.AcquireAddress(host));
+    ASSERT_EQ(1, stub.GetLookupCount());
+
+    ASSERT_EQ("", resolver.AcquireAddress("unknown.host"));
+}
+
+TEST(CachingDnsResolverTest, TestLeastLoadedPicksTheAddressWithFewestConnections)
+{
+    StubLookup stub;
+    stub.SetAddresses({"10.0.0.1", "10.0.0.2"});
+    CachingDnsResolver resolver(std::chrono::seconds(60), AddressSelectionPolicy::LEAST_LOADED, stub.GetFunction());
+
+    const Aws::String host("s3.us-east-1.amazonaws.com");
+    ASSERT_EQ("10.0.0.1", resolver.AcquireAddress(host));
+    ASSERT_EQ("10.0.0.2", resolver.AcquireAddress(host));
+    ASSERT_EQ("10.0.0.1", resolver.AcquireAddress(host));
+    resolver.ReleaseAddress(host, "10.0.0.1");
+    resolver.ReleaseAddress(host, "10.0.0.1");
+    // 10.0.0.2 still has a connection, round robin would have picked it next.
+    ASSERT_EQ("10.0.0.1", resolver.AcquireAddress(host));
+}
+
+TEST(CachingDnsResolverTest, TestRemovedAddressesAreSkippedUntilTheNextLookup)
+{
+    StubLookup stub;
+    stub.SetAddresses({"10.0.0.1", "10.0.0.2"});
+    CachingDnsResolver resolver(std::chrono::milliseconds(0), AddressSelectionPolicy::ROUND_ROBIN, stub.GetFunction());
+
+    const Aws::String host("s3.us-east-1.amazonaws.com");
+    ASSERT_EQ("10.0.0.1", resolver.AcquireAddress(host));
+    resolver.RemoveAddress(host, "10.0.0.1");
+    ASSERT_EQ(1u, resolver.GetCachedAddresses(host).size());
+
+    // Expired straight away, without an executor the lookup happens right here.
+    stub.SetAddresses({"10.0.0.3"});
+    ASSERT_EQ("10.0.0.3", resolver.AcquireAddress(host));
+    ASSERT_EQ(2, stub.GetLookupCount());
+}
+
+TEST(CachingDnsResolverTest, TestExpiredEntriesAreRefreshedInTheBackground)
+{
+    StubLookup stub;
+    stub.SetAddresses({"10.0.0.1"});
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(ALLOCATION_TAG);
+    CachingDnsResolver resolver(std::chrono::milliseconds(10), AddressSelectionPolicy::ROUND_ROBIN, stub.GetFunction(), executor);
+
+    const Aws::String host("s3.us-east-1.amazonaws.com");
+    ASSERT_EQ("10.0.0.1", resolver.AcquireAddress(host));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    stub.SetAddresses({"10.0.0.2"});
+    // The stale address is handed out while the refresh runs.
+    ASSERT_EQ("10.0.0.1", resolver.AcquireAddress(host));
+    while (resolver.GetCachedAddresses(host).front() != "10.0.0.2")
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ("10.0.0.2", resolver.AcquireAddress(host));
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/http/CompactHeaderCollection.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+TEST(CompactHeaderCollectionTest, TestCaseInsensitiveLookup)
+{
+    CompactHeaderCollection headers;
+    headers.Set("Content-Length", "10");
+    headers.Set("X-Amz-Meta-Custom", "value");
+
+    ASSERT_EQ(2u, headers.size());
+    ASSERT_TRUE(headers.Has("content-length"));
+    ASSERT_TRUE(headers.Has("CONTENT-LENGTH"));
+    ASSERT_STREQ("value", headers.Find("x-amz-meta-custom")->c_str());
+    ASSERT_EQ(nullptr, headers.Find("x-amz-meta-other"));
+    ASSERT_EQ(nullptr, headers.Find("content"));
+
+    // Names are kept in lower case, whether interned or not.
+    ASSERT_STREQ("content-length", headers.begin()->GetName());
+    ASSERT_STREQ("x-amz-meta-custom", (headers.begin() + 1)->GetName());
+
+    headers.Set("CONTENT-length", "20");
+    ASSERT_EQ(2u, headers.size());
+    ASSERT_STREQ("20", headers.Find("Content-Length")->c_str());
+
+    ASSERT_TRUE(headers.Erase("X-AMZ-META-CUSTOM"));
+    ASSERT_FALSE(headers.Erase("x-amz-meta-custom"));
+    ASSERT_EQ(1u, headers.size());
+}
+
+TEST(CompactHeaderCollectionTest, TestOrderMatchesHeaderValueCollection)
+{
+    CompactHeaderCollection headers;
+    const char* names[] = { "x-amz-date", "Host", "x-amzn-trace-id", "x-amz-meta-b", "accept", "x-amz-meta-a", "content-type", "x-amz-" };
+    HeaderValueCollection expected;
+    for (const char* name : names)
+    {
+        headers.Set(name, Aws::String("value of ") + name);
+        expected[Aws::Utils::StringUtils::ToLower(name)] = Aws::String("value of ") + name;
+    }
+
+    HeaderValueCollection copied = headers.ToHeaderValueCollection();
+    ASSERT_EQ(expected, copied);
+
+    auto expectedIt = expected.begin();
+    for (const auto& header : headers)
+    {
+        ASSERT_STREQ(expectedIt->first.c_str(), header.GetName());
+        ASSERT_EQ(expectedIt->second, header.GetValue());
+        ++expectedIt;
+    }
+}
+
+TEST(CompactHeaderCollectionTest, TestStandardHttpRequestVisitsHeadersInOrder)
+{
+    StandardHttpRequest request(URI("https://example.amazonaws.com/path"), HttpMethod::HTTP_GET);
+    request.SetHeaderValue("X-Amz-Date", "  20200101T000000Z ");
+    request.SetHeaderValue(CONTENT_TYPE_HEADER, "text/plain");
+
+    ASSERT_TRUE(request.HasHeader("x-amz-date"));
+    ASSERT_STREQ("20200101T000000Z", request.GetHeaderValue(AWS_DATE_HEADER).c_str());
+
+    Aws::Vector<Aws::String> visited;
+    request.ForEachHeader([&](const char* name, const Aws::String& value) { visited.push_back(Aws::String(name) + "=" + value); });
+    ASSERT_EQ(3u, visited.size());
+    ASSERT_STREQ("content-type=text/plain", visited[0].c_str());
+    ASSERT_STREQ("host=example.amazonaws.com", visited[1].c_str());
+    ASSERT_STREQ("x-amz-date=20200101T000000Z", visited[2].c_str());
+
+    request.DeleteHeader("Content-Type");
+    ASSERT_FALSE(request.HasHeader(CONTENT_TYPE_HEADER));
+    ASSERT_EQ(2u, request.GetHeaders().size());
+}
@@ -0,0 +1,117 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/http/EndpointConnectionLimiter.h>
+#include <aws/core/http/URI.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Aws::Http;
+
+TEST(EndpointConnectionLimiterTest, TestEndpointKey)
+{
+    ASSERT_STREQ("https://s3.us-east-1.amazonaws.com:443",
+        EndpointConnectionLimiter::GetEndpointKey(URI("https://s3.us-east-1.amazonaws.com/bucket/key")).c_str());
+    ASSERT_STREQ("http://localhost:8080", EndpointConnectionLimiter::GetEndpointKey(URI("http://localhost:8080/path?query=1")).c_str());
+}
+
+TEST(EndpointConnectionLimiterTest, TestNoLimit)
+{
+    EndpointConnectionLimiter limiter(0);
+    for (int i = 0; i < 100; ++i)
+    {
+        limiter.Acquire("endpoint");
+    }
+    ASSERT_EQ(0u, limiter.GetActiveConnections("endpoint"));
+}
+
+TEST(EndpointConnectionLimiterTest, TestEndpointsAreCountedSeparately)
+{
+    EndpointConnectionLimiter limiter(2);
+    limiter.Acquire("a");
+    limiter.Acquire("a");
+    limiter.Acquire("b");
+    ASSERT_EQ(2u, limiter.GetActiveConnections("a"));
+    ASSERT_EQ(1u, limiter.GetActiveConnections("b"));
+
+    limiter.Release("a");
+    limiter.Release("a");
+    limiter.Release("b");
+    ASSERT_EQ(0u, limiter.GetActiveConnections("a"));
+    ASSERT_EQ(0u, limiter.GetActiveConnections("b"));
+}
+
+TEST(EndpointConnectionLimiterTest, TestAcquireBlocksAtTheLimit)
+{
+    EndpointConnectionLimiter limiter(1);
+    limiter.Acquire("a");
+
+    std::atomic<bool> acquired(false);
+    std::thread waiter([&]
+    {
+        limiter.Acquire("a");
+        acquired = true;
+        limiter.Release("a");
+    });
+
+    // Another endpoint is not held up by the busy one.
+    limiter.Acquire("b");
+    limiter.Release("b");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(acquired.load());
+
+    limiter.Release("a");
+    waiter.join();
+    ASSERT_TRUE(acquired.load());
+    ASSERT_EQ(0u, limiter.GetActiveConnections("a"));
+}
+
+TEST(EndpointConnectionLimiterTest, TestAcquireTimesOut)
+{
+    EndpointConnectionLimiter limiter(1);
+    ASSERT_TRUE(limiter.Acquire("a"));
+    ASSERT_FALSE(limiter.Acquire("a", Aws::Utils::AcquirePriority::NORMAL, std::chrono::milliseconds(10)));
+    ASSERT_EQ(1u, limiter.GetActiveConnections("a"));
+
+    limiter.Release("a");
+    ASSERT_TRUE(limiter.Acquire("a", Aws::Utils::AcquirePriority::NORMAL, std::chrono::milliseconds(10)));
+    limiter.Release("a");
+    ASSERT_EQ(0u, limiter.GetActiveConnections("a"));
+}
+
+TEST(EndpointConnectionLimiterTest, TestHigherPriorityGoesFirst)
+{
+    EndpointConnectionLimiter limiter(1);
+    limiter.Acquire("a");
+
+    std::atomic<bool> highAcquired(false);
+    std::atomic<bool> lowAcquiredBeforeHigh(false);
+    std::thread high([&]
+    {
+        limiter.Acquire("a", Aws::Utils::AcquirePriority::HIGH);
+        highAcquired = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        limiter.Release("a");
+    });
+    // A low priority request doesn't get ahead of a waiting high priority one, even when it comes with a timeout.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(limiter.Acquire("a", Aws::Utils::AcquirePriority::LOW, std::chrono::milliseconds(10)));
+    std::thread low([&]
+    {
+        limiter.Acquire("a", Aws::Utils::AcquirePriority::LOW);
+        lowAcquiredBeforeHigh = !highAcquired.load();
+        limiter.Release("a");
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    limiter.Release("a");
+    high.join();
+    low.join();
+    ASSERT_TRUE(highAcquired.load());
+    ASSERT_FALSE(lowAcquiredBeforeHigh.load());
+    ASSERT_EQ(0u, limiter.GetActiveConnections("a"));
+}
@@ -9,13 +9,61 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <atomic>
 
 using namespace Aws::Http;
 using namespace Aws::Utils;
 using namespace Aws::Client;
 
+class PrewarmCountingHttpClient : public HttpClient
+{
+public:
+    PrewarmCountingHttpClient(unsigned maxConnections = 0) : m_headRequests(0), m_maxConnections(maxConnections) {}
+
+    std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request,
+        Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*) const override
+    {
+        if (request->GetMethod() == HttpMethod::HTTP_HEAD)
+        {
+            ++m_headRequests;
+        }
+        auto response = Aws::MakeShared<Standard::StandardHttpResponse>("PrewarmCountingHttpClient", request);
+        response->SetResponseCode(HttpResponseCode::OK);
+        return response;
+    }
+
+    unsigned GetMaxConnections() const override { return m_maxConnections; }
+
+    mutable std::atomic<int> m_headRequests;
+    unsigned m_maxConnections;
+};
+
+TEST(HttpClientTest, TestPrewarmConnectionsSendsConcurrentHeadRequests)
+{
+    PrewarmCountingHttpClient httpClient;
+    ASSERT_EQ(4u, httpClient.PrewarmConnections(URI("https://s3.us-east-1.amazonaws.com"), 4));
+    ASSERT_EQ(4, httpClient.m_headRequests.load());
+
+    ConnectionPoolMetrics metrics = httpClient.GetConnectionPoolMetrics();
+    ASSERT_EQ(0u, metrics.poolSize);
+    ASSERT_EQ(0u, metrics.acquireCount);
+}
+
+TEST(HttpClientTest, TestPrewarmConnectionsIsBoundedByThePool)
+{
+    PrewarmCountingHttpClient httpClient(3);
+    ASSERT_EQ(3u, httpClient.PrewarmConnections(URI("https://s3.us-east-1.amazonaws.com"), 1000));
+    ASSERT_EQ(3, httpClient.m_headRequests.load());
+
+    auto executor = Aws::MakeShared<Threading::PooledThreadExecutor>("HttpClientTest", 2);
+    ASSERT_EQ(3u, httpClient.PrewarmConnections(URI("https://s3.us-east-1.amazonaws.com"), 1000, executor));
+    ASSERT_EQ(6, httpClient.m_headRequests.load());
+}
+
 #ifndef NO_HTTP_CLIENT
 TEST(HttpClientTest, TestRandomURL)
 {
@@ -202,6 +250,7 @@ TEST(HttpClientTest, TestHttpClientOverride)
 
 //Test CURL HTTP Client specific Settings.
 #if ENABLE_CURL_CLIENT
+#include <aws/core/http/CachingDnsResolver.h>
 #include <aws/core/platform/FileSystem.h>
 #include <aws/core/utils/DateTime.h>
 #include <unistd.h>
@@ -272,6 +321,84 @@ TEST(CURLHttpClientTest, TestHttpRequestWorksFine)
     EXPECT_EQ(Aws::Http::HttpResponseCode::OK, response->GetResponseCode());
     EXPECT_EQ("", response->GetClientErrorMessage());
 }
+
+TEST(CURLHttpClientTest, TestAcquireFailures)
+{
+    Aws::Client::ClientConfiguration config;
+    config.maxConnections = 1;
+    config.connectionAcquireTimeoutMs = 100;
+    config.requestTimeoutMs = 10000;
+    auto httpClient = CreateHttpClient(config);
+
+    // The only connection is busy for 2 seconds.
+    std::thread busy([&]()
+    {
+        auto request = CreateHttpRequest(Aws::String("http://127.0.0.1:8778"),
+                                         HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        request->SetHeaderValue("WaitSeconds", "2");
+        httpClient->MakeRequest(request);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    auto request = CreateHttpRequest(Aws::String("http://127.0.0.1:8778"),
+                                     HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto response = httpClient->MakeRequest(request);
+    busy.join();
+    ASSERT_NE(nullptr, response);
+    ASSERT_TRUE(response->HasClientError());
+    ASSERT_EQ(CoreErrors::NETWORK_CONNECTION, response->GetClientErrorType());
+    ASSERT_EQ("Timed out waiting for a connection from the pool.", response->GetClientErrorMessage());
+
+    // A disabled client doesn't send, and its error is not one to retry.
+    httpClient->DisableRequestProcessing();
+    request = CreateHttpRequest(Aws::String("http://127.0.0.1:8778"),
+                                HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    response = httpClient->MakeRequest(request);
+    ASSERT_NE(nullptr, response);
+    ASSERT_TRUE(response->HasClientError());
+    ASSERT_EQ(CoreErrors::USER_CANCELLED, response->GetClientErrorType());
+    ASSERT_EQ(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE, response->GetResponseCode());
+}
+
+TEST(CURLHttpClientTest, TestReusedHandleFollowsTheResolver)
+{
+    // Only the resolver knows this host, the system resolver fails it.
+    const Aws::String host = "sdk-dns-test.invalid";
+    Aws::Vector<Aws::String> addresses(1, "127.0.0.1");
+    Aws::Client::ClientConfiguration config;
+    config.maxConnections = 1; // every request gets the same curl handle
+    config.requestTimeoutMs = 10000;
+    config.dnsResolver = Aws::MakeShared<Aws::Http::CachingDnsResolver>(ALLOCATION_TAG, std::chrono::hours(1),
+        Aws::Http::AddressSelectionPolicy::ROUND_ROBIN, [&addresses](const Aws::String&) { return addresses; });
+    auto httpClient = CreateHttpClient(config);
+
+    auto makeRequest = [&]()
+    {
+        auto request = CreateHttpRequest(Aws::String("http://") + host + ":8778",
+                                         HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        // A new connection for each request, so that each of them resolves the host.
+        request->SetHeaderValue("Connection", "close");
+        return httpClient->MakeRequest(request);
+    };
+
+    auto response = makeRequest();
+    ASSERT_NE(nullptr, response);
+    ASSERT_FALSE(response->HasClientError()) << response->GetClientErrorMessage();
+
+    // The address the handle was pinned to is gone, the handle must not keep using it.
+    addresses.clear();
+    config.dnsResolver->RemoveAddress(host, "127.0.0.1");
+    response = makeRequest();
+    ASSERT_NE(nullptr, response);
+    ASSERT_TRUE(response->HasClientError());
+    ASSERT_EQ(0u, response->GetClientErrorMessage().find("curlCode: 6"));
+
+    // And pinning it again works.
+    addresses.assign(1, "127.0.0.1");
+    response = makeRequest();
+    ASSERT_NE(nullptr, response);
+    ASSERT_FALSE(response->HasClientError()) << response->GetClientErrorMessage();
+}
 #endif // ENABLE_CURL_CLIENT
 #endif // ENABLE_HTTP_CLIENT_TESTING
 #endif // NO_HTTP_CLIENT
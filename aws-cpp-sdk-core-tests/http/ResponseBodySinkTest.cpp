@@ -0,0 +1,77 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/http/ResponseBodySink.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+
+TEST(ResponseBodySinkTest, TestBufferSinkWritesIntoCallerBuffer)
+{
+    unsigned char buffer[8];
+    memset(buffer, 0, sizeof(buffer));
+    BufferResponseBodySink sink(buffer, sizeof(buffer));
+
+    sink.Reset();
+    ASSERT_TRUE(sink.Write("abc", 3));
+    ASSERT_TRUE(sink.Write("defgh", 5));
+    ASSERT_EQ(8u, sink.GetBytesWritten());
+    ASSERT_EQ(0, memcmp("abcdefgh", buffer, 8));
+}
+
+TEST(ResponseBodySinkTest, TestBufferSinkRefusesOverflow)
+{
+    unsigned char buffer[4];
+    memset(buffer, 0, sizeof(buffer));
+    BufferResponseBodySink sink(buffer, sizeof(buffer));
+
+    ASSERT_TRUE(sink.Write("abc", 3));
+    ASSERT_FALSE(sink.Write("de", 2));
+    ASSERT_EQ(3u, sink.GetBytesWritten());
+    ASSERT_EQ(0, memcmp("abc", buffer, 3));
+    ASSERT_EQ(0, buffer[3]);
+}
+
+TEST(ResponseBodySinkTest, TestBufferSinkResetStartsOver)
+{
+    unsigned char buffer[4];
+    BufferResponseBodySink sink(buffer, sizeof(buffer));
+
+    ASSERT_TRUE(sink.Write("abcd", 4));
+    sink.Reset();
+    ASSERT_EQ(0u, sink.GetBytesWritten());
+    ASSERT_TRUE(sink.Write("wxyz", 4));
+    ASSERT_EQ(0, memcmp("wxyz", buffer, 4));
+}
+
+TEST(ResponseBodySinkTest, TestCallbackSink)
+{
+    Aws::String received;
+    size_t resets = 0;
+    CallbackResponseBodySink sink(
+        [&](const char* data, size_t length) { received.append(data, length); return received.size() < 6; },
+        [&]() { received.clear(); ++resets; });
+
+    sink.Reset();
+    ASSERT_TRUE(sink.Write("abc", 3));
+    sink.Reset();
+    ASSERT_TRUE(sink.Write("abc", 3));
+    ASSERT_FALSE(sink.Write("def", 3));
+    ASSERT_STREQ("abcdef", received.c_str());
+    ASSERT_EQ(2u, resets);
+}
+
+TEST(ResponseBodySinkTest, TestCallbackSinkWithoutResetCallback)
+{
+    size_t received = 0;
+    CallbackResponseBodySink sink([&](const char*, size_t length) { received += length; return true; });
+
+    sink.Reset();
+    ASSERT_TRUE(sink.Write("abc", 3));
+    ASSERT_EQ(3u, received);
+}
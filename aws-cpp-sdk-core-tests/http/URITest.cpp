@@ -252,3 +252,19 @@ TEST(URITest, TestGetRFC3986URLEncodedPath)
     uri = "https://test.com/segment+other/b;jsession=1";
     EXPECT_STREQ("/segment%2Bother/b%3Bjsession=1", URI::URLEncodePathRFC3986(uri.GetPath()).c_str());
 }
+
+TEST(URITest, TestURLEncodedPathCollapsesEmptySegments)
+{
+    EXPECT_STREQ("/a/b%20c/", URI::URLEncodePath("//a///b c//").c_str());
+    EXPECT_STREQ("a/b%20c/", URI::URLEncodePath("a///b c//").c_str());
+    EXPECT_STREQ("/", URI::URLEncodePath("///").c_str());
+    EXPECT_STREQ("/a/b%20c/", URI::URLEncodePathRFC3986("//a///b c//").c_str());
+    EXPECT_STREQ("/a/b%20c", URI::URLEncodePathRFC3986("a///b c").c_str());
+    EXPECT_STREQ("/", URI::URLEncodePathRFC3986("///").c_str());
+
+    // Long segments go through the vectorized encoder.
+    EXPECT_STREQ("/0123456789abcdefghijklmnopqrstuvwxyz%20ABCDEFGHIJKLMNOPQRSTUVWXYZ-_.~%24%26%2C%3A%3D%40/x",
+        URI::URLEncodePath("/0123456789abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ-_.~$&,:=@/x").c_str());
+    EXPECT_STREQ("/0123456789abcdefghijklmnopqrstuvwxyz%20ABCDEFGHIJKLMNOPQRSTUVWXYZ-_.~$&,:=@%2B/x",
+        URI::URLEncodePathRFC3986("/0123456789abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ-_.~$&,:=@+/x").c_str());
+}
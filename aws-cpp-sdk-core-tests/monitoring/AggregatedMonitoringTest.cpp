@@ -0,0 +1,216 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/monitoring/AggregatedMonitoring.h>
+#include <aws/core/monitoring/Histogram.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Monitoring;
+using namespace Aws::Utils::Json;
+
+static const char ALLOCATION_TAG[] = "AggregatedMonitoringTest";
+static const char URI_STRING[] = "http://domain.com/something";
+
+TEST(HistogramTest, TestSmallValuesAreExact)
+{
+    Histogram histogram;
+    for (int64_t value = 0; value < 64; ++value)
+    {
+        histogram.Record(value);
+    }
+
+    auto snapshot = histogram.GetSnapshot();
+    ASSERT_EQ(64u, snapshot.GetCount());
+    ASSERT_EQ(0, snapshot.GetMin());
+    ASSERT_EQ(63, snapshot.GetMax());
+    ASSERT_EQ(63 * 64 / 2, snapshot.GetSum());
+    ASSERT_EQ(31, snapshot.GetValueAtPercentile(50.0));
+    ASSERT_EQ(63, snapshot.GetValueAtPercentile(100.0));
+    ASSERT_EQ(10u, snapshot.GetCountAtOrBelow(9));
+}
+
+TEST(HistogramTest, TestBucketBoundsAreContiguous)
+{
+    for (size_t index = 1; index < Histogram::BUCKET_COUNT; ++index)
+    {
+        ASSERT_EQ(Histogram::GetBucketUpperBound(index - 1) + 1, Histogram::GetBucketLowerBound(index));
+        ASSERT_EQ(index, Histogram::GetBucketIndex(Histogram::GetBucketLowerBound(index)));
+        ASSERT_EQ(index, Histogram::GetBucketIndex(Histogram::GetBucketUpperBound(index)));
+    }
+    ASSERT_EQ(Histogram::BUCKET_COUNT - 1, Histogram::GetBucketIndex(Histogram::GetHighestTrackableValue()));
+    ASSERT_EQ(Histogram::BUCKET_COUNT - 1, Histogram::GetBucketIndex(Histogram::GetHighestTrackableValue() * 2));
+    ASSERT_EQ(0u, Histogram::GetBucketIndex(-5));
+}
+
+TEST(HistogramTest, TestPercentilesWithinRelativeError)
+{
+    Histogram histogram;
+    for (int64_t value = 1; value <= 100000; ++value)
+    {
+        histogram.Record(value);
+    }
+
+    auto snapshot = histogram.GetSnapshot();
+    ASSERT_EQ(100000u, snapshot.GetCount());
+    ASSERT_NEAR(50000.0, static_cast<double>(snapshot.GetValueAtPercentile(50.0)), 50000.0 * 0.04);
+    ASSERT_NEAR(99000.0, static_cast<double>(snapshot.GetValueAtPercentile(99.0)), 99000.0 * 0.04);
+    ASSERT_EQ(100000, snapshot.GetValueAtPercentile(100.0));
+}
+
+TEST(HistogramTest, TestDrainResets)
+{
+    Histogram histogram;
+    histogram.Record(10);
+    histogram.Record(1000);
+
+    auto first = histogram.Drain();
+    ASSERT_EQ(2u, first.GetCount());
+    ASSERT_EQ(10, first.GetMin());
+    ASSERT_EQ(1000, first.GetMax());
+
+    auto second = histogram.Drain();
+    ASSERT_EQ(0u, second.GetCount());
+    ASSERT_EQ(0, second.GetMin());
+    ASSERT_EQ(0, second.GetMax());
+
+    second.Merge(first);
+    ASSERT_EQ(2u, second.GetCount());
+    ASSERT_EQ(1010, second.GetSum());
+}
+
+TEST(HistogramTest, TestConcurrentRecording)
+{
+    Histogram histogram;
+    const int threadCount = 4;
+    const int samplesPerThread = 10000;
+    Aws::Vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&histogram, i]() {
+            for (int j = 0; j < samplesPerThread; ++j)
+            {
+                histogram.Record(i * samplesPerThread + j);
+            }
+        });
+    }
+    uint64_t drained = 0;
+    while (drained < threadCount * samplesPerThread / 2)
+    {
+        drained += histogram.Drain().GetCount();
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    drained += histogram.Drain().GetCount();
+    ASSERT_EQ(static_cast<uint64_t>(threadCount * samplesPerThread), drained);
+}
+
+class AggregatedMonitoringTest : public ::testing::Test
+{
+protected:
+    void SetUp()
+    {
+        request = CreateHttpRequest(URI(URI_STRING), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        response = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, request);
+        response->SetResponseCode(HttpResponseCode::OK);
+        monitoring = Aws::MakeUnique<AggregatedMonitoring>(ALLOCATION_TAG, "AggregatedMonitoringTest", "127.0.0.1", 31000, 0/*no background flush*/);
+    }
+
+    void TearDown()
+    {
+        monitoring = nullptr;
+        response = nullptr;
+        request = nullptr;
+    }
+
+    void SucceedCall(const Aws::String& service, const Aws::String& api, int retries, const CoreMetricsCollection& metrics)
+    {
+        HttpResponseOutcome outcome(response);
+        void* context = monitoring->OnRequestStarted(service, api, request);
+        for (int i = 0; i < retries; ++i)
+        {
+            monitoring->OnRequestFailed(service, api, request, HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::THROTTLING, true)), metrics, context);
+            monitoring->OnRequestRetry(service, api, request, context);
+        }
+        monitoring->OnRequestSucceeded(service, api, request, outcome, metrics, context);
+        monitoring->OnFinish(service, api, request, context);
+    }
+
+    void FailCall(const Aws::String& service, const Aws::String& api)
+    {
+        HttpResponseOutcome outcome(AWSError<CoreErrors>(CoreErrors::INTERNAL_FAILURE, false));
+        void* context = monitoring->OnRequestStarted(service, api, request);
+        monitoring->OnRequestFailed(service, api, request, outcome, CoreMetricsCollection(), context);
+        monitoring->OnFinish(service, api, request, context);
+    }
+
+    std::shared_ptr<HttpRequest> request;
+    std::shared_ptr<HttpResponse> response;
+    Aws::UniquePtr<AggregatedMonitoring> monitoring;
+};
+
+TEST_F(AggregatedMonitoringTest, TestSummariesPerServiceAndOperation)
+{
+    CoreMetricsCollection metrics;
+    metrics.httpClientMetrics[GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency)] = 3;
+    metrics.httpClientMetrics[GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency)] = 7;
+
+    SucceedCall("s3", "GetObject", 0, metrics);
+    SucceedCall("s3", "GetObject", 2, metrics);
+    FailCall("s3", "GetObject");
+    SucceedCall("dynamodb", "GetItem", 0, CoreMetricsCollection());
+
+    auto summaries = monitoring->CollectSummaries();
+    ASSERT_EQ(2u, summaries.size());
+
+    for (const auto& summary : summaries)
+    {
+        JsonValue json(summary);
+        ASSERT_TRUE(json.WasParseSuccessful());
+        auto view = json.View();
+        ASSERT_STREQ("ApiCallSummary", view.GetString("Type").c_str());
+        ASSERT_STREQ("AggregatedMonitoringTest", view.GetString("ClientId").c_str());
+        ASSERT_EQ(AggregatedMonitoring::GetVersion(), view.GetInteger("Version"));
+
+        if (view.GetString("Service") == "s3")
+        {
+            ASSERT_STREQ("GetObject", view.GetString("Api").c_str());
+            ASSERT_EQ(3, view.GetInt64("ApiCallCount"));
+            ASSERT_EQ(1, view.GetInt64("FailedApiCallCount"));
+            ASSERT_EQ(2, view.GetInt64("RetryCount"));
+            ASSERT_EQ(5, view.GetObject("AttemptLatency").GetInt64("Count"));
+            ASSERT_EQ(5, view.GetObject("AttemptCount").GetInt64("Sum"));
+            ASSERT_EQ(3, view.GetObject("AttemptCount").GetInt64("Max"));
+            ASSERT_EQ(4, view.GetObject("DnsLatency").GetInt64("Count"));
+            ASSERT_EQ(3, view.GetObject("DnsLatency").GetInt64("P99"));
+            ASSERT_EQ(7, view.GetObject("ConnectLatency").GetInt64("Max"));
+            ASSERT_FALSE(view.ValueExists("SslLatency"));
+        }
+        else
+        {
+            ASSERT_STREQ("dynamodb", view.GetString("Service").c_str());
+            ASSERT_STREQ("GetItem", view.GetString("Api").c_str());
+            ASSERT_EQ(1, view.GetInt64("ApiCallCount"));
+            ASSERT_EQ(0, view.GetInt64("FailedApiCallCount"));
+            ASSERT_FALSE(view.ValueExists("DnsLatency"));
+        }
+    }
+
+    // Everything was drained, idle operations are not reported.
+    ASSERT_TRUE(monitoring->CollectSummaries().empty());
+    SucceedCall("dynamodb", "GetItem", 0, CoreMetricsCollection());
+    ASSERT_EQ(1u, monitoring->CollectSummaries().size());
+}
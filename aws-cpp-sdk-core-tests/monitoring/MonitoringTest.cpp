@@ -316,6 +316,9 @@ TEST_F(MonitoringTestSuite, TestHttpClientMetrics)
     ASSERT_EQ(HttpClientMetricsType::DnsLatency, GetHttpClientMetricTypeByName("DnsLatency"));
     ASSERT_EQ(HttpClientMetricsType::TcpLatency, GetHttpClientMetricTypeByName("TcpLatency"));
     ASSERT_EQ(HttpClientMetricsType::SslLatency, GetHttpClientMetricTypeByName("SslLatency"));
+    ASSERT_EQ(HttpClientMetricsType::TimeToFirstByteLatency, GetHttpClientMetricTypeByName("TimeToFirstByteLatency"));
+    ASSERT_EQ(HttpClientMetricsType::ResponseTransferLatency, GetHttpClientMetricTypeByName("ResponseTransferLatency"));
+    ASSERT_EQ(HttpClientMetricsType::TlsHandshakeLatency, GetHttpClientMetricTypeByName("TlsHandshakeLatency"));
     ASSERT_EQ(HttpClientMetricsType::Unknown, GetHttpClientMetricTypeByName("Unknown"));
     ASSERT_EQ(HttpClientMetricsType::Unknown, GetHttpClientMetricTypeByName("RandomMetricsUnknown"));
 
@@ -327,5 +330,8 @@ TEST_F(MonitoringTestSuite, TestHttpClientMetrics)
     ASSERT_STREQ("DnsLatency", GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency).c_str());
     ASSERT_STREQ("TcpLatency", GetHttpClientMetricNameByType(HttpClientMetricsType::TcpLatency).c_str());
     ASSERT_STREQ("SslLatency", GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency).c_str());
+    ASSERT_STREQ("TimeToFirstByteLatency", GetHttpClientMetricNameByType(HttpClientMetricsType::TimeToFirstByteLatency).c_str());
+    ASSERT_STREQ("ResponseTransferLatency", GetHttpClientMetricNameByType(HttpClientMetricsType::ResponseTransferLatency).c_str());
+    ASSERT_STREQ("TlsHandshakeLatency", GetHttpClientMetricNameByType(HttpClientMetricsType::TlsHandshakeLatency).c_str());
     ASSERT_STREQ("Unknown", GetHttpClientMetricNameByType(HttpClientMetricsType::Unknown).c_str());
 }
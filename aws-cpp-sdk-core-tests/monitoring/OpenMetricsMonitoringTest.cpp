@@ -0,0 +1,187 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/monitoring/OpenMetricsMonitoring.h>
+#include <aws/core/client/RetryStrategy.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/threading/Executor.h>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Monitoring;
+using namespace Aws::Utils::Threading;
+
+static const char ALLOCATION_TAG[] = "OpenMetricsMonitoringTest";
+static const char URI_STRING[] = "http://domain.com/something";
+
+class OpenMetricsMonitoringTest : public ::testing::Test
+{
+protected:
+    void SetUp()
+    {
+        request = CreateHttpRequest(URI(URI_STRING), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        response = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, request);
+        response->SetResponseCode(HttpResponseCode::OK);
+        registry = Aws::MakeShared<OpenMetricsRegistry>(ALLOCATION_TAG);
+        monitoring = OpenMetricsMonitoringFactory(registry).CreateMonitoringInstance();
+    }
+
+    void TearDown()
+    {
+        monitoring = nullptr;
+        registry = nullptr;
+        response = nullptr;
+        request = nullptr;
+    }
+
+    void MakeCall(const Aws::String& service, const Aws::String& api, int throttledAttempts, bool succeed, int64_t acquireConnectionLatency)
+    {
+        CoreMetricsCollection metrics;
+        metrics.httpClientMetrics[GetHttpClientMetricNameByType(HttpClientMetricsType::AcquireConnectionLatency)] = acquireConnectionLatency;
+
+        void* context = monitoring->OnRequestStarted(service, api, request);
+        for (int i = 0; i < throttledAttempts; ++i)
+        {
+            monitoring->OnRequestFailed(service, api, request, HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::THROTTLING, true)), metrics, context);
+            monitoring->OnRequestRetry(service, api, request, context);
+        }
+        if (succeed)
+        {
+            monitoring->OnRequestSucceeded(service, api, request, HttpResponseOutcome(response), metrics, context);
+        }
+        else
+        {
+            monitoring->OnRequestFailed(service, api, request, HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::INTERNAL_FAILURE, false)), metrics, context);
+        }
+        monitoring->OnFinish(service, api, request, context);
+    }
+
+    static bool Contains(const Aws::String& text, const Aws::String& line)
+    {
+        return text.find(line + "\n") != Aws::String::npos;
+    }
+
+    std::shared_ptr<HttpRequest> request;
+    std::shared_ptr<HttpResponse> response;
+    std::shared_ptr<OpenMetricsRegistry> registry;
+    Aws::UniquePtr<MonitoringInterface> monitoring;
+};
+
+TEST_F(OpenMetricsMonitoringTest, TestCountersPerServiceAndOperation)
+{
+    MakeCall("S3", "GetObject", 2, true, 3);
+    MakeCall("S3", "GetObject", 0, false, 3);
+    MakeCall("DynamoDB", "Query", 0, true, 40);
+
+    Aws::String text = registry->Render();
+    ASSERT_TRUE(Contains(text, "# TYPE aws_sdk_api_calls counter"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_api_calls_total{operation=\"GetObject\",service=\"S3\"} 2"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_api_calls_total{operation=\"Query\",service=\"DynamoDB\"} 1"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_api_call_errors_total{operation=\"GetObject\",service=\"S3\"} 1"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_api_call_errors_total{operation=\"Query\",service=\"DynamoDB\"} 0"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_attempts_total{operation=\"GetObject\",service=\"S3\"} 4"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_throttled_attempts_total{operation=\"GetObject\",service=\"S3\"} 2"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_retries_total{operation=\"GetObject\",service=\"S3\"} 2"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_api_calls_in_flight{operation=\"GetObject\",service=\"S3\"} 0"));
+    ASSERT_EQ(text.size() - 6, text.rfind("# EOF\n"));
+}
+
+TEST_F(OpenMetricsMonitoringTest, TestOperationsKeyedByServiceAndName)
+{
+    MakeCall("a.b", "c", 0, true, 3);
+    MakeCall("a", "b.c", 0, false, 3);
+
+    Aws::String text = registry->Render();
+    ASSERT_TRUE(Contains(text, "aws_sdk_api_calls_total{operation=\"c\",service=\"a.b\"} 1"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_api_calls_total{operation=\"b.c\",service=\"a\"} 1"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_api_call_errors_total{operation=\"c\",service=\"a.b\"} 0"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_api_call_errors_total{operation=\"b.c\",service=\"a\"} 1"));
+}
+
+TEST_F(OpenMetricsMonitoringTest, TestConnectionAcquireHistogram)
+{
+    MakeCall("S3", "GetObject", 0, true, 3);
+    MakeCall("S3", "GetObject", 0, true, 40);
+    MakeCall("S3", "GetObject", 0, true, 60000);
+
+    Aws::String text = registry->Render();
+    const Aws::String prefix = "aws_sdk_connection_acquire_duration_seconds";
+    ASSERT_TRUE(Contains(text, "# TYPE " + prefix + " histogram"));
+    ASSERT_TRUE(Contains(text, "# UNIT " + prefix + " seconds"));
+    ASSERT_TRUE(Contains(text, prefix + "_bucket{operation=\"GetObject\",service=\"S3\",le=\"0.002\"} 0"));
+    ASSERT_TRUE(Contains(text, prefix + "_bucket{operation=\"GetObject\",service=\"S3\",le=\"0.005\"} 1"));
+    ASSERT_TRUE(Contains(text, prefix + "_bucket{operation=\"GetObject\",service=\"S3\",le=\"0.05\"} 2"));
+    ASSERT_TRUE(Contains(text, prefix + "_bucket{operation=\"GetObject\",service=\"S3\",le=\"30.0\"} 2"));
+    ASSERT_TRUE(Contains(text, prefix + "_bucket{operation=\"GetObject\",service=\"S3\",le=\"+Inf\"} 3"));
+    ASSERT_TRUE(Contains(text, prefix + "_count{operation=\"GetObject\",service=\"S3\"} 3"));
+    ASSERT_TRUE(Contains(text, prefix + "_sum{operation=\"GetObject\",service=\"S3\"} 60.043"));
+}
+
+TEST_F(OpenMetricsMonitoringTest, TestGauges)
+{
+    auto retryQuota = Aws::MakeShared<DefaultRetryQuotaContainer>(ALLOCATION_TAG);
+    auto executor = Aws::MakeShared<PooledThreadExecutor>(ALLOCATION_TAG, 1);
+    registry->AddRetryQuotaGauge("s3 \"main\"", retryQuota);
+    registry->AddExecutorQueueDepthGauge("pool", executor);
+    registry->AddGauge("custom_ratio", "A custom gauge.", Aws::Map<Aws::String, Aws::String>(), []() { return 0.25; });
+
+    Aws::String text = registry->Render();
+    ASSERT_TRUE(Contains(text, "# TYPE aws_sdk_retry_quota_available gauge"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_retry_quota_available{client=\"s3 \\\"main\\\"\"} 500"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_executor_queue_depth{executor=\"pool\"} 0"));
+    ASSERT_TRUE(Contains(text, "custom_ratio 0.25"));
+
+    // Gauges only hold weak references, samples of released objects are dropped.
+    retryQuota = nullptr;
+    executor = nullptr;
+    text = registry->Render();
+    ASSERT_TRUE(Contains(text, "# TYPE aws_sdk_retry_quota_available gauge"));
+    ASSERT_EQ(Aws::String::npos, text.find("aws_sdk_retry_quota_available{"));
+    ASSERT_EQ(Aws::String::npos, text.find("aws_sdk_executor_queue_depth{"));
+}
+
+TEST_F(OpenMetricsMonitoringTest, TestHelpAndLabelValuesEscaped)
+{
+    Aws::Map<Aws::String, Aws::String> labels;
+    labels["path"] = "C:\\temp\n\"x\"";
+    registry->AddGauge("custom_escaped", "Line one\nC:\\temp \"quoted\"", labels, []() { return 1.0; });
+
+    Aws::String text = registry->Render();
+    ASSERT_TRUE(Contains(text, "# HELP custom_escaped Line one\\nC:\\\\temp \\\"quoted\\\""));
+    ASSERT_TRUE(Contains(text, "custom_escaped{path=\"C:\\\\temp\\n\\\"x\\\"\"} 1"));
+}
+
+TEST_F(OpenMetricsMonitoringTest, TestCircuitStateGauge)
+{
+    monitoring->OnCircuitStateChanged("dynamodb", "dynamodb.us-east-1.amazonaws.com/GetItem", CircuitState::OPEN);
+    Aws::String text = registry->Render();
+    ASSERT_TRUE(Contains(text, "# TYPE aws_sdk_circuit_state gauge"));
+    ASSERT_TRUE(Contains(text, "aws_sdk_circuit_state{circuit=\"dynamodb.us-east-1.amazonaws.com/GetItem\",service=\"dynamodb\"} 1"));
+
+    monitoring->OnCircuitStateChanged("dynamodb", "dynamodb.us-east-1.amazonaws.com/GetItem", CircuitState::HALF_OPEN);
+    monitoring->OnCircuitStateChanged("dynamodb", "dynamodb.us-east-1.amazonaws.com/GetItem", CircuitState::CLOSED);
+    text = registry->Render();
+    ASSERT_TRUE(Contains(text, "aws_sdk_circuit_state{circuit=\"dynamodb.us-east-1.amazonaws.com/GetItem\",service=\"dynamodb\"} 0"));
+    ASSERT_EQ(text.find("aws_sdk_circuit_state{"), text.rfind("aws_sdk_circuit_state{"));
+}
+
+TEST_F(OpenMetricsMonitoringTest, TestListenerLifecycle)
+{
+    ASSERT_EQ(0, registry->GetListenerPort());
+    if (!registry->StartListener())
+    {
+        // Not supported on this platform.
+        ASSERT_EQ(0, registry->GetListenerPort());
+        return;
+    }
+    ASSERT_NE(0, registry->GetListenerPort());
+    ASSERT_FALSE(registry->StartListener());
+    registry->StopListener();
+    ASSERT_EQ(0, registry->GetListenerPort());
+}
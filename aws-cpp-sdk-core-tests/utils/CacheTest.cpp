@@ -134,3 +134,75 @@ TEST(ConcurrentCacheTest, TestPutAndGetConcurrently)
     putter.join();
     getter.join();
 }
+
+TEST(ConcurrentCacheTest, TestGetExpiredEntry)
+{
+    ConcurrentCache<Aws::String, Aws::String> cache(10);
+    cache.Put("answer", "42", std::chrono::milliseconds(-1));
+    Aws::String ignored;
+    ASSERT_FALSE(cache.Get("answer", ignored));
+
+    auto stats = cache.GetStats();
+    ASSERT_EQ(0u, stats.hits);
+    ASSERT_EQ(1u, stats.misses);
+    ASSERT_EQ(1u, stats.expirations);
+    ASSERT_EQ(0u, stats.size);
+}
+
+TEST(ConcurrentCacheTest, TestPutWithSameKeyAndRemove)
+{
+    ConcurrentCache<Aws::String, float> cache(2);
+    cache.Put("one", 1.0f, std::chrono::minutes(5));
+    cache.Put("one", 1.1f, std::chrono::seconds(1));
+
+    float out;
+    ASSERT_TRUE(cache.Get("one", out));
+    ASSERT_EQ(1.1f, out);
+    ASSERT_EQ(1u, cache.GetStats().size);
+
+    ASSERT_TRUE(cache.Remove("one"));
+    ASSERT_FALSE(cache.Remove("one"));
+    ASSERT_FALSE(cache.Get("one", out));
+}
+
+TEST(ConcurrentCacheTest, TestEvictsLeastRecentlyUsedEntry)
+{
+    // A single shard, so that all keys compete for the same slots.
+    ConcurrentCache<Aws::String, int> cache(2, 1);
+    cache.Put("one", 1, std::chrono::minutes(5));
+    cache.Put("two", 2, std::chrono::minutes(5));
+
+    int out;
+    ASSERT_TRUE(cache.Get("one", out));
+    cache.Put("three", 3, std::chrono::minutes(5));
+
+    ASSERT_TRUE(cache.Get("one", out));
+    ASSERT_EQ(1, out);
+    ASSERT_FALSE(cache.Get("two", out));
+    ASSERT_TRUE(cache.Get("three", out));
+    ASSERT_EQ(3, out);
+
+    auto stats = cache.GetStats();
+    ASSERT_EQ(3u, stats.hits);
+    ASSERT_EQ(1u, stats.misses);
+    ASSERT_EQ(1u, stats.evictions);
+    ASSERT_EQ(2u, stats.size);
+}
+
+TEST(ConcurrentCacheTest, TestSizeIsBoundedAcrossShards)
+{
+    ConcurrentCache<int, int> cache(64, 8);
+    for (int i = 0; i < 1000; i++)
+    {
+        cache.Put(i, i, std::chrono::minutes(1));
+    }
+
+    auto stats = cache.GetStats();
+    // Each of the 8 shards holds at most 8 entries.
+    ASSERT_LE(stats.size, 64u);
+    ASSERT_EQ(1000u, stats.size + stats.evictions);
+
+    int out;
+    ASSERT_TRUE(cache.Get(999, out));
+    ASSERT_EQ(999, out);
+}
@@ -197,3 +197,43 @@ TEST(DateTimeTest, TestFormatAutoDetect)
     DateTime parsedBadDate(badDate, DateFormat::AutoDetect);
     ASSERT_FALSE(parsedBadDate.WasParseSuccessful());
 }
+
+TEST(DateTimeTest, TestFixedFormatsMatchStrftimeAndStateMachines)
+{
+    // From 1901 to 2199, stepping by an odd number of seconds to land on all times of day, weekdays and leap days.
+    for (int64_t seconds = -2145916800LL; seconds < 7258118400LL; seconds += 7654321)
+    {
+        const DateTime date(seconds * 1000);
+
+        const Aws::String rfc822 = date.ToGmtString(DateFormat::RFC822);
+        const Aws::String iso8601 = date.ToGmtString(DateFormat::ISO_8601);
+        const Aws::String iso8601Basic = date.ToGmtString(DateFormat::ISO_8601_BASIC);
+        ASSERT_EQ(date.ToGmtString("%a, %d %b %Y %H:%M:%S") + " GMT", rfc822);
+        ASSERT_EQ(date.ToGmtString("%Y-%m-%dT%H:%M:%SZ"), iso8601);
+        ASSERT_EQ(date.ToGmtString("%Y%m%dT%H%M%SZ"), iso8601Basic);
+
+        ASSERT_EQ(date, DateTime(rfc822, DateFormat::RFC822)) << rfc822;
+        ASSERT_EQ(date, DateTime(iso8601, DateFormat::ISO_8601)) << iso8601;
+        ASSERT_EQ(date, DateTime(iso8601.substr(0, 19) + ".123Z", DateFormat::ISO_8601)) << iso8601;
+        ASSERT_EQ(date, DateTime(iso8601Basic, DateFormat::ISO_8601_BASIC)) << iso8601Basic;
+        ASSERT_EQ(date, DateTime(iso8601Basic.substr(0, 15) + "123Z", DateFormat::ISO_8601_BASIC)) << iso8601Basic;
+        ASSERT_EQ(date, DateTime(rfc822, DateFormat::AutoDetect)) << rfc822;
+        ASSERT_EQ(date, DateTime(iso8601, DateFormat::AutoDetect)) << iso8601;
+    }
+}
+
+TEST(DateTimeTest, TestNonCanonicalTimestampsStillParse)
+{
+    const DateTime expected("2002-10-02T08:05:09Z", DateFormat::ISO_8601);
+    // Single digit day, lower case names, other white space and UTC are handled by the general parser.
+    ASSERT_EQ(expected, DateTime("Wed, 2 Oct 2002 08:05:09 GMT", DateFormat::RFC822));
+    ASSERT_EQ(expected, DateTime("wed, 02 oct 2002 08:05:09 utc", DateFormat::RFC822));
+    ASSERT_EQ(expected, DateTime("Wed,\t02 Oct 2002 08:05:09 GMT", DateFormat::RFC822));
+    // Out of range fields carry over the way timegm does.
+    ASSERT_EQ(expected, DateTime("2002-09-32T08:05:09Z", DateFormat::ISO_8601));
+    ASSERT_EQ(DateTime("2003-01-02T08:05:09Z", DateFormat::ISO_8601), DateTime("2002-13-02T08:05:09Z", DateFormat::ISO_8601));
+
+    ASSERT_FALSE(DateTime("2002-10-02T08:05:09", DateFormat::ISO_8601).WasParseSuccessful());
+    ASSERT_FALSE(DateTime("20021002T080509", DateFormat::ISO_8601_BASIC).WasParseSuccessful());
+    ASSERT_FALSE(DateTime("20021002T0805091Z", DateFormat::ISO_8601_BASIC).WasParseSuccessful());
+}
@@ -6,7 +6,9 @@
 #include <aws/external/gtest.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/base64/Base64.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <algorithm>
 
 
 using namespace Aws::Utils;
@@ -81,6 +83,86 @@ TEST(HashingUtilsTest, TestHexEncodingDecoding)
     ASSERT_EQ(hexBuffer, HashingUtils::HexDecode(afterEncoding));
 }
 
+static ByteBuffer MakeTestBuffer(size_t length)
+{
+    ByteBuffer buffer(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        buffer[i] = static_cast<unsigned char>((i * 167 + 13) ^ (i >> 3));
+    }
+    return buffer;
+}
+
+// The url safe alphabet only differs from the MIME one by its last two characters, and is always encoded by the scalar code.
+static const char URL_SAFE_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+static Aws::String UrlSafeToMime(Aws::String str)
+{
+    std::replace(str.begin(), str.end(), '-', '+');
+    std::replace(str.begin(), str.end(), '_', '/');
+    return str;
+}
+
+static Aws::String MimeToUrlSafe(Aws::String str)
+{
+    std::replace(str.begin(), str.end(), '+', '-');
+    std::replace(str.begin(), str.end(), '/', '_');
+    return str;
+}
+
+TEST(HashingUtilsTest, TestBase64MatchesScalarCodecAtEveryLength)
+{
+    Base64::Base64 urlSafe(URL_SAFE_ALPHABET);
+    for (size_t length = 0; length < 300; ++length)
+    {
+        ByteBuffer buffer = MakeTestBuffer(length);
+        Aws::String encoded = HashingUtils::Base64Encode(buffer);
+        ASSERT_EQ(UrlSafeToMime(urlSafe.Encode(buffer)), encoded) << "length " << length;
+        ASSERT_EQ(buffer, HashingUtils::Base64Decode(encoded)) << "length " << length;
+    }
+
+    ByteBuffer large = MakeTestBuffer(64 * 1024 + 7);
+    Aws::String encoded = HashingUtils::Base64Encode(large);
+    ASSERT_EQ(UrlSafeToMime(urlSafe.Encode(large)), encoded);
+    ASSERT_EQ(large, HashingUtils::Base64Decode(encoded));
+}
+
+TEST(HashingUtilsTest, TestBase64DecodingOfInvalidInputMatchesScalarCodec)
+{
+    Base64::Base64 urlSafe(URL_SAFE_ALPHABET);
+    const Aws::String encoded = HashingUtils::Base64Encode(MakeTestBuffer(200));
+    for (size_t position = 0; position < encoded.size(); position += 7)
+    {
+        // Not '=', for which the scalar decoder leaves bytes of the output uninitialized.
+        for (char invalid : {'*', '\n', '\x01', '.'})
+        {
+            Aws::String corrupted = encoded;
+            corrupted[position] = invalid;
+            ASSERT_EQ(urlSafe.Decode(MimeToUrlSafe(corrupted)), HashingUtils::Base64Decode(corrupted)) << "position " << position;
+        }
+    }
+}
+
+TEST(HashingUtilsTest, TestHexEncodingAtEveryLength)
+{
+    for (size_t length = 0; length < 200; ++length)
+    {
+        ByteBuffer buffer = MakeTestBuffer(length);
+        Aws::String expected;
+        for (size_t i = 0; i < length; ++i)
+        {
+            expected.push_back("0123456789abcdef"[buffer[i] >> 4]);
+            expected.push_back("0123456789abcdef"[buffer[i] & 0x0f]);
+        }
+        Aws::String encoded = HashingUtils::HexEncode(buffer);
+        ASSERT_EQ(expected, encoded) << "length " << length;
+        if (length > 0)
+        {
+            ASSERT_EQ(buffer, HashingUtils::HexDecode(encoded));
+        }
+    }
+}
+
 TEST(HashingUtilsTest, TestSHA256HMAC)
 {
     const char* toHash = "TestHash";
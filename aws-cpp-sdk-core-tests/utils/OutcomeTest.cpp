@@ -462,4 +462,58 @@ TEST(JsonServiceNoResultOperationOutcomeTest, TestMoveFromJsonOutcome)
     ASSERT_STREQ("ServiceSpecificException", serviceError.GetExceptionName().c_str());
     ASSERT_STREQ("Error message", serviceError.GetMessage().c_str());
     ASSERT_STREQ("Detailed info", jsonServiceNoResultOperationOutcome.GetError<JsonServiceSpecificException>().GetExceptionInfo().c_str());
-}
\ No newline at end of file
+}
+
+typedef Outcome<Aws::String, AWSError<CoreErrors>> StringOutcome;
+
+TEST(StringOutcomeTest, TestCopyAndMoveAcrossStates)
+{
+    StringOutcome success(Aws::String{RESPONSE_PAYLOAD});
+    StringOutcome failure(CreateAwsError());
+
+    StringOutcome copy(success);
+    ASSERT_TRUE(copy.IsSuccess());
+    ASSERT_STREQ(RESPONSE_PAYLOAD, copy.GetResult().c_str());
+
+    copy = failure;
+    ASSERT_FALSE(copy.IsSuccess());
+    ASSERT_STREQ(ERROR_MESSAGE, copy.GetError().GetMessage().c_str());
+    ASSERT_STREQ(ERROR_MESSAGE, failure.GetError().GetMessage().c_str());
+
+    copy = success;
+    ASSERT_TRUE(copy.IsSuccess());
+    ASSERT_STREQ(RESPONSE_PAYLOAD, copy.GetResult().c_str());
+
+    StringOutcome moved(std::move(copy));
+    ASSERT_TRUE(moved.IsSuccess());
+    ASSERT_STREQ(RESPONSE_PAYLOAD, moved.GetResult().c_str());
+
+    moved = std::move(failure);
+    ASSERT_FALSE(moved.IsSuccess());
+    ASSERT_EQ(CoreErrors::INCOMPLETE_SIGNATURE, moved.GetError().GetErrorType());
+
+    moved = StringOutcome(Aws::String("other"));
+    ASSERT_TRUE(moved.IsSuccess());
+    ASSERT_STREQ("other", moved.GetResultWithOwnership().c_str());
+
+    StringOutcome defaulted;
+    ASSERT_FALSE(defaulted.IsSuccess());
+    ASSERT_EQ(HttpResponseCode::REQUEST_NOT_MADE, defaulted.GetError().GetResponseCode());
+}
+
+TEST(StringOutcomeTest, TestInactiveMemberIsDefaultConstructed)
+{
+    StringOutcome success(Aws::String{RESPONSE_PAYLOAD});
+    ASSERT_TRUE(success.GetError().GetMessage().empty());
+    ASSERT_TRUE(success.GetError().GetExceptionName().empty());
+
+    StringOutcome failure(CreateAwsError());
+    ASSERT_TRUE(failure.GetResult().empty());
+    ASSERT_TRUE(failure.GetResultWithOwnership().empty());
+    ASSERT_STREQ(ERROR_MESSAGE, failure.GetError().GetMessage().c_str());
+
+    // Assignment replaces both the result and the error.
+    failure = success;
+    ASSERT_STREQ(RESPONSE_PAYLOAD, failure.GetResult().c_str());
+    ASSERT_TRUE(failure.GetError().GetMessage().empty());
+}
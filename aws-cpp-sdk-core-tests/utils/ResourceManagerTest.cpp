@@ -0,0 +1,100 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/ResourceManager.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils;
+
+TEST(ResourceManagerTest, TestRemoveAvailableIfLeavesAcquiredResourcesAlone)
+{
+    ExclusiveOwnershipResourceManager<int> manager;
+    for (int i = 1; i <= 5; ++i)
+    {
+        manager.PutResource(i);
+    }
+    int acquired = manager.Acquire();
+    ASSERT_EQ(5, acquired);
+
+    auto removed = manager.RemoveAvailableIf([](int resource) { return resource % 2 == 1; });
+    ASSERT_EQ(2u, removed.size());
+    ASSERT_EQ(1, removed[0]);
+    ASSERT_EQ(3, removed[1]);
+
+    manager.Release(acquired);
+    auto remaining = manager.ShutdownAndWait(3);
+    ASSERT_EQ(3u, remaining.size());
+    ASSERT_EQ(2, remaining[0]);
+    ASSERT_EQ(4, remaining[1]);
+    ASSERT_EQ(5, remaining[2]);
+}
+
+TEST(ResourceManagerTest, TestTryAcquireTimesOut)
+{
+    ExclusiveOwnershipResourceManager<int> manager;
+    manager.PutResource(1);
+
+    int resource = 0;
+    ASSERT_TRUE(manager.TryAcquire(resource, std::chrono::milliseconds(10)));
+    ASSERT_EQ(1, resource);
+
+    int other = 0;
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(manager.TryAcquire(other, std::chrono::milliseconds(20)));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+
+    ResourceWaitStatistics statistics = manager.GetWaitStatistics();
+    ASSERT_EQ(1u, statistics.acquireCount);
+    ASSERT_EQ(1u, statistics.timeoutCount);
+    ASSERT_EQ(1u, statistics.waitHistogram[0]);
+
+    manager.Release(resource);
+    manager.ShutdownAndWait(1);
+}
+
+TEST(ResourceManagerTest, TestHigherPriorityWaitersAreServedFirst)
+{
+    ExclusiveOwnershipResourceManager<int> manager;
+    manager.PutResource(1);
+    int resource = manager.Acquire();
+
+    std::mutex lock;
+    Aws::Vector<AcquirePriority> served;
+    auto waiter = [&](AcquirePriority priority)
+    {
+        int acquired = manager.Acquire(priority);
+        {
+            std::lock_guard<std::mutex> locker(lock);
+            served.push_back(priority);
+        }
+        manager.Release(acquired);
+    };
+
+    std::thread low(waiter, AcquirePriority::LOW);
+    while (manager.GetWaitStatistics(AcquirePriority::LOW).waiting == 0)
+    {
+        std::this_thread::yield();
+    }
+    std::thread high(waiter, AcquirePriority::HIGH);
+    while (manager.GetWaitStatistics(AcquirePriority::HIGH).waiting == 0)
+    {
+        std::this_thread::yield();
+    }
+
+    manager.Release(resource);
+    low.join();
+    high.join();
+
+    ASSERT_EQ(2u, served.size());
+    ASSERT_EQ(AcquirePriority::HIGH, served[0]);
+    ASSERT_EQ(AcquirePriority::LOW, served[1]);
+    ASSERT_EQ(1u, manager.GetWaitStatistics(AcquirePriority::HIGH).acquireCount);
+    ASSERT_EQ(0u, manager.GetWaitStatistics(AcquirePriority::LOW).waiting);
+    manager.ShutdownAndWait(1);
+}
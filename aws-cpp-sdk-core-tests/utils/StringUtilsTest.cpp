@@ -9,6 +9,7 @@
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <climits>
+#include <cstdio>
 
 using namespace Aws::Utils;
 
@@ -491,6 +492,36 @@ TEST(StringUtilsTest, TestURLEncodeAndDecode)
     ASSERT_STREQ("IShouldNotChange", shouldBeTheSameAsEncoded.c_str());
 }
 
+TEST(StringUtilsTest, TestURLEncodeEveryByteAtEveryOffset)
+{
+    // Each byte value is placed at every position of a 16 byte chunk, so both the vectorized and the scalar encoder see it.
+    for (unsigned value = 1; value < 256; ++value)
+    {
+        for (size_t offset = 0; offset < 40; ++offset)
+        {
+            Aws::String toEncode(40, 'a');
+            toEncode[offset] = static_cast<char>(value);
+
+            Aws::String expected;
+            for (char c : toEncode)
+            {
+                if (StringUtils::IsAlnum(c) || c == '-' || c == '_' || c == '.' || c == '~')
+                {
+                    expected.push_back(c);
+                }
+                else
+                {
+                    char escaped[4];
+                    snprintf(escaped, sizeof(escaped), "%%%02X", static_cast<unsigned char>(c));
+                    expected.append(escaped);
+                }
+            }
+
+            ASSERT_EQ(expected, StringUtils::URLEncode(toEncode.c_str())) << "value " << value << " at offset " << offset;
+        }
+    }
+}
+
 TEST(StringUtilsTest, TestURLDecodeEdgeCases)
 {
     ASSERT_STREQ("me@ama%zon.com", StringUtils::URLDecode( "me%40ama%zon.com").c_str());
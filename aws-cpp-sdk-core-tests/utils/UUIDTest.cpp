@@ -6,6 +6,9 @@
 #include <aws/core/utils/UUID.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <thread>
 
 using namespace Aws::Utils;
 
@@ -31,6 +34,53 @@ TEST(UUIDTest, TestPlatformGeneratesUUID)
     }    
 }
 
+TEST(UUIDTest, TestRandomUUIDsAreUniqueAcrossThreads)
+{
+    // Each thread draws from its own buffer of random bytes, they must never hand out the same bytes.
+    static const size_t THREAD_COUNT = 4;
+    static const size_t UUIDS_PER_THREAD = 2000;
+    Aws::Vector<Aws::Vector<Aws::String>> generated(THREAD_COUNT);
+    Aws::Vector<std::thread> threads;
+    for (size_t i = 0; i < THREAD_COUNT; ++i)
+    {
+        threads.emplace_back([&generated, i]()
+        {
+            for (size_t j = 0; j < UUIDS_PER_THREAD; ++j)
+            {
+                generated[i].push_back(UUID::RandomUUID());
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    Aws::Set<Aws::String> unique;
+    for (const auto& uuids : generated)
+    {
+        unique.insert(uuids.begin(), uuids.end());
+    }
+    ASSERT_EQ(THREAD_COUNT * UUIDS_PER_THREAD, unique.size());
+}
+
+TEST(UUIDTest, TestBufferedSecureRandomBytes)
+{
+    // Sizes served from the per-thread buffer and sizes read straight from the random source.
+    for (size_t size : {1u, 16u, 64u, 65u, 1024u})
+    {
+        Aws::Vector<unsigned char> first(size, 0);
+        Aws::Vector<unsigned char> second(size, 0);
+        ASSERT_TRUE(Crypto::GetBufferedSecureRandomBytes(first.data(), size));
+        ASSERT_TRUE(Crypto::GetBufferedSecureRandomBytes(second.data(), size));
+        if (size >= 16)
+        {
+            ASSERT_NE(first, second);
+            ASSERT_NE(Aws::Vector<unsigned char>(size, 0), first);
+        }
+    }
+}
+
 TEST(UUIDTest, TestUUIDToStringConversion)
 {
     ByteBuffer rawUuuid = HashingUtils::HexDecode("f81d4fae7dec11d0a76500a0c91e6bf6");
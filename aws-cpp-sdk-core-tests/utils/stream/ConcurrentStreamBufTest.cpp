@@ -0,0 +1,108 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/stream/ConcurrentStreamBuf.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <thread>
+
+using namespace Aws::Utils::Stream;
+
+static char PatternByte(size_t i)
+{
+    return static_cast<char>((i * 31 + i / 251) & 0xff);
+}
+
+TEST(ConcurrentStreamBufTest, TestFlushedDataIsReadInOrder)
+{
+    ConcurrentStreamBuf streamBuf(16);
+    Aws::IOStream ioStream(&streamBuf);
+    ioStream.write("Hello, ", 7);
+    ioStream.flush();
+
+    char readBuf[8] = {};
+    ioStream.read(readBuf, 7);
+    ASSERT_STREQ("Hello, ", readBuf);
+
+    // The reader releases bytes to the writer when it asks for more, so only the rest of the ring is free for now.
+    ioStream.write("more data", 9);
+    ioStream.flush();
+    streamBuf.SetEof();
+
+    Aws::String rest;
+    char c;
+    while (ioStream.get(c))
+    {
+        rest.push_back(c);
+    }
+    ASSERT_STREQ("more data", rest.c_str());
+    ASSERT_TRUE(ioStream.eof());
+}
+
+TEST(ConcurrentStreamBufTest, TestConcurrentWriterAndReader)
+{
+    const size_t TOTAL_BYTES = 1024 * 1024 + 7;
+    ConcurrentStreamBuf streamBuf(4 * 1024 + 3);
+    Aws::IOStream ioStream(&streamBuf);
+
+    std::thread writer([&] {
+        Aws::Vector<char> chunk(1500);
+        size_t written = 0;
+        size_t chunkSize = 1;
+        while (written < TOTAL_BYTES)
+        {
+            const size_t length = (std::min)(chunkSize, TOTAL_BYTES - written);
+            for (size_t i = 0; i < length; ++i)
+            {
+                chunk[i] = PatternByte(written + i);
+            }
+            ioStream.write(chunk.data(), length);
+            if (chunkSize % 3 == 0)
+            {
+                ioStream.flush();
+            }
+            written += length;
+            chunkSize = (chunkSize * 7 + 97) % chunk.size() + 1;
+        }
+        ioStream.flush();
+        streamBuf.SetEof();
+    });
+
+    Aws::Vector<char> readBuf(1000);
+    size_t read = 0;
+    bool matches = true;
+    while (ioStream.read(readBuf.data(), readBuf.size()) || ioStream.gcount() > 0)
+    {
+        const size_t length = static_cast<size_t>(ioStream.gcount());
+        for (size_t i = 0; i < length; ++i)
+        {
+            matches = matches && readBuf[i] == PatternByte(read + i);
+        }
+        read += length;
+    }
+    writer.join();
+
+    ASSERT_TRUE(matches);
+    ASSERT_EQ(TOTAL_BYTES, read);
+}
+
+TEST(ConcurrentStreamBufTest, TestEofReleasesBlockedWriter)
+{
+    ConcurrentStreamBuf streamBuf(8);
+    Aws::IOStream ioStream(&streamBuf);
+
+    std::thread writer([&] {
+        // Nobody reads, so the writer blocks once the ring is full.
+        ioStream.write("0123456789abcdef", 16);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    streamBuf.SetEof();
+    writer.join();
+
+    ASSERT_TRUE(ioStream.bad());
+}
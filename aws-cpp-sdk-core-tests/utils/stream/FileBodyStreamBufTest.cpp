@@ -0,0 +1,111 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/stream/FileBodyStreamBuf.h>
+#include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+// Larger than the buffer small reads go through, so that both the direct and the buffered reads are exercised.
+static Aws::String WriteTestFile(TempFile& file)
+{
+    Aws::String contents;
+    for (size_t i = 0; i < 40000; ++i)
+    {
+        contents.push_back(static_cast<char>('a' + i % 26));
+    }
+    file << contents;
+    file.flush();
+    return contents;
+}
+
+TEST(FileBodyStreamBufTest, TestReadWholeFile)
+{
+    TempFile file(std::ios_base::out | std::ios_base::trunc);
+    const Aws::String expected = WriteTestFile(file);
+
+    FileBodyStream stream(file.GetFileName());
+    ASSERT_TRUE(stream.good());
+    ASSERT_EQ(expected.size(), stream.GetLength());
+    ASSERT_EQ(stream.rdbuf(), FileBodyStream::GetFileBodyStreamBuf(stream));
+
+    Aws::Vector<char> readBuf(expected.size() + 10);
+    stream.read(readBuf.data(), static_cast<std::streamsize>(readBuf.size()));
+    ASSERT_EQ(static_cast<std::streamsize>(expected.size()), stream.gcount());
+    ASSERT_EQ(expected, Aws::String(readBuf.data(), expected.size()));
+    ASSERT_TRUE(stream.eof());
+
+    // Byte by byte, as the stream operators do.
+    stream.clear();
+    stream.seekg(0);
+    Aws::String byteByByte;
+    char c;
+    while (stream.get(c))
+    {
+        byteByByte.push_back(c);
+    }
+    ASSERT_EQ(expected, byteByByte);
+}
+
+TEST(FileBodyStreamBufTest, TestRangeAndSeek)
+{
+    TempFile file(std::ios_base::out | std::ios_base::trunc);
+    const Aws::String contents = WriteTestFile(file);
+    const Aws::String expected = contents.substr(1000, 20000);
+
+    FileBodyStream stream(file.GetFileName(), 1000, 20000);
+    ASSERT_EQ(20000u, stream.GetLength());
+    stream.seekg(0, std::ios_base::end);
+    ASSERT_EQ(20000, static_cast<std::streamoff>(stream.tellg()));
+
+    // A small read fills the buffer, the seek back stays in it and the large read then spans the buffer and the file.
+    stream.seekg(100);
+    char small[10];
+    stream.read(small, sizeof(small));
+    ASSERT_EQ(expected.substr(100, 10), Aws::String(small, sizeof(small)));
+    stream.seekg(105);
+    Aws::Vector<char> large(15000);
+    stream.read(large.data(), static_cast<std::streamsize>(large.size()));
+    ASSERT_EQ(expected.substr(105, large.size()), Aws::String(large.data(), large.size()));
+    ASSERT_EQ(15105, static_cast<std::streamoff>(stream.tellg()));
+
+    // The range ends before the end of the file.
+    stream.seekg(19990);
+    char tail[64];
+    stream.read(tail, sizeof(tail));
+    ASSERT_EQ(10, stream.gcount());
+    ASSERT_EQ(expected.substr(19990), Aws::String(tail, 10));
+
+    stream.clear();
+    stream.seekg(20001);
+    ASSERT_TRUE(stream.fail());
+}
+
+TEST(FileBodyStreamBufTest, TestRangeIsCappedAtEndOfFile)
+{
+    TempFile file(std::ios_base::out | std::ios_base::trunc);
+    const Aws::String contents = WriteTestFile(file);
+
+    FileBodyStream stream(file.GetFileName(), contents.size() - 5);
+    ASSERT_EQ(5u, stream.GetLength());
+    FileBodyStream pastTheEnd(file.GetFileName(), contents.size() + 5);
+    ASSERT_EQ(0u, pastTheEnd.GetLength());
+}
+
+TEST(FileBodyStreamBufTest, TestMissingFile)
+{
+    FileBodyStream stream("this/file/does/not/exist");
+    ASSERT_TRUE(stream.fail());
+    ASSERT_EQ(0u, stream.GetLength());
+
+    // Other streams are not mistaken for file bodies.
+    Aws::StringStream other;
+    ASSERT_EQ(nullptr, FileBodyStream::GetFileBodyStreamBuf(other));
+}
@@ -0,0 +1,89 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/stream/SegmentedStreamBuf.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <cstring>
+
+using namespace Aws::Utils::Stream;
+
+static const char FIRST[] = "Records: [";
+static const char SECOND[] = "{\"Data\":\"AAEC\"}";
+
+static void AppendSegments(SegmentedStream& stream)
+{
+    stream.Append(reinterpret_cast<const unsigned char*>(FIRST), strlen(FIRST));
+    stream.Append(reinterpret_cast<const unsigned char*>(""), 0);
+    stream.Append(Aws::String(SECOND));
+    stream.Append(reinterpret_cast<const unsigned char*>("]"), 1);
+}
+
+TEST(SegmentedStreamBufTest, TestReadAcrossSegments)
+{
+    SegmentedStream stream;
+    AppendSegments(stream);
+    const Aws::String expected = Aws::String(FIRST) + SECOND + "]";
+    ASSERT_EQ(expected.size(), stream.GetLength());
+
+    char readBuf[64] = {};
+    stream.read(readBuf, sizeof(readBuf));
+    ASSERT_EQ(static_cast<std::streamsize>(expected.size()), stream.gcount());
+    ASSERT_STREQ(expected.c_str(), readBuf);
+    ASSERT_TRUE(stream.eof());
+
+    // Byte by byte, as the stream operators do.
+    stream.clear();
+    stream.seekg(0);
+    Aws::String byteByByte;
+    char c;
+    while (stream.get(c))
+    {
+        byteByByte.push_back(c);
+    }
+    ASSERT_STREQ(expected.c_str(), byteByByte.c_str());
+}
+
+TEST(SegmentedStreamBufTest, TestSeekAndTell)
+{
+    SegmentedStream stream;
+    AppendSegments(stream);
+    const Aws::String expected = Aws::String(FIRST) + SECOND + "]";
+
+    stream.seekg(0, std::ios_base::end);
+    ASSERT_EQ(static_cast<std::streamoff>(expected.size()), static_cast<std::streamoff>(stream.tellg()));
+
+    for (size_t position = 0; position < expected.size(); ++position)
+    {
+        stream.clear();
+        stream.seekg(static_cast<std::streamoff>(position));
+        ASSERT_EQ(static_cast<std::streamoff>(position), static_cast<std::streamoff>(stream.tellg()));
+        ASSERT_EQ(expected[position], static_cast<char>(stream.peek()));
+    }
+
+    stream.seekg(3);
+    stream.seekg(strlen(FIRST), std::ios_base::cur);
+    char readBuf[4] = {};
+    stream.read(readBuf, 3);
+    ASSERT_STREQ(expected.substr(3 + strlen(FIRST), 3).c_str(), readBuf);
+
+    stream.seekg(static_cast<std::streamoff>(expected.size() + 1));
+    ASSERT_TRUE(stream.fail());
+}
+
+TEST(SegmentedStreamBufTest, TestRecognizedOnlyWhenReadingItsOwnStreamBuf)
+{
+    SegmentedStream stream;
+    AppendSegments(stream);
+    ASSERT_NE(nullptr, SegmentedStream::GetSegmentedStreamBuf(stream));
+    ASSERT_EQ(stream.GetLength(), SegmentedStream::GetSegmentedStreamBuf(stream)->GetLength());
+
+    Aws::StringStream other;
+    ASSERT_EQ(nullptr, SegmentedStream::GetSegmentedStreamBuf(other));
+    other.copyfmt(stream);
+    ASSERT_EQ(nullptr, SegmentedStream::GetSegmentedStreamBuf(other));
+}
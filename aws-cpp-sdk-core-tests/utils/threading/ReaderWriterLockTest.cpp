@@ -6,7 +6,11 @@
 #include <aws/external/gtest.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/threading/ReaderWriterLock.h>
+#include <aws/core/utils/threading/Semaphore.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 using namespace Aws::Utils::Threading;
 
@@ -82,3 +86,46 @@ TEST(ReaderWriterLock, NoReadersMultipleWriters)
 
     ASSERT_EQ(originalLength + THREADS_NUM * ITERATIONS, resource.length());
 }
+
+TEST(ReaderWriterLock, WriterWaitsForReadersOnEveryThread)
+{
+    // More threads than reader slots, so that readers share slots too.
+    const int READER_THREADS = 130;
+    ReaderWriterLock rwlock;
+    Semaphore readersLocked(0, READER_THREADS);
+    Semaphore releaseReaders(0, READER_THREADS);
+    std::atomic<int> readersInside(0);
+    std::atomic<bool> writerEntered(false);
+    {
+        DefaultExecutor exec;
+        for(int i = 0; i < READER_THREADS; i++)
+        {
+            exec.Submit([&] {
+                rwlock.LockReader();
+                readersInside++;
+                readersLocked.Release();
+                releaseReaders.WaitOne();
+                readersInside--;
+                rwlock.UnlockReader();
+            });
+        }
+        for(int i = 0; i < READER_THREADS; i++)
+        {
+            readersLocked.WaitOne();
+        }
+
+        exec.Submit([&] {
+            WriterLockGuard guard(rwlock);
+            ASSERT_EQ(0, readersInside.load());
+            writerEntered = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ASSERT_FALSE(writerEntered.load());
+
+        releaseReaders.ReleaseAll();
+    }
+
+    ASSERT_TRUE(writerEntered.load());
+    // New readers get in once the writer is gone.
+    ReaderLockGuard guard(rwlock);
+}
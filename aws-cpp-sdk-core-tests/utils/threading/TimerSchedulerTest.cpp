@@ -0,0 +1,114 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/TimerScheduler.h>
+#include <aws/core/utils/threading/Semaphore.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+using namespace Aws::Utils::Threading;
+
+TEST(TimerScheduler, TimersFireAfterTheirDelayInOrder)
+{
+    TimerScheduler scheduler(std::chrono::milliseconds(1), 8);
+    std::mutex lock;
+    Aws::Vector<int> fired;
+    Semaphore done(0, 1);
+
+    const auto start = std::chrono::steady_clock::now();
+    // Longer than the wheel, this one has to wait for a few rotations.
+    scheduler.Schedule(std::chrono::milliseconds(30), [&] { std::lock_guard<std::mutex> locker(lock); fired.push_back(3); done.Release(); });
+    scheduler.Schedule(std::chrono::milliseconds(2), [&] { std::lock_guard<std::mutex> locker(lock); fired.push_back(1); });
+    scheduler.Schedule(std::chrono::milliseconds(10), [&] { std::lock_guard<std::mutex> locker(lock); fired.push_back(2); });
+
+    done.WaitOne();
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(30));
+    std::lock_guard<std::mutex> locker(lock);
+    ASSERT_EQ(3u, fired.size());
+    ASSERT_EQ(1, fired[0]);
+    ASSERT_EQ(2, fired[1]);
+    ASSERT_EQ(3, fired[2]);
+    ASSERT_EQ(0u, scheduler.GetPendingCount());
+}
+
+TEST(TimerScheduler, CancelledTimersDoNotFire)
+{
+    TimerScheduler scheduler(std::chrono::milliseconds(1), 8);
+    std::atomic<int> fired(0);
+    Semaphore done(0, 1);
+
+    auto cancelled = scheduler.Schedule(std::chrono::milliseconds(5), [&] { fired += 10; });
+    scheduler.Schedule(std::chrono::milliseconds(20), [&] { fired += 1; done.Release(); });
+    ASSERT_EQ(2u, scheduler.GetPendingCount());
+    ASSERT_TRUE(scheduler.Cancel(cancelled));
+    ASSERT_FALSE(scheduler.Cancel(cancelled));
+    ASSERT_EQ(1u, scheduler.GetPendingCount());
+
+    done.WaitOne();
+    ASSERT_EQ(1, fired.load());
+}
+
+TEST(TimerScheduler, TasksCanScheduleTimers)
+{
+    TimerScheduler scheduler(std::chrono::milliseconds(1), 4);
+    std::atomic<int> remaining(5);
+    Semaphore done(0, 1);
+
+    std::function<void()> tick = [&]
+    {
+        if (--remaining > 0)
+        {
+            auto next = tick;
+            scheduler.Schedule(std::chrono::milliseconds(3), std::move(next));
+        }
+        else
+        {
+            done.Release();
+        }
+    };
+    auto first = tick;
+    scheduler.Schedule(std::chrono::milliseconds(0), std::move(first));
+
+    done.WaitOne();
+    ASSERT_EQ(0, remaining.load());
+}
+
+TEST(TimerScheduler, PendingTimersAreDroppedOnDestruction)
+{
+    std::atomic<int> fired(0);
+    std::atomic<int> cancelled(0);
+    {
+        TimerScheduler scheduler;
+        scheduler.Schedule(std::chrono::hours(1), [&] { fired++; });
+        scheduler.Schedule(std::chrono::hours(1), [&] { fired++; }, [&] { cancelled++; });
+        ASSERT_EQ(2u, scheduler.GetPendingCount());
+    }
+    ASSERT_EQ(0, fired.load());
+    ASSERT_EQ(1, cancelled.load());
+}
+
+TEST(TimerScheduler, CancelRunsTheCancelCallback)
+{
+    TimerScheduler scheduler(std::chrono::milliseconds(1), 8);
+    std::atomic<int> fired(0);
+    std::atomic<int> cancelled(0);
+    Semaphore done(0, 1);
+
+    auto id = scheduler.Schedule(std::chrono::hours(1), [&] { fired++; }, [&] { cancelled++; });
+    ASSERT_TRUE(scheduler.Cancel(id));
+    ASSERT_EQ(1, cancelled.load());
+    ASSERT_FALSE(scheduler.Cancel(id));
+    ASSERT_EQ(1, cancelled.load());
+
+    // Timers that fired are not cancelled.
+    id = scheduler.Schedule(std::chrono::milliseconds(1), [&] { fired++; done.Release(); }, [&] { cancelled++; });
+    done.WaitOne();
+    ASSERT_FALSE(scheduler.Cancel(id));
+    ASSERT_EQ(1, fired.load());
+    ASSERT_EQ(1, cancelled.load());
+}
@@ -22,7 +22,7 @@ namespace Aws
     static const char AMZN_EVENTSTREAM_CONTENT_TYPE[]      = "application/vnd.amazon.eventstream";
 
     /**
-     * High-level abstraction over AWS requests. GetBody() calls SerializePayload() and uses a stringbuf under the hood.
+     * High-level abstraction over AWS requests. GetBody() calls SerializePayload() and moves the payload into a SegmentedStream.
      * This is for payloads such as query, xml, or json
      */
     class AWS_CORE_API AmazonSerializableWebServiceRequest : public AmazonWebServiceRequest
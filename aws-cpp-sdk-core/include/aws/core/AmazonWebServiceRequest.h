@@ -14,6 +14,8 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/client/RequestCompression.h>
+#include <chrono>
 
 namespace Aws
 {
@@ -97,6 +99,53 @@ namespace Aws
          * Set the response stream factory.
          */
         void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) { m_responseStreamFactory = factory; }
+        /**
+         * Retrieves the sink receiving the body of a successful response, if any.
+         */
+        const std::shared_ptr<Aws::Http::ResponseBodySink>& GetResponseBodySink() const { return m_responseBodySink; }
+        /**
+         * Set a sink receiving the body of a successful response directly (e.g. into caller owned memory), bypassing the
+         * response stream. The result's body stream is then empty. Error responses still go to the response stream.
+         */
+        void SetResponseBodySink(const std::shared_ptr<Aws::Http::ResponseBodySink>& sink) { m_responseBodySink = sink; }
+        /**
+         * Retrieves the priority the request gets a connection from the http client's pool with.
+         */
+        Aws::Utils::AcquirePriority GetRequestPriority() const { return m_requestPriority; }
+        /**
+         * Set the priority the request gets a connection from the http client's pool with. Requests of a lower priority
+         * wait while requests of a higher one are waiting, e.g. LOW keeps bulk transfers from starving other calls.
+         */
+        void SetRequestPriority(Aws::Utils::AcquirePriority priority) { m_requestPriority = priority; }
+        /**
+         * Whether the request picked its own compression algorithm, rather than using the one of the client configuration.
+         */
+        bool RequestCompressionAlgorithmHasBeenSet() const { return m_requestCompressionAlgorithmHasBeenSet; }
+        /**
+         * Retrieves the compression algorithm the request picked for its body.
+         */
+        Aws::Client::CompressionAlgorithm GetRequestCompressionAlgorithm() const { return m_requestCompressionAlgorithm; }
+        /**
+         * Compress the body of this request (if at least as large as the client's minimum compression size) with algorithm,
+         * or not at all with NONE, whatever the client configuration says. Only for operations whose service accepts a
+         * Content-Encoding, e.g. CloudWatch PutMetricData.
+         */
+        void SetRequestCompressionAlgorithm(Aws::Client::CompressionAlgorithm algorithm)
+        {
+            m_requestCompressionAlgorithm = algorithm;
+            m_requestCompressionAlgorithmHasBeenSet = true;
+        }
+        /**
+         * Retrieves the time by which the whole call must be done, steady_clock::time_point::max() when it has none.
+         */
+        std::chrono::steady_clock::time_point GetCallDeadline() const { return m_callDeadline; }
+        bool HasCallDeadline() const { return m_callDeadline != std::chrono::steady_clock::time_point::max(); }
+        /**
+         * Set a time by which the whole call, retries and backoff included, must be done. Each attempt only gets the time
+         * left (capping the client's http request and connect timeouts), no retry is made when the time left can't fit
+         * another attempt like the last one, and a call whose deadline already passed fails without being sent.
+         */
+        void SetCallDeadline(std::chrono::steady_clock::time_point deadline) { m_callDeadline = deadline; }
         /**
          * Register closure for data received event.
          */
@@ -161,6 +210,11 @@ namespace Aws
 
     private:
         Aws::IOStreamFactory m_responseStreamFactory;
+        std::shared_ptr<Aws::Http::ResponseBodySink> m_responseBodySink;
+        Aws::Utils::AcquirePriority m_requestPriority;
+        Aws::Client::CompressionAlgorithm m_requestCompressionAlgorithm;
+        bool m_requestCompressionAlgorithmHasBeenSet;
+        std::chrono::steady_clock::time_point m_callDeadline;
 
         Aws::Http::DataReceivedEventHandler m_onDataReceived;
         Aws::Http::DataSentEventHandler m_onDataSent;
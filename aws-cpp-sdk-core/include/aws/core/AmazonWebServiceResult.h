@@ -11,6 +11,11 @@
 
 namespace Aws
 {
+    namespace Monitoring
+    {
+        class RequestTiming;
+    } // namespace Monitoring
+
     /**
      * Container for web response to an AWS Request.
      */
@@ -41,13 +46,15 @@ namespace Aws
         AmazonWebServiceResult(const AmazonWebServiceResult& result) :
             m_payload(result.m_payload),
             m_responseHeaders(result.m_responseHeaders),
-            m_responseCode(result.m_responseCode)
+            m_responseCode(result.m_responseCode),
+            m_requestTiming(result.m_requestTiming)
         {}
 
         AmazonWebServiceResult(AmazonWebServiceResult&& result) :
             m_payload(std::move(result.m_payload)),
             m_responseHeaders(std::move(result.m_responseHeaders)),
-            m_responseCode(result.m_responseCode)
+            m_responseCode(result.m_responseCode),
+            m_requestTiming(std::move(result.m_requestTiming))
         {}
 
         /**
@@ -67,10 +74,18 @@ namespace Aws
         */
         inline Http::HttpResponseCode GetResponseCode() const { return m_responseCode; }
 
+        /**
+         * Per phase timing of the api call that produced this result, nullptr if not available.
+         */
+        inline const std::shared_ptr<const Monitoring::RequestTiming>& GetRequestTiming() const { return m_requestTiming; }
+
+        inline void SetRequestTiming(const std::shared_ptr<const Monitoring::RequestTiming>& requestTiming) { m_requestTiming = requestTiming; }
+
     private:
         PAYLOAD_TYPE m_payload;
         Http::HeaderValueCollection m_responseHeaders;
         Http::HttpResponseCode m_responseCode;
+        std::shared_ptr<const Monitoring::RequestTiming> m_requestTiming;
     };
 
 
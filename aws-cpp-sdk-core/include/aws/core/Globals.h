@@ -6,12 +6,18 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <memory>
 
 namespace Aws
 {
     namespace Utils
     {
         class EnumParseOverflowContainer;
+
+        namespace Threading
+        {
+            class TimerScheduler;
+        }
     }
     /**
      * This is used to handle the Enum round tripping problem
@@ -32,4 +38,22 @@ namespace Aws
      * This should only be called once from within Aws::ShutdownAPI
      */
     void CleanupEnumOverflowContainer();
+
+    /**
+     * Timer scheduler shared by all clients that don't configure their own, e.g. to delay the retries of async calls.
+     * Its thread is only started once a timer is scheduled. Returns nullptr outside of Aws::InitAPI/Aws::ShutdownAPI.
+     */
+    AWS_CORE_API std::shared_ptr<Utils::Threading::TimerScheduler> GetDefaultTimerScheduler();
+
+    /**
+     * Creates the shared timer scheduler.
+     * This should only be called once from within Aws::InitAPI
+     */
+    void InitializeDefaultTimerScheduler();
+
+    /**
+     * Releases the shared timer scheduler, it is destroyed once the last client using it is.
+     * This should only be called once from within Aws::ShutdownAPI
+     */
+    void CleanupDefaultTimerScheduler();
 }
@@ -252,6 +252,7 @@ namespace Aws
             Aws::String GenerateSignature(const Aws::Auth::AWSCredentials& credentials,
                     const Aws::String& stringToSign, const Aws::String& simpleDate) const;
             bool ShouldSignHeader(const Aws::String& header) const;
+            bool ShouldSignHeader(const char* header) const;
 
         protected:
             bool m_includeSha256HashHeader;
@@ -330,6 +331,7 @@ namespace Aws
             bool PresignRequest(Aws::Http::HttpRequest&, const char*, const char*, long long) const override { return false; }
 
             bool ShouldSignHeader(const Aws::String& header) const;
+            bool ShouldSignHeader(const char* header) const;
         private:
             Utils::ByteBuffer GenerateSignature(const Aws::Auth::AWSCredentials& credentials,
                     const Aws::String& stringToSign, const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
@@ -7,6 +7,7 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/RequestCompression.h>
 #include <aws/core/http/HttpTypes.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/AmazonWebServiceResult.h>
@@ -14,6 +15,7 @@
 #include <aws/core/auth/AWSAuthSignerProvider.h>
 #include <memory>
 #include <atomic>
+#include <functional>
 
 struct aws_array_list;
 
@@ -39,12 +41,24 @@ namespace Aws
             class RateLimiterInterface;
         } // namespace RateLimits
 
+        namespace Threading
+        {
+            class Executor;
+            class TimerScheduler;
+        } // namespace Threading
+
         namespace Crypto
         {
             class MD5;
         } // namespace Crypto
     } // namespace Utils
 
+    namespace Monitoring
+    {
+        class RequestTiming;
+        class RequestTracer;
+    } // namespace Monitoring
+
     namespace Http
     {
         class HttpClient;
@@ -75,9 +89,11 @@ namespace Aws
         class AWSAuthSigner;
         struct ClientConfiguration;
         class RetryStrategy;
+        class CircuitBreaker;
 
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
+        typedef std::function<void(HttpResponseOutcome&&)> HttpResponseOutcomeHandler;
 
         /**
          * Abstract AWS Client. Contains most of the functionality necessary to build an http request, get it signed, and send it accross the wire.
@@ -103,7 +119,10 @@ namespace Aws
                 const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
                 const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller);
 
-            virtual ~AWSClient() { };
+            /**
+             * Calls ShutdownAsyncRetries().
+             */
+            virtual ~AWSClient();
 
             /**
              * Generates a signed Uri using the injected signer. for the supplied uri and http method. expirationInSeconds defaults
@@ -173,13 +192,37 @@ namespace Aws
              * or encounters and error that is not retryable. This method is for payloadless requests e.g. GET, DELETE, HEAD
              *
              * requestName is used for metrics and defaults to empty string, to avoid empty names in metrics provide a valid
-             * name.
+             * name. callDeadline is the time by which the whole call must be done, see AmazonWebServiceRequest::SetCallDeadline,
+             * none by default.
              */
             HttpResponseOutcome AttemptExhaustively(const Aws::Http::URI& uri,
                     Http::HttpMethod httpMethod,
                     const char* signerName,
                     const char* requestName = "",
-                    const char* signerRegionOverride = nullptr) const;
+                    const char* signerRegionOverride = nullptr,
+                    std::chrono::steady_clock::time_point callDeadline = (std::chrono::steady_clock::time_point::max)()) const;
+
+            /**
+             * Same as AttemptExhaustively, but the backoff before each retry doesn't block the calling thread: the next attempt is
+             * scheduled on the retry scheduler and then submitted to the client's executor. The first attempt runs on the calling
+             * thread, handler is called with the final outcome on whichever thread made the last attempt.
+             * If the client or the retry scheduler is destroyed before a retry is due, handler is called with the last error on
+             * the executor. Handlers may therefore run while the client is being destroyed, they must not use it.
+             */
+            void AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+                    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                    Http::HttpMethod httpMethod,
+                    const char* signerName,
+                    const char* signerRegionOverride,
+                    const HttpResponseOutcomeHandler& handler) const;
+
+            /**
+             * Ends the async calls of the client: retries waiting for their backoff are cancelled and their handler is called
+             * with the last error on the executor, retries already running are waited for. Later retries are not made.
+             * Attempts call the virtual methods of the client, so clients overriding them call this from their own destructor.
+             * Must not be called from a thread of the executor, which may have to run the cancelled calls to their end.
+             */
+            void ShutdownAsyncRetries();
 
             /**
              * Build an Http Request from the AmazonWebServiceRequest object. Signs the request, sends it accross the wire
@@ -188,7 +231,8 @@ namespace Aws
             HttpResponseOutcome AttemptOneRequest(const std::shared_ptr<Http::HttpRequest>& httpRequest,
                     const Aws::AmazonWebServiceRequest& request,
                     const char* signerName,
-                    const char* signerRegionOverride = nullptr) const;
+                    const char* signerRegionOverride = nullptr,
+                    Aws::Monitoring::RequestTiming* requestTiming = nullptr) const;
 
             /**
              * Signs an Http Request, sends it accross the wire
@@ -200,7 +244,8 @@ namespace Aws
             HttpResponseOutcome AttemptOneRequest(const std::shared_ptr<Http::HttpRequest>& httpRequest,
                     const char* signerName,
                     const char* requestName = "",
-                    const char* signerRegionOverride = nullptr) const;
+                    const char* signerRegionOverride = nullptr,
+                    Aws::Monitoring::RequestTiming* requestTiming = nullptr) const;
 
             /**
              * This is used for structureless response payloads (file streams, binary data etc...). It calls AttemptExhaustively, but upon
@@ -217,13 +262,15 @@ namespace Aws
              * return transfers ownership of the underlying stream for the http response to the caller.
              *
              * requestName is used for metrics and defaults to empty string, to avoid empty names in metrics provide a valid
-             * name.
+             * name. callDeadline is the time by which the whole call must be done, see AmazonWebServiceRequest::SetCallDeadline,
+             * none by default.
              */
             StreamOutcome MakeRequestWithUnparsedResponse(const Aws::Http::URI& uri,
                     Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
                     const char* signerName = Aws::Auth::SIGV4_SIGNER,
                     const char* requestName = "",
-                    const char* signerRegionOverride = nullptr) const;
+                    const char* signerRegionOverride = nullptr,
+                    std::chrono::steady_clock::time_point callDeadline = (std::chrono::steady_clock::time_point::max)()) const;
 
             /**
              * Abstract.  Subclassing clients should override this to tell the client how to marshall error payloads
@@ -267,6 +314,33 @@ namespace Aws
             std::shared_ptr<Aws::Http::HttpResponse> MakeHttpRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const;
             Aws::String m_region;
         private:
+            struct RetryContext;
+            struct AsyncRetryContext;
+            struct AsyncRetries;
+
+            /**
+             * The steps of both AttemptExhaustively, shared with AttemptExhaustivelyAsync. Attempt runs them until the call is done.
+             * AttemptOnce sends the current http request, or refuses to. After a failure, PrepareRetry decides whether to retry
+             * and how long to wait first, then PrepareNextAttempt builds the http request of the next attempt.
+             * The request of a context is null for payloadless requests.
+             */
+            void InitRetryContext(RetryContext& context, const Aws::Http::URI& uri, const Aws::AmazonWebServiceRequest* request,
+                                  const char* requestName, Http::HttpMethod method, const char* signerRegionOverride) const;
+            HttpResponseOutcome Attempt(RetryContext& context, const Aws::Http::URI& uri, Http::HttpMethod method, const char* signerName) const;
+            void AttemptOnce(RetryContext& context, const char* signerName) const;
+            bool PrepareRetry(RetryContext& context, const char* signerName, long& sleepMillis, bool& shouldSleep) const;
+            void PrepareNextAttempt(RetryContext& context, const Aws::Http::URI& uri, Http::HttpMethod method) const;
+            void FinishAttempts(RetryContext& context) const;
+            /**
+             * ContinueAttemptsAsync returns true once the call is done and its outcome is ready for the handler, false if its
+             * next attempt was scheduled. ResumeAttemptsAsync makes that attempt, or only ends the call if resume is false.
+             */
+            bool ContinueAttemptsAsync(const std::shared_ptr<AsyncRetryContext>& context) const;
+            bool ScheduleRetry(const std::shared_ptr<AsyncRetryContext>& context, long sleepMillis) const;
+            void ResumeAttemptsAsync(const std::shared_ptr<AsyncRetries>& asyncRetries, const std::shared_ptr<AsyncRetryContext>& context,
+                                     bool resume) const;
+            static Aws::IOStreamFactory GetResponseStreamFactory(const RetryContext& context);
+
             /**
              * Try to adjust signer's clock
              * return true if signer's clock is adjusted, false otherwise.
@@ -276,6 +350,12 @@ namespace Aws
             void AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const std::shared_ptr<Aws::IOStream>& body,
                                          bool needsContentMd5 = false, bool isChunked = false) const;
             void AddCommonHeaders(Aws::Http::HttpRequest& httpRequest) const;
+            /**
+             * Returns the body compressed with the algorithm picked by the request or the configuration, or body itself if
+             * it's not to be compressed. Retries reuse the body compressed by the previous attempt of the call.
+             */
+            std::shared_ptr<Aws::IOStream> CompressRequestBody(const Aws::AmazonWebServiceRequest& request, Aws::Http::HttpRequest& httpRequest,
+                                                               const std::shared_ptr<Aws::IOStream>& body) const;
             void InitializeGlobalStatics();
             std::shared_ptr<Aws::Http::HttpRequest> ConvertToRequestForPresigning(const Aws::AmazonWebServiceRequest& request, Aws::Http::URI& uri,
                 Aws::Http::HttpMethod method, const Aws::Http::QueryStringParameterCollection& extraParams) const;
@@ -290,9 +370,18 @@ namespace Aws
             std::shared_ptr<Aws::Utils::Crypto::Hash> m_hash;
             long m_requestTimeoutMs;
             bool m_enableClockSkewAdjustment;
+            std::shared_ptr<Aws::Monitoring::RequestTracer> m_requestTracer;
+            bool m_enableRequestTiming;
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
+            std::shared_ptr<Aws::Utils::Threading::TimerScheduler> m_retryScheduler;
+            std::shared_ptr<AsyncRetries> m_asyncRetries;
+            std::shared_ptr<CircuitBreaker> m_circuitBreaker;
+            CompressionAlgorithm m_requestCompressionAlgorithm;
+            size_t m_requestMinCompressionSizeBytes;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonValue>, AWSError<CoreErrors>> JsonOutcome;
+        typedef std::function<void(JsonOutcome&&)> JsonOutcomeHandler;
         AWS_CORE_API Aws::String GetAuthorizationHeader(const Aws::Http::HttpRequest& httpRequest);
 
         /**
@@ -318,7 +407,7 @@ namespace Aws
                     const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
                     const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller);
 
-            virtual ~AWSJsonClient() = default;
+            virtual ~AWSJsonClient() { ShutdownAsyncRetries(); }
 
         protected:
             /**
@@ -343,7 +432,8 @@ namespace Aws
              * then just calls AttemptExhaustively.
              *
              * requestName is used for metrics and defaults to empty string, to avoid empty names in metrics provide a valid
-             * name.
+             * name. callDeadline is the time by which the whole call must be done, see AmazonWebServiceRequest::SetCallDeadline,
+             * none by default.
              *
              * method defaults to POST
              */
@@ -351,12 +441,24 @@ namespace Aws
                 Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
                 const char* signerName = Aws::Auth::SIGV4_SIGNER,
                 const char* requestName = "",
-                const char* signerRegionOverride = nullptr) const;
+                const char* signerRegionOverride = nullptr,
+                std::chrono::steady_clock::time_point callDeadline = (std::chrono::steady_clock::time_point::max)()) const;
+
+            /**
+             * Same as MakeRequest, but retries don't block a thread during their backoff, see AttemptExhaustivelyAsync.
+             */
+            void MakeRequestAsync(const Aws::Http::URI& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                Http::HttpMethod method,
+                const char* signerName,
+                const char* signerRegionOverride,
+                const JsonOutcomeHandler& handler) const;
 
             JsonOutcome MakeEventStreamRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Xml::XmlDocument>, AWSError<CoreErrors>> XmlOutcome;
+        typedef std::function<void(XmlOutcome&&)> XmlOutcomeHandler;
 
         /**
         *  AWSClient that handles marshalling xml response bodies. You would inherit from this class
@@ -376,7 +478,7 @@ namespace Aws
                 const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
                 const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller);
 
-            virtual ~AWSXMLClient() = default;
+            virtual ~AWSXMLClient() { ShutdownAsyncRetries(); }
 
         protected:
             /**
@@ -402,7 +504,8 @@ namespace Aws
              * then just calls AttemptExhaustively.
              *
              * requestName is used for metrics and defaults to empty string, to avoid empty names in metrics provide a valid
-             * name.
+             * name. callDeadline is the time by which the whole call must be done, see AmazonWebServiceRequest::SetCallDeadline,
+             * none by default.
              *
              * method defaults to POST
              */
@@ -410,7 +513,18 @@ namespace Aws
                 Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
                 const char* signerName = Aws::Auth::SIGV4_SIGNER,
                 const char* requestName = "",
-                const char* signerRegionOverride = nullptr) const;
+                const char* signerRegionOverride = nullptr,
+                std::chrono::steady_clock::time_point callDeadline = (std::chrono::steady_clock::time_point::max)()) const;
+
+            /**
+             * Same as MakeRequest, but retries don't block a thread during their backoff, see AttemptExhaustivelyAsync.
+             */
+            void MakeRequestAsync(const Aws::Http::URI& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                Http::HttpMethod method,
+                const char* signerName,
+                const char* signerRegionOverride,
+                const XmlOutcomeHandler& handler) const;
 
             /**
             * This is used for event stream response.
@@ -424,13 +538,21 @@ namespace Aws
             /**
             * This is used for event stream response.
             * requestName is used for metrics and defaults to empty string, to avoid empty names in metrics provide a valid
-            * name.
+            * name. callDeadline is the time by which the whole call must be done, see AmazonWebServiceRequest::SetCallDeadline,
+            * none by default.
             */
             XmlOutcome MakeRequestWithEventStream(const Aws::Http::URI& uri,
                 Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
                 const char* signerName = Aws::Auth::SIGV4_SIGNER,
                 const char* requestName = "",
-                const char* signerRegionOverride = nullptr) const;
+                const char* signerRegionOverride = nullptr,
+                std::chrono::steady_clock::time_point callDeadline = (std::chrono::steady_clock::time_point::max)()) const;
+
+        private:
+            /**
+             * Parses the body of a successful response into an xml document.
+             */
+            static XmlOutcome ToXmlOutcome(HttpResponseOutcome&& httpOutcome);
         };
 
     } // namespace Client
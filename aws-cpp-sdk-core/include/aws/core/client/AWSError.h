@@ -14,6 +14,11 @@
 
 namespace Aws
 {
+    namespace Monitoring
+    {
+        class RequestTiming;
+    } // namespace Monitoring
+
     namespace Client
     {
         enum class CoreErrors;
@@ -65,7 +70,8 @@ namespace Aws
                 m_message(std::move(rhs.m_message)), m_remoteHostIpAddress(std::move(rhs.m_remoteHostIpAddress)),
                 m_requestId(std::move(rhs.m_requestId)), m_responseHeaders(std::move(rhs.m_responseHeaders)),
                 m_responseCode(rhs.m_responseCode), m_isRetryable(rhs.m_isRetryable), m_errorPayloadType(rhs.m_errorPayloadType),
-                m_xmlPayload(std::move(rhs.m_xmlPayload)), m_jsonPayload(std::move(rhs.m_jsonPayload))
+                m_xmlPayload(std::move(rhs.m_xmlPayload)), m_jsonPayload(std::move(rhs.m_jsonPayload)),
+                m_requestTiming(std::move(rhs.m_requestTiming))
             {}
 
             template<typename OTHER_ERROR_TYPE>
@@ -74,7 +80,8 @@ namespace Aws
                 m_message(rhs.m_message), m_remoteHostIpAddress(rhs.m_remoteHostIpAddress), m_requestId(rhs.m_requestId),
                 m_responseHeaders(rhs.m_responseHeaders), m_responseCode(rhs.m_responseCode),
                 m_isRetryable(rhs.m_isRetryable), m_errorPayloadType(rhs.m_errorPayloadType),
-                m_xmlPayload(rhs.m_xmlPayload), m_jsonPayload(rhs.m_jsonPayload)
+                m_xmlPayload(rhs.m_xmlPayload), m_jsonPayload(rhs.m_jsonPayload),
+                m_requestTiming(rhs.m_requestTiming)
             {}
 
             /**
@@ -151,6 +158,14 @@ namespace Aws
              * Sets the response code from the http response
              */
             inline void SetResponseCode(Aws::Http::HttpResponseCode responseCode) { m_responseCode = responseCode; }
+            /**
+             * Gets the per phase timing of the api call that failed, nullptr if the error was not returned by an api call.
+             */
+            inline const std::shared_ptr<const Aws::Monitoring::RequestTiming>& GetRequestTiming() const { return m_requestTiming; }
+            /**
+             * Sets the per phase timing of the api call that failed.
+             */
+            inline void SetRequestTiming(const std::shared_ptr<const Aws::Monitoring::RequestTiming>& requestTiming) { m_requestTiming = requestTiming; }
 
         protected:
             inline ErrorPayloadType GetErrorPayloadType() { return m_errorPayloadType; }
@@ -197,6 +212,7 @@ namespace Aws
             ErrorPayloadType m_errorPayloadType;
             Aws::Utils::Xml::XmlDocument m_xmlPayload;
             Aws::Utils::Json::JsonValue m_jsonPayload;
+            std::shared_ptr<const Aws::Monitoring::RequestTiming> m_requestTiming;
         };
 
         template<typename T>
@@ -0,0 +1,132 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <chrono>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Client
+    {
+        enum class CoreErrors;
+        template<typename ERROR_TYPE>
+        class AWSError;
+
+        enum class CircuitState
+        {
+            CLOSED = 0,     // requests go through
+            OPEN = 1,       // requests fail without being sent
+            HALF_OPEN = 2   // a few probe requests go through to find out whether the endpoint recovered
+        };
+
+        AWS_CORE_API const char* GetNameForCircuitState(CircuitState state);
+
+        struct AWS_CORE_API CircuitBreakerConfiguration
+        {
+            CircuitBreakerConfiguration();
+
+            /**
+             * Rate of failed attempts within a window that opens the circuit. Default 0.5.
+             */
+            double failureRateThreshold;
+            /**
+             * Attempts a window needs before its failure rate is considered, so that a couple of errors on a quiet circuit
+             * don't open it. Default 20.
+             */
+            unsigned minimumAttempts;
+            /**
+             * Length of the window attempts are counted over, counts start from zero with each window. Default 10 seconds.
+             */
+            std::chrono::milliseconds window;
+            /**
+             * How long an open circuit fails requests before letting probes through. Default 5 seconds.
+             */
+            std::chrono::milliseconds openDuration;
+            /**
+             * Probes let through at once by a half open circuit. Default 1.
+             */
+            unsigned halfOpenProbes;
+            /**
+             * Whether each operation of an endpoint gets its own circuit, or all of them share the endpoint's. Default true.
+             */
+            bool perOperation;
+        };
+
+        /**
+         * Fails the calls to a degraded endpoint fast instead of letting each of them walk the whole retry ladder. Attempts are
+         * counted per circuit, an endpoint or an endpoint and operation. When the failure rate of a circuit reaches the threshold
+         * the circuit opens: attempts fail without being sent and no retry is made. Once the open duration elapsed the circuit is
+         * half open and lets a few probes through, the first one to succeed closes it and the first one to fail opens it again.
+         * State changes are reported to the monitoring instances through MonitoringInterface::OnCircuitStateChanged.
+         * Set it in ClientConfiguration::circuitBreaker. A circuit breaker can be shared by clients.
+         */
+        class AWS_CORE_API CircuitBreaker
+        {
+        public:
+            CircuitBreaker(const CircuitBreakerConfiguration& configuration = CircuitBreakerConfiguration());
+            virtual ~CircuitBreaker() = default;
+
+            /**
+             * Name of the circuit attempts of requestName to endpoint are counted in.
+             */
+            Aws::String GetCircuitName(const Aws::String& endpoint, const Aws::String& requestName) const;
+
+            /**
+             * Returns false if the attempt must not be sent. Every attempt allowed must be followed by OnAttemptFinished, or
+             * by OnAttemptAbandoned if it has no outcome to count.
+             */
+            bool AllowAttempt(const Aws::String& serviceName, const Aws::String& circuitName);
+
+            /**
+             * Counts the outcome of an attempt allowed by AllowAttempt.
+             */
+            void OnAttemptFinished(const Aws::String& serviceName, const Aws::String& circuitName, bool failed);
+
+            /**
+             * Gives back the probe slot an attempt allowed by AllowAttempt took in a half open circuit, without counting it.
+             */
+            void OnAttemptAbandoned(const Aws::String& circuitName);
+
+            /**
+             * Returns the state of the circuit, CLOSED for one no attempt was made in yet.
+             */
+            CircuitState GetState(const Aws::String& circuitName) const;
+
+            /**
+             * Whether an attempt ending with error counts as failed: errors that can be retried (throttling, timeouts,
+             * connection failures) and server errors do, errors in the request itself don't.
+             */
+            virtual bool IsFailure(const AWSError<CoreErrors>& error) const;
+
+        protected:
+            /**
+             * Current time, replaceable by tests.
+             */
+            virtual std::chrono::steady_clock::time_point Now() const { return std::chrono::steady_clock::now(); }
+
+        private:
+            struct Circuit
+            {
+                Circuit() : state(CircuitState::CLOSED), attempts(0), failures(0), probesInFlight(0) {}
+
+                CircuitState state;
+                std::chrono::steady_clock::time_point windowStart;
+                std::chrono::steady_clock::time_point openedAt;
+                unsigned attempts;
+                unsigned failures;
+                unsigned probesInFlight;
+            };
+
+            CircuitBreakerConfiguration m_configuration;
+            mutable std::mutex m_circuitsLock;
+            Aws::Map<Aws::String, Circuit> m_circuits;
+        };
+    } // namespace Client
+} // namespace Aws
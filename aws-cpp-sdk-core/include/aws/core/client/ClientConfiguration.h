@@ -6,6 +6,7 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/RequestCompression.h>
 #include <aws/core/http/Scheme.h>
 #include <aws/core/Region.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -19,6 +20,7 @@ namespace Aws
         namespace Threading
         {
             class Executor;
+            class TimerScheduler;
         } // namespace Threading
 
         namespace RateLimits
@@ -26,9 +28,19 @@ namespace Aws
             class RateLimiterInterface;
         } // namespace RateLimits
     } // namespace Utils
+    namespace Monitoring
+    {
+        class RequestTracer;
+    } // namespace Monitoring
+    namespace Http
+    {
+        class HttpClient;
+        class CachingDnsResolver;
+    } // namespace Http
     namespace Client
     {
         class RetryStrategy; // forward declare
+        class CircuitBreaker;
 
         /**
          * Sets the behaviors of the underlying HTTP clients handling response with 30x status code.
@@ -77,6 +89,26 @@ namespace Aws
              * Max concurrent tcp connections for a single http client to use. Default 25.
              */
             unsigned maxConnections;
+            /**
+             * Max concurrent requests a single http client sends to any one endpoint (scheme, host and port), the others wait
+             * for one to complete. Default 0, no limit other than maxConnections. This is currently only applicable for Curl.
+             */
+            unsigned maxConnectionsPerEndpoint;
+            /**
+             * Pooled connections left unused for longer than this are closed by a background reaper, so the pool shrinks
+             * back after a burst. Default 0, idle connections are kept. This is currently only applicable for Curl.
+             */
+            unsigned long connectionMaxIdleMs;
+            /**
+             * Connections older than this are closed when they are next returned to the pool or found idle in it, e.g. to
+             * pick up DNS changes of an endpoint. Default 0, no limit. This is currently only applicable for Curl.
+             */
+            unsigned long connectionMaxLifetimeMs;
+            /**
+             * How long a request waits for a connection from the pool before failing with a retryable network error.
+             * Default 0, wait until one is available. This is currently only applicable for Curl.
+             */
+            unsigned long connectionAcquireTimeoutMs;
             /**
              * This is currently only applicable for Curl to set the http request level timeout, including possible dns lookup time, connection establish time, ssl handshake time and actual data transmission time.
              * the corresponding Curl option is CURLOPT_TIMEOUT_MS
@@ -197,6 +229,13 @@ namespace Aws
              * Override the http implementation the default factory returns.
              */
             Aws::Http::TransferLibType httpLibOverride;
+            /**
+             * Http client to send the requests with instead of creating one from this configuration. Share one between many
+             * service clients to share its connection pool: maxConnections then caps the connections of all of them together.
+             * The timeouts, proxy and TLS settings are those the http client was created with. Default is nullptr.
+             * Note that DisableRequestProcessing() on any of the service clients stops the requests of all of them.
+             */
+            std::shared_ptr<Aws::Http::HttpClient> httpClient;
             /**
              * Sets the behavior how http stack handles 30x redirect codes.
              */
@@ -213,6 +252,33 @@ namespace Aws
              */
             bool disableExpectHeader;
 
+            /**
+             * Content coding applied to request bodies of at least requestMinCompressionSizeBytes, e.g. GZIP for CloudWatch
+             * PutMetricData. Requests can override it with AmazonWebServiceRequest::SetRequestCompressionAlgorithm(). Streaming
+             * requests (e.g. uploads) are only compressed when they ask for it themselves, since the service would store the
+             * compressed bytes. Needs zlib, bodies go uncompressed in builds without it. Default NONE.
+             */
+            CompressionAlgorithm requestCompressionAlgorithm;
+
+            /**
+             * Smaller request bodies aren't worth compressing. Default 10240 bytes.
+             */
+            size_t requestMinCompressionSizeBytes;
+
+            /**
+             * Ask for gzip or deflate encoded responses and decompress them while they're received, the response body stream
+             * then holds the decoded bytes. Default false: objects stored with a Content-Encoding of their own (e.g. in S3)
+             * would be decoded too, breaking their checksums. This is currently only applicable for Curl.
+             */
+            bool enableResponseDecompression;
+
+            /**
+             * Resolves the hosts of new connections and spreads them over all the addresses of a host, e.g.
+             * Aws::MakeShared<Aws::Http::CachingDnsResolver>(tag). Can be shared by clients. Default is nullptr, each
+             * connection then resolves its host itself. Ignored when a proxy is used. This is currently only applicable for Curl.
+             */
+            std::shared_ptr<Aws::Http::CachingDnsResolver> dnsResolver;
+
             /**
              * If set to true clock skew will be adjusted after each http attempt, default to true.
              */
@@ -239,6 +305,30 @@ namespace Aws
              */
             Aws::String profileName;
 
+            /**
+             * Receives the phases (serialization, signing, connection acquisition, network, parsing, retry delay) of every api call
+             * made by the client as tracing spans. Default is nullptr. Setting it also attaches the timings to outcomes.
+             */
+            std::shared_ptr<Aws::Monitoring::RequestTracer> requestTracer;
+
+            /**
+             * If set to true, the phases of every api call are timed and attached to its outcome, see
+             * AmazonWebServiceResult::GetRequestTiming() and AWSError::GetRequestTiming(). Default to false.
+             */
+            bool enableRequestTiming;
+
+            /**
+             * Delays the retries of asynchronous calls, which are then resubmitted to the executor instead of keeping one of
+             * its threads asleep during the backoff. Default is nullptr, the scheduler shared by all clients is then used.
+             */
+            std::shared_ptr<Aws::Utils::Threading::TimerScheduler> retryScheduler;
+
+            /**
+             * Fails the attempts to endpoints whose failure rate is too high without sending them, and stops retrying them.
+             * Default is nullptr, every attempt is then sent. See CircuitBreaker.
+             */
+            std::shared_ptr<CircuitBreaker> circuitBreaker;
+
         };
 
     } // namespace Client
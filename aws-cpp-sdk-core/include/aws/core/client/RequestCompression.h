@@ -0,0 +1,52 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <memory>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Content coding applied to request bodies before they're signed and sent.
+         */
+        enum class CompressionAlgorithm
+        {
+            NONE,
+            GZIP,
+            // zlib format, the "deflate" content coding of RFC 9110.
+            DEFLATE
+        };
+
+        namespace RequestCompression
+        {
+            /**
+             * Value of the Content-Encoding header for the algorithm, nullptr for NONE.
+             */
+            AWS_CORE_API const char* GetContentEncoding(CompressionAlgorithm algorithm);
+
+            /**
+             * Whether this build can compress with the algorithm. Compression needs zlib, which isn't linked on every platform.
+             */
+            AWS_CORE_API bool IsSupported(CompressionAlgorithm algorithm);
+
+            /**
+             * Compresses body from its current position to its end. Returns nullptr if the algorithm isn't supported or
+             * compression fails, the body should then be sent as it is.
+             */
+            AWS_CORE_API std::shared_ptr<Aws::IOStream> Compress(Aws::IOStream& body, CompressionAlgorithm algorithm);
+
+            /**
+             * Inverse of Compress(), for http clients without decompression of their own. Returns nullptr on failure.
+             */
+            AWS_CORE_API std::shared_ptr<Aws::IOStream> Decompress(Aws::IOStream& body, CompressionAlgorithm algorithm);
+        } // namespace RequestCompression
+    } // namespace Client
+} // namespace Aws
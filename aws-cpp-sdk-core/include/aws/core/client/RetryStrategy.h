@@ -113,6 +113,11 @@ namespace Aws
 
             virtual long GetMaxAttempts() const override { return m_maxAttempts; }
 
+            /**
+             * Gets the container of retry quotas this strategy acquires from and releases to.
+             */
+            inline const std::shared_ptr<RetryQuotaContainer>& GetRetryQuotaContainer() const { return m_retryQuotaContainer; }
+
         protected:
             std::shared_ptr<RetryQuotaContainer> m_retryQuotaContainer;
             long m_maxAttempts;
@@ -0,0 +1,101 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
+    } // namespace Utils
+
+    namespace Http
+    {
+        /**
+         * How CachingDnsResolver spreads new connections over the addresses of a host.
+         */
+        enum class AddressSelectionPolicy
+        {
+            // Each address in turn.
+            ROUND_ROBIN,
+            // The address with the fewest connections acquired and not yet released, in turn among equals.
+            LEAST_LOADED
+        };
+
+        /**
+         * Resolves hosts once for all the connections of an http client (or several) and spreads those connections over
+         * all the addresses a host resolves to, where each connection would otherwise stick to the first one its own lookup
+         * returned. S3 for instance answers with several front-ends.
+         *
+         * Addresses are cached for a TTL. Past it, the cached addresses are still handed out while a lookup refreshes them
+         * on the executor, so requests don't wait for DNS unless a host is seen for the first time.
+         */
+        class AWS_CORE_API CachingDnsResolver
+        {
+        public:
+            /**
+             * Returns the addresses of a host, empty if it can't be resolved.
+             */
+            typedef std::function<Aws::Vector<Aws::String>(const Aws::String& host)> LookupFunction;
+
+            /**
+             * @param ttl how long addresses are used before they're looked up again.
+             * @param lookup the system resolver by default, tests can pass a stub.
+             * @param refreshExecutor runs the refreshes of expired entries. With nullptr, the request that finds the entry
+             * expired does the lookup itself.
+             */
+            CachingDnsResolver(std::chrono::milliseconds ttl = std::chrono::seconds(60),
+                               AddressSelectionPolicy policy = AddressSelectionPolicy::ROUND_ROBIN,
+                               const LookupFunction& lookup = nullptr,
+                               const std::shared_ptr<Aws::Utils::Threading::Executor>& refreshExecutor = nullptr);
+
+            CachingDnsResolver(const CachingDnsResolver&) = delete;
+            CachingDnsResolver& operator=(const CachingDnsResolver&) = delete;
+
+            /**
+             * Picks the address of host a new connection should go to, resolving host if it isn't cached yet. Every address
+             * acquired must be given back with ReleaseAddress() once its request is done.
+             *
+             * @return the address, or an empty string if host can't be resolved.
+             */
+            Aws::String AcquireAddress(const Aws::String& host);
+
+            /**
+             * Counts one connection to address less.
+             */
+            void ReleaseAddress(const Aws::String& host, const Aws::String& address);
+
+            /**
+             * Stops handing out address, e.g. after a connection to it failed, until the next lookup of host returns it again.
+             */
+            void RemoveAddress(const Aws::String& host, const Aws::String& address);
+
+            /**
+             * The addresses of host currently cached.
+             */
+            Aws::Vector<Aws::String> GetCachedAddresses(const Aws::String& host) const;
+
+        private:
+            struct Cache;
+            static void Refresh(const std::shared_ptr<Cache>& cache, const Aws::String& host);
+
+            // Shared with the refreshes in flight, which may outlive the resolver.
+            std::shared_ptr<Cache> m_cache;
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_refreshExecutor;
+        };
+    } // namespace Http
+} // namespace Aws
@@ -0,0 +1,81 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Header store of the standard http request and response: a vector of headers sorted by their lower case name, in the
+         * same order as a HeaderValueCollection. Names are looked up case-insensitively without lowercasing a copy first, and
+         * well-known names (host, content-length, x-amz-date...) are interned rather than allocated for every request.
+         */
+        class AWS_CORE_API CompactHeaderCollection
+        {
+        public:
+            class Entry
+            {
+            public:
+                /**
+                 * The lower case name of the header.
+                 */
+                const char* GetName() const { return m_wellKnownName ? m_wellKnownName : m_name.c_str(); }
+                const Aws::String& GetValue() const { return m_value; }
+
+            private:
+                friend class CompactHeaderCollection;
+
+                Entry() : m_wellKnownName(nullptr) {}
+
+                const char* m_wellKnownName; // interned, nullptr for other names
+                Aws::String m_name; // empty for well-known names
+                Aws::String m_value;
+            };
+
+            typedef Aws::Vector<Entry>::const_iterator const_iterator;
+
+            /**
+             * Adds the header, or replaces the value of the header with the same name in any case.
+             */
+            void Set(const char* name, Aws::String&& value);
+            void Set(const char* name, const Aws::String& value) { Set(name, Aws::String(value)); }
+
+            /**
+             * Returns the value of the header named name in any case, nullptr if there is none.
+             */
+            const Aws::String* Find(const char* name) const;
+
+            bool Has(const char* name) const { return Find(name) != nullptr; }
+
+            /**
+             * Removes the header named name in any case. Returns false if there was none.
+             */
+            bool Erase(const char* name);
+
+            size_t size() const { return m_entries.size(); }
+            bool empty() const { return m_entries.empty(); }
+            const_iterator begin() const { return m_entries.begin(); }
+            const_iterator end() const { return m_entries.end(); }
+
+            /**
+             * Copies the headers into a map, for the interfaces that hand headers out by value.
+             */
+            HeaderValueCollection ToHeaderValueCollection() const;
+
+        private:
+            // Index of the first entry whose name is not less than name, and whether it is name.
+            size_t LowerBound(const char* name, bool& found) const;
+
+            Aws::Vector<Entry> m_entries;
+        };
+    } // namespace Http
+} // namespace Aws
@@ -0,0 +1,92 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/ResourceManager.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Http
+    {
+        class URI;
+
+        /**
+         * Caps the number of requests an http client has in flight to any single endpoint (scheme, host and port), so that
+         * one busy endpoint can't take every connection of a pool shared by many service clients. Like the connection pool,
+         * it lets requests of a higher priority through ahead of the ones of a lower priority waiting for the same endpoint.
+         */
+        class AWS_CORE_API EndpointConnectionLimiter
+        {
+        public:
+            /**
+             * 0 means no limit, Acquire() then never blocks.
+             */
+            explicit EndpointConnectionLimiter(unsigned maxConnectionsPerEndpoint);
+
+            EndpointConnectionLimiter(const EndpointConnectionLimiter&) = delete;
+            EndpointConnectionLimiter& operator=(const EndpointConnectionLimiter&) = delete;
+
+            /**
+             * Blocks until the endpoint has fewer than the maximum number of requests in flight and no request of a higher
+             * priority waits for it, then counts one more. Returns false, without counting it, if that takes longer than
+             * timeout. A timeout of 0 waits as long as it takes.
+             */
+            bool Acquire(const Aws::String& endpoint, Aws::Utils::AcquirePriority priority = Aws::Utils::AcquirePriority::NORMAL,
+                std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+            /**
+             * Counts one request to the endpoint less, and wakes up a request waiting for it.
+             */
+            void Release(const Aws::String& endpoint);
+
+            /**
+             * Number of requests to the endpoint currently in flight.
+             */
+            unsigned GetActiveConnections(const Aws::String& endpoint) const;
+
+            unsigned GetMaxConnectionsPerEndpoint() const { return m_maxConnectionsPerEndpoint; }
+
+            /**
+             * The key requests to uri are counted under.
+             */
+            static Aws::String GetEndpointKey(const URI& uri);
+
+        private:
+            struct EndpointConnections
+            {
+                EndpointConnections() : active(0), waiting() {}
+
+                bool HasWaiters(size_t lanes = Aws::Utils::ACQUIRE_PRIORITY_COUNT) const
+                {
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                    {
+                        if (waiting[lane] > 0)
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                unsigned active;
+                // Per priority lane.
+                unsigned waiting[Aws::Utils::ACQUIRE_PRIORITY_COUNT];
+            };
+
+            unsigned m_maxConnectionsPerEndpoint;
+            Aws::UnorderedMap<Aws::String, EndpointConnections> m_endpoints;
+            mutable std::mutex m_lock;
+            std::condition_variable m_signal;
+        };
+    } // namespace Http
+} // namespace Aws
@@ -7,6 +7,9 @@
 
 #include <aws/core/Core_EXPORTS.h>
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <atomic>
 #include <mutex>
@@ -20,12 +23,39 @@ namespace Aws
         {
             class RateLimiterInterface;
         } // namespace RateLimits
+
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
     } // namespace Utils
 
     namespace Http
     {
         class HttpRequest;
         class HttpResponse;
+        class URI;
+
+        /**
+         * Snapshot of the connection pool of an http client.
+         */
+        struct ConnectionPoolMetrics
+        {
+            ConnectionPoolMetrics() : poolSize(0), inUse(0), acquireCount(0), acquireTimeoutCount(0), totalAcquireWait(0), maxAcquireWait(0),
+                idleConnectionsClosed(0), expiredConnectionsClosed(0) {}
+
+            // Connections currently open, in use or not.
+            size_t poolSize;
+            size_t inUse;
+            uint64_t acquireCount;
+            // Requests that gave up waiting for a connection.
+            uint64_t acquireTimeoutCount;
+            // Time requests spent waiting for a connection, since the pool was created.
+            std::chrono::microseconds totalAcquireWait;
+            std::chrono::microseconds maxAcquireWait;
+            uint64_t idleConnectionsClosed;
+            uint64_t expiredConnectionsClosed;
+        };
 
         /**
           * Abstract HttpClient. All it does is make HttpRequests and return their response.
@@ -48,6 +78,26 @@ namespace Aws
              */
             virtual bool SupportsChunkedTransferEncoding() const { return true; }
 
+            /**
+             * Opens up to connectionCount connections to the endpoint of uri ahead of time, so that the first requests after a
+             * start or a scale out don't all pay for DNS resolution, TCP and TLS setup. Sends that many HEAD requests to uri
+             * concurrently, no more than GetMaxConnections(), and blocks until they're done. The requests run on executor,
+             * typically ClientConfiguration::executor, or on a thread each if it's null. Don't call it from a task of executor.
+             * Returns the number of requests that got a response.
+             */
+            virtual size_t PrewarmConnections(const URI& uri, unsigned connectionCount,
+                const std::shared_ptr<Aws::Utils::Threading::Executor>& executor = nullptr) const;
+
+            /**
+             * Connections the http client keeps open at most, 0 for http clients that don't manage a pool.
+             */
+            virtual unsigned GetMaxConnections() const { return 0; }
+
+            /**
+             * Metrics of the connection pool, all zero for http clients that don't manage one.
+             */
+            virtual ConnectionPoolMetrics GetConnectionPoolMetrics() const { return ConnectionPoolMetrics(); }
+
             /**
              * Stops all requests in progress and prevents any others from initiating.
              */
@@ -9,10 +9,13 @@
 
 #include <aws/core/http/URI.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/ResponseBodySink.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/ResourceManager.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/monitoring/HttpClientMetrics.h>
+#include <chrono>
 #include <memory>
 #include <functional>
 
@@ -31,6 +34,7 @@ namespace Aws
         extern AWS_CORE_API const char COOKIE_HEADER[];
         extern AWS_CORE_API const char CONTENT_LENGTH_HEADER[];
         extern AWS_CORE_API const char CONTENT_TYPE_HEADER[];
+        extern AWS_CORE_API const char CONTENT_ENCODING_HEADER[];
         extern AWS_CORE_API const char TRANSFER_ENCODING_HEADER[];
         extern AWS_CORE_API const char USER_AGENT_HEADER[];
         extern AWS_CORE_API const char VIA_HEADER[];
@@ -69,7 +73,8 @@ namespace Aws
              * Initializes an HttpRequest object with uri and http method.
              */
             HttpRequest(const URI& uri, HttpMethod method) :
-                m_uri(uri), m_method(method)
+                m_uri(uri), m_method(method), m_requestPriority(Aws::Utils::AcquirePriority::NORMAL),
+                m_deadline(std::chrono::steady_clock::time_point::max())
             {}
 
             virtual ~HttpRequest() {}
@@ -78,6 +83,17 @@ namespace Aws
              * Get All headers for this request.
              */
             virtual HeaderValueCollection GetHeaders() const = 0;
+            /**
+             * Calls visitor with each header of this request. Unlike GetHeaders(), the default StandardHttpRequest implementation
+             * does not copy the headers.
+             */
+            virtual void ForEachHeader(const HeaderVisitor& visitor) const
+            {
+                for (const auto& header : GetHeaders())
+                {
+                    visitor(header.first.c_str(), header.second);
+                }
+            }
             /**
              * Get the value for a Header based on its name. (in default StandardHttpRequest implementation, an empty string will be returned if headerName doesn't exist)
              */
@@ -479,6 +495,35 @@ namespace Aws
 
             inline const ContinueRequestHandler& GetContinueRequestHandler() const { return m_continueRequest; }
 
+            /**
+             * Sets the sink receiving the body of a successful response instead of the response stream.
+             */
+            inline void SetResponseBodySink(const std::shared_ptr<ResponseBodySink>& sink) { m_responseBodySink = sink; }
+            /**
+             * Gets the sink receiving the body of a successful response, nullptr when it goes to the response stream.
+             */
+            inline const std::shared_ptr<ResponseBodySink>& GetResponseBodySink() const { return m_responseBodySink; }
+
+            /**
+             * Sets the priority this request gets a connection from a shared pool with, e.g. LOW for bulk transfers.
+             */
+            inline void SetRequestPriority(Aws::Utils::AcquirePriority priority) { m_requestPriority = priority; }
+            /**
+             * Gets the priority this request gets a connection from a shared pool with.
+             */
+            inline Aws::Utils::AcquirePriority GetRequestPriority() const { return m_requestPriority; }
+
+            /**
+             * Sets the time by which the call this request is an attempt of must be done. The http client gives the attempt no
+             * more than the time left, whatever its configured timeouts.
+             */
+            inline void SetDeadline(std::chrono::steady_clock::time_point deadline) { m_deadline = deadline; }
+            /**
+             * Gets the deadline of the call, steady_clock::time_point::max() when it has none.
+             */
+            inline std::chrono::steady_clock::time_point GetDeadline() const { return m_deadline; }
+            inline bool HasDeadline() const { return m_deadline != std::chrono::steady_clock::time_point::max(); }
+
             /**
              * Gets the AWS Access Key if this HttpRequest is signed with Aws Access Key
              */
@@ -529,6 +574,9 @@ namespace Aws
             DataReceivedEventHandler m_onDataReceived;
             DataSentEventHandler m_onDataSent;
             ContinueRequestHandler m_continueRequest;
+            std::shared_ptr<ResponseBodySink> m_responseBodySink;
+            Aws::Utils::AcquirePriority m_requestPriority;
+            std::chrono::steady_clock::time_point m_deadline;
             Aws::String m_signingRegion;
             Aws::String m_signingAccessKey;
             Aws::String m_resolvedRemoteHost;
@@ -21,6 +21,10 @@ namespace Aws
             class ResponseStream;
         }
     }
+    namespace Monitoring
+    {
+        class RequestTiming;
+    }
     namespace Http
     {
         /**
@@ -156,6 +160,17 @@ namespace Aws
              * Get the headers from this response
              */
             virtual HeaderValueCollection GetHeaders() const = 0;
+            /**
+             * Calls visitor with each header of this response. Unlike GetHeaders(), the default StandardHttpResponse implementation
+             * does not copy the headers.
+             */
+            virtual void ForEachHeader(const HeaderVisitor& visitor) const
+            {
+                for (const auto& header : GetHeaders())
+                {
+                    visitor(header.first.c_str(), header.second);
+                }
+            }
             /**
              * Returns true if the response contains a header by headerName
              */
@@ -201,6 +216,12 @@ namespace Aws
             inline const Aws::String &GetClientErrorMessage() const { return m_clientErrorMessage; }
             inline void SetClientErrorMessage(const Aws::String &error) { m_clientErrorMessage = error; }
 
+            /**
+             * Per phase timing of the api call this response completes, set by the AWSClient once it stops retrying.
+             */
+            inline const std::shared_ptr<Aws::Monitoring::RequestTiming>& GetRequestTiming() const { return m_requestTiming; }
+            inline void SetRequestTiming(const std::shared_ptr<Aws::Monitoring::RequestTiming>& requestTiming) { m_requestTiming = requestTiming; }
+
         private:
             HttpResponse(const HttpResponse&);
             HttpResponse& operator = (const HttpResponse&);
@@ -211,6 +232,7 @@ namespace Aws
             bool m_hasClientError;
             Aws::Client::CoreErrors m_clientErrorType;
             Aws::String m_clientErrorMessage;
+            std::shared_ptr<Aws::Monitoring::RequestTiming> m_requestTiming;
         };
 
     } // namespace Http
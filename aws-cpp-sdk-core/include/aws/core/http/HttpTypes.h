@@ -11,6 +11,7 @@
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 
+#include <functional>
 #include <memory>
 
 namespace Aws
@@ -51,6 +52,10 @@ namespace Aws
 
         typedef std::pair<Aws::String, Aws::String> HeaderValuePair;
         typedef Aws::Map<Aws::String, Aws::String> HeaderValueCollection;
+        /**
+         * Called with the name and the value of each header, in the order of a HeaderValueCollection.
+         */
+        typedef std::function<void(const char*, const Aws::String&)> HeaderVisitor;
 
     } // namespace Http
 } // namespace Aws
@@ -0,0 +1,80 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <cstddef>
+#include <functional>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Receives the body of a successful (2xx) response in place of the response stream, so that it can land
+         * directly in caller owned memory without going through iostreams. Error responses are still written to the
+         * response stream, where the error marshallers read them; the result's body stream stays empty otherwise.
+         * A request may be sent several times (retries): Reset() is called before the first bytes of every attempt.
+         */
+        class AWS_CORE_API ResponseBodySink
+        {
+        public:
+            virtual ~ResponseBodySink() = default;
+
+            /**
+             * Called before the first bytes of each attempt, discards whatever a previous attempt wrote.
+             */
+            virtual void Reset() = 0;
+
+            /**
+             * Consumes the next length bytes of the body. Returning false aborts the transfer.
+             */
+            virtual bool Write(const char* data, size_t length) = 0;
+        };
+
+        /**
+         * Hands every chunk of the body to a callback, as the HTTP client receives it.
+         */
+        class AWS_CORE_API CallbackResponseBodySink : public ResponseBodySink
+        {
+        public:
+            typedef std::function<bool(const char* data, size_t length)> WriteCallback;
+            typedef std::function<void()> ResetCallback;
+
+            explicit CallbackResponseBodySink(const WriteCallback& onWrite, const ResetCallback& onReset = nullptr);
+
+            void Reset() override;
+            bool Write(const char* data, size_t length) override;
+
+        private:
+            WriteCallback m_onWrite;
+            ResetCallback m_onReset;
+        };
+
+        /**
+         * Copies the body into a caller owned buffer of known length, e.g. for ranged reads. This class never takes
+         * ownership of the buffer. A body longer than the buffer aborts the transfer.
+         */
+        class AWS_CORE_API BufferResponseBodySink : public ResponseBodySink
+        {
+        public:
+            BufferResponseBodySink(unsigned char* buffer, size_t capacity);
+
+            void Reset() override { m_bytesWritten = 0; }
+            bool Write(const char* data, size_t length) override;
+
+            /**
+             * Number of bytes of the body written to the buffer so far.
+             */
+            size_t GetBytesWritten() const { return m_bytesWritten; }
+
+        private:
+            unsigned char* m_buffer;
+            size_t m_capacity;
+            size_t m_bytesWritten;
+        };
+    } // namespace Http
+} // namespace Aws
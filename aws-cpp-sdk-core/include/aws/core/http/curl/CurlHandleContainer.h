@@ -5,8 +5,13 @@
 
 #pragma once
 
+#include <aws/core/http/HttpClient.h>
 #include <aws/core/utils/ResourceManager.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <thread>
 #include <utility>
 #include <curl/curl.h>
 
@@ -15,11 +20,25 @@ namespace Aws
 namespace Http
 {
 
+/**
+  * Why CurlHandleContainer::AcquireCurlHandle() returned no handle.
+  */
+enum class CurlHandleAcquireFailure
+{
+    NONE,
+    // The acquire timeout passed before a handle was released.
+    TIMED_OUT,
+    // The pool is empty and curl_easy_init failed, no handle would ever be released.
+    CREATION_FAILED
+};
+
 /**
   * Simple Connection pool manager for Curl. It maintains connections in a thread safe manner. You
   * can call into acquire a handle, then put it back when finished. It is assumed that reusing an already
   * initialized handle is preferable (especially for synchronous clients). The pool doubles in capacity as
   * needed up to the maximum amount of connections.
+  * Handles unused for longer than the max idle time are closed by a background reaper thread, and handles older than the
+  * max lifetime are replaced with fresh ones, so that the pool doesn't keep stale connections around.
   */
 class CurlHandleContainer
 {
@@ -27,15 +46,25 @@ public:
     /**
       * Initializes an empty stack of CURL handles. If you are only making synchronous calls via your http client
       * then a small size is best. For async support, a good value would be 6 * number of Processors.   *
+      * A maxIdleTimeMs or maxLifetimeMs of 0 means no limit, the reaper thread only runs if either is set. An acquireTimeoutMs
+      * of 0 makes AcquireCurlHandle() wait until a handle is available.
       */
     CurlHandleContainer(unsigned maxSize = 50, long httpRequestTimeout = 0, long connectTimeout = 1000, bool tcpKeepAlive = true,
-                        unsigned long tcpKeepAliveIntervalMs = 30000, long lowSpeedTime = 3000, unsigned long lowSpeedLimit = 1);
+                        unsigned long tcpKeepAliveIntervalMs = 30000, long lowSpeedTime = 3000, unsigned long lowSpeedLimit = 1,
+                        unsigned long maxIdleTimeMs = 0, unsigned long maxLifetimeMs = 0, unsigned long acquireTimeoutMs = 0);
     ~CurlHandleContainer();
 
     /**
-      * Blocks until a curl handle from the pool is available for use.
+      * Blocks until a curl handle from the pool is available for use. Callers of a higher priority get handles first.
+      * Returns nullptr if the acquire timeout passes first, or if no handle can be created.
+      */
+    CURL* AcquireCurlHandle(Aws::Utils::AcquirePriority priority = Aws::Utils::AcquirePriority::NORMAL);
+    /**
+      * Like AcquireCurlHandle(priority), with acquireTimeout instead of the one of the container. 0 waits as long as it takes.
+      * When it returns nullptr, failure, if set, tells why.
       */
-    CURL* AcquireCurlHandle();
+    CURL* AcquireCurlHandle(Aws::Utils::AcquirePriority priority, std::chrono::milliseconds acquireTimeout,
+                            CurlHandleAcquireFailure* failure = nullptr);
     /**
       * Returns a handle to the pool for reuse. It is imperative that this is called
       * after you are finished with the handle.
@@ -47,14 +76,51 @@ public:
      */
     void DestroyCurlHandle(CURL* handle);
 
+    /**
+     * Pool size, handles in use, the time spent waiting in AcquireCurlHandle() and the handles closed by age.
+     */
+    ConnectionPoolMetrics GetMetrics() const;
+
+    /**
+     * Histogram of the time AcquireCurlHandle() waited for a handle, for one priority.
+     */
+    Aws::Utils::ResourceWaitStatistics GetWaitStatistics(Aws::Utils::AcquirePriority priority) { return m_handleContainer.GetWaitStatistics(priority); }
+
+    /**
+     * Total and connect timeouts set on the handles, in milliseconds. 0 means none.
+     */
+    unsigned long GetHttpRequestTimeout() const { return m_httpRequestTimeout; }
+    unsigned long GetConnectTimeout() const { return m_connectTimeout; }
+
+    /**
+     * Handles, and so connections, the pool holds at most.
+     */
+    unsigned GetMaxPoolSize() const { return m_maxPoolSize; }
+
+    /**
+     * How long AcquireCurlHandle() waits for a handle at most, 0 means as long as it takes.
+     */
+    std::chrono::milliseconds GetAcquireTimeout() const { return m_acquireTimeout; }
+
 private:
     CurlHandleContainer(const CurlHandleContainer&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&) = delete;
     CurlHandleContainer(const CurlHandleContainer&&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&&) = delete;
 
+    struct HandleTimes
+    {
+        std::chrono::steady_clock::time_point created;
+        std::chrono::steady_clock::time_point released;
+    };
+
     bool CheckAndGrowPool();
     void SetDefaultOptionsOnHandle(CURL* handle);
+    // Must be called with m_containerLock held.
+    CURL* CreateCurlHandle();
+    bool IsExpired(const HandleTimes& times, std::chrono::steady_clock::time_point now) const;
+    void ReapConnections();
+    void ReaperLoop();
 
     Aws::Utils::ExclusiveOwnershipResourceManager<CURL*> m_handleContainer;
     unsigned m_maxPoolSize;
@@ -65,7 +131,23 @@ private:
     unsigned long m_lowSpeedTime;
     unsigned long m_lowSpeedLimit;
     unsigned m_poolSize;
-    std::mutex m_containerLock;
+    std::chrono::milliseconds m_maxIdleTime;
+    std::chrono::milliseconds m_maxLifetime;
+    std::chrono::milliseconds m_acquireTimeout;
+    Aws::UnorderedMap<CURL*, HandleTimes> m_handleTimes;
+    unsigned m_inUse;
+    uint64_t m_acquireCount;
+    uint64_t m_acquireTimeoutCount;
+    std::chrono::microseconds m_totalAcquireWait;
+    std::chrono::microseconds m_maxAcquireWait;
+    uint64_t m_idleConnectionsClosed;
+    uint64_t m_expiredConnectionsClosed;
+    mutable std::mutex m_containerLock;
+
+    std::thread m_reaper;
+    std::mutex m_reaperLock;
+    std::condition_variable m_reaperSignal;
+    bool m_stopReaper;
 };
 
 } // namespace Http
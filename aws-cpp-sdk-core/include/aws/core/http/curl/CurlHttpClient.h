@@ -9,6 +9,8 @@
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/curl/CurlHandleContainer.h>
+#include <aws/core/http/CachingDnsResolver.h>
+#include <aws/core/http/EndpointConnectionLimiter.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <atomic>
@@ -37,6 +39,10 @@ public:
         Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
         Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
 
+    ConnectionPoolMetrics GetConnectionPoolMetrics() const override { return m_curlHandleContainer.GetMetrics(); }
+
+    unsigned GetMaxConnections() const override { return m_curlHandleContainer.GetMaxPoolSize(); }
+
     static void InitGlobalState();
     static void CleanupGlobalState();
 
@@ -49,6 +55,7 @@ protected:
 
 private:
     mutable CurlHandleContainer m_curlHandleContainer;
+    mutable EndpointConnectionLimiter m_endpointLimiter;
     bool m_isUsingProxy;
     Aws::String m_proxyUserName;
     Aws::String m_proxyPassword;
@@ -64,6 +71,8 @@ private:
     Aws::String m_caPath;
     Aws::String m_caFile;
     bool m_disableExpectHeader;
+    bool m_enableResponseDecompression;
+    std::shared_ptr<CachingDnsResolver> m_dnsResolver;
     bool m_allowRedirects;
     static std::atomic<bool> isInit;
 };
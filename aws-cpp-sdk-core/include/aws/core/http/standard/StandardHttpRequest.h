@@ -7,6 +7,7 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/CompactHeaderCollection.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -32,6 +33,10 @@ namespace Aws
                  * Get All headers for this request.
                  */
                 virtual HeaderValueCollection GetHeaders() const override;
+                /**
+                 * Calls visitor with each header, without copying them.
+                 */
+                virtual void ForEachHeader(const HeaderVisitor& visitor) const override;
                 /**
                  * Get the value for a Header based on its name.
                  * This function doesn't check the existence of headerName.
@@ -76,7 +81,7 @@ namespace Aws
                 virtual void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) override;
 
             private:
-                HeaderValueCollection headerMap;
+                CompactHeaderCollection headerMap;
                 std::shared_ptr<Aws::IOStream> bodyStream;
                 Aws::IOStreamFactory m_responseStreamFactory;
                 Aws::String m_emptyHeader;
@@ -8,6 +8,7 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/CompactHeaderCollection.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -38,6 +39,10 @@ namespace Aws
                  * Get the headers from this response
                  */
                 HeaderValueCollection GetHeaders() const;
+                /**
+                 * Calls visitor with each header, without copying them.
+                 */
+                void ForEachHeader(const HeaderVisitor& visitor) const;
                 /**
                  * Returns true if the response contains a header by headerName
                  */
@@ -63,7 +68,8 @@ namespace Aws
             private:
                 StandardHttpResponse(const StandardHttpResponse&);
 
-                Aws::Map<Aws::String, Aws::String> headerMap;
+                CompactHeaderCollection headerMap;
+                Aws::String m_emptyHeader;
                 Utils::Stream::ResponseStream bodyStream;
             };
 
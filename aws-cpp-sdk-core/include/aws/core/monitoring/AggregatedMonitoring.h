@@ -0,0 +1,113 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/monitoring/MonitoringInterface.h>
+#include <aws/core/monitoring/MonitoringFactory.h>
+#include <aws/core/net/SimpleUDP.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/ReaderWriterLock.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        struct AggregatedOperationMetrics;
+
+        /**
+         * Monitoring implementation that aggregates metrics in process instead of exporting every api call and attempt.
+         * For each service and operation it keeps lock-free histograms of api call latency, attempt latency, DNS, connect and TLS latencies
+         * and attempts per api call, plus retry and failure counters. Every flush interval, a background thread drains them and sends
+         * one summary datagram per active service and operation, all of them in a single batch.
+         */
+        class AWS_CORE_API AggregatedMonitoring : public MonitoringInterface
+        {
+        public:
+            const static int AGGREGATED_MONITORING_VERSION;
+            const static int64_t DEFAULT_FLUSH_INTERVAL_MS;
+
+            /**
+             * @brief Construct an aggregated monitoring instance
+             * @param clientId, used to identify the application
+             * @param host, either the host name or the host ip address (could be ipv4 or ipv6).
+             * @param port, used to send summaries to a local agent listen on this port.
+             * @param flushIntervalMs, the interval between two flushes. If zero or negative, no background thread is started and summaries are only sent on Flush() and on destruction.
+             */
+            AggregatedMonitoring(const Aws::String& clientId, const Aws::String& host, unsigned short port, int64_t flushIntervalMs = DEFAULT_FLUSH_INTERVAL_MS);
+
+            ~AggregatedMonitoring();
+
+            void* OnRequestStarted(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request) const override;
+
+            void OnRequestSucceeded(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
+                const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const override;
+
+            void OnRequestFailed(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
+                const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const override;
+
+            void OnRequestRetry(const Aws::String& serviceName, const Aws::String& requestName,
+                const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const override;
+
+            void OnFinish(const Aws::String& serviceName, const Aws::String& requestName,
+                const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const override;
+
+            /**
+             * Drains the metrics aggregated since the last flush and renders them as compact json summaries, one per service and operation
+             * that saw at least one api call or attempt.
+             */
+            Aws::Vector<Aws::String> CollectSummaries() const;
+
+            /**
+             * Collects summaries and sends them to the configured host and port in a single batch.
+             */
+            void Flush() const;
+
+            static inline int GetVersion() { return AGGREGATED_MONITORING_VERSION; }
+
+        private:
+            AggregatedOperationMetrics* GetOperationMetrics(const Aws::String& serviceName, const Aws::String& requestName) const;
+            void RecordAttempt(const CoreMetricsCollection& metricsFromCore, bool succeeded, void* context) const;
+            void FlushLoop();
+
+            Aws::Net::SimpleUDP m_udp;
+            Aws::String m_clientId;
+            int64_t m_flushIntervalMs;
+            mutable std::atomic<int64_t> m_lastFlushMs;
+
+            mutable Aws::Utils::Threading::ReaderWriterLock m_metricsLock;
+            mutable Aws::Map<Aws::String, Aws::UniquePtr<AggregatedOperationMetrics>> m_metrics;
+
+            std::mutex m_flushMutex;
+            std::condition_variable m_flushSignal;
+            bool m_stopFlushing;
+            std::thread m_flushThread;
+        };
+
+        class AWS_CORE_API AggregatedMonitoringFactory : public MonitoringFactory
+        {
+        public:
+            /**
+             * @param clientId, host, port and flushIntervalMs are passed to every AggregatedMonitoring instance created.
+             */
+            AggregatedMonitoringFactory(const Aws::String& clientId = "", const Aws::String& host = "127.0.0.1", unsigned short port = 31000,
+                int64_t flushIntervalMs = AggregatedMonitoring::DEFAULT_FLUSH_INTERVAL_MS);
+
+            Aws::UniquePtr<MonitoringInterface> CreateMonitoringInstance() const override;
+
+        private:
+            Aws::String m_clientId;
+            Aws::String m_host;
+            unsigned short m_port;
+            int64_t m_flushIntervalMs;
+        };
+    } // namespace Monitoring
+} // namespace Aws
@@ -0,0 +1,141 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        /**
+         * Immutable copy of the content of a Histogram at a point in time.
+         */
+        class AWS_CORE_API HistogramSnapshot
+        {
+        public:
+            HistogramSnapshot();
+
+            /**
+             * Number of samples recorded.
+             */
+            inline uint64_t GetCount() const { return m_count; }
+
+            /**
+             * Sum of all samples recorded.
+             */
+            inline int64_t GetSum() const { return m_sum; }
+
+            /**
+             * Smallest sample recorded, 0 if no sample was recorded.
+             */
+            inline int64_t GetMin() const { return m_count ? m_min : 0; }
+
+            /**
+             * Largest sample recorded, 0 if no sample was recorded.
+             */
+            inline int64_t GetMax() const { return m_max; }
+
+            /**
+             * Arithmetic mean of all samples recorded, 0 if no sample was recorded.
+             */
+            double GetMean() const;
+
+            /**
+             * Returns the value below which the given percentage (0.0 - 100.0) of samples fall.
+             * The value returned is the upper bound of the bucket holding that sample, clamped to the recorded maximum.
+             */
+            int64_t GetValueAtPercentile(double percentile) const;
+
+            /**
+             * Returns the number of samples whose value is less than or equal to the given value.
+             * Samples are counted at bucket granularity, so the result is exact only at bucket boundaries.
+             */
+            uint64_t GetCountAtOrBelow(int64_t value) const;
+
+            /**
+             * Per bucket sample counts, index with Histogram::GetBucketIndex().
+             */
+            inline const Aws::Vector<uint64_t>& GetBucketCounts() const { return m_buckets; }
+
+            /**
+             * Merges the content of another snapshot into this one.
+             */
+            void Merge(const HistogramSnapshot& other);
+
+        private:
+            friend class Histogram;
+
+            Aws::Vector<uint64_t> m_buckets;
+            uint64_t m_count;
+            int64_t m_sum;
+            int64_t m_min;
+            int64_t m_max;
+        };
+
+        /**
+         * Fixed memory, lock-free histogram of non-negative integer samples (e.g. latencies in milliseconds).
+         * Buckets are log-linear in the style of HdrHistogram: values below 64 are tracked exactly, above that every power of two
+         * range is split into 32 equal buckets, which bounds the relative error of any reported value to about 3%.
+         * Values larger than GetHighestTrackableValue() are recorded in the last bucket, negative values are recorded as 0.
+         * Record() is wait-free and may be called concurrently from any number of threads.
+         */
+        class AWS_CORE_API Histogram
+        {
+        public:
+            static const int SUB_BUCKET_BITS = 5;
+            static const int64_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+            static const int HIGHEST_TRACKABLE_BITS = 32;
+            static const size_t BUCKET_COUNT = static_cast<size_t>((HIGHEST_TRACKABLE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT);
+
+            Histogram();
+
+            Histogram(const Histogram&) = delete;
+            Histogram& operator=(const Histogram&) = delete;
+
+            /**
+             * Records a single sample.
+             */
+            void Record(int64_t value);
+
+            /**
+             * Copies the current content of the histogram, leaving it untouched.
+             */
+            HistogramSnapshot GetSnapshot() const;
+
+            /**
+             * Copies the current content of the histogram and resets it, so that the next snapshot only covers samples recorded from now on.
+             * Samples recorded concurrently with this call end up in either this snapshot or the next one, they are never lost nor counted twice.
+             */
+            HistogramSnapshot Drain();
+
+            static inline int64_t GetHighestTrackableValue() { return (static_cast<int64_t>(1) << HIGHEST_TRACKABLE_BITS) - 1; }
+
+            /**
+             * Index of the bucket a value is recorded in.
+             */
+            static size_t GetBucketIndex(int64_t value);
+
+            /**
+             * Smallest value recorded in the bucket at index.
+             */
+            static int64_t GetBucketLowerBound(size_t index);
+
+            /**
+             * Largest value recorded in the bucket at index.
+             */
+            static int64_t GetBucketUpperBound(size_t index);
+
+        private:
+            std::atomic<uint64_t> m_buckets[BUCKET_COUNT];
+            std::atomic<int64_t> m_sum;
+            std::atomic<int64_t> m_min;
+            std::atomic<int64_t> m_max;
+        };
+    } // namespace Monitoring
+} // namespace Aws
@@ -66,9 +66,29 @@ namespace Aws
             /**
              * Requires the SDK to have access to how long it took to perform the SSL handshake for a secure request,
              * contains the time (in milliseconds) it took to perform a SSL handshake over the established TCP/IP connection.
+             * The curl client reports the time from the start of the request until the handshake completed, which includes DNS
+             * lookup and TCP connection, see TlsHandshakeLatency for the handshake alone.
              */
             SslLatency,
 
+            /**
+             * Requires the SDK to have access to when the request transfer started and when the first byte of the response was received,
+             * contains the time (in milliseconds) between the two, covering the upload of the request and the processing by the service.
+             */
+            TimeToFirstByteLatency,
+
+            /**
+             * Requires the SDK to have access to when the first and the last bytes of the response were received,
+             * contains the time (in milliseconds) it took to receive the response after its first byte.
+             */
+            ResponseTransferLatency,
+
+            /**
+             * Requires the SDK to have access to when the TCP/IP connection was established and when the SSL handshake completed,
+             * contains the time (in milliseconds) between the two, the handshake alone.
+             */
+            TlsHandshakeLatency,
+
             /**
              * Unknow Metrics Type
              */
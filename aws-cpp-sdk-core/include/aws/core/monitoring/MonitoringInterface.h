@@ -9,6 +9,7 @@
 #include <aws/core/http/HttpResponse.h>
 #include <aws/core/client/AWSError.h>
 #include <aws/core/client/AWSClient.h>
+#include <aws/core/client/CircuitBreaker.h>
 #include <aws/core/monitoring/CoreMetrics.h>
 
 namespace Aws
@@ -84,6 +85,16 @@ namespace Aws
              */
             virtual void OnFinish(const Aws::String& serviceName, const Aws::String& requestName,
                 const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const = 0;
+
+            /**
+             * @brief Once a circuit of a CircuitBreaker changed state, this function will be called. Does nothing by default.
+             * @param serviceName, the service client whose attempt changed the state of the circuit. like "s3", "ec2", etc.
+             * @param circuitName, the circuit, an endpoint or an endpoint and operation, see CircuitBreaker::GetCircuitName().
+             * @param state, the new state of the circuit.
+             * @return void.
+             */
+            virtual void OnCircuitStateChanged(const Aws::String& /* serviceName */, const Aws::String& /* circuitName */,
+                Aws::Client::CircuitState /* state */) const {}
         };
     } // namespace Monitoring
 } // namespace Aws
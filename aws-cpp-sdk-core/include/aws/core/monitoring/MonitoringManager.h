@@ -9,6 +9,7 @@
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/client/AWSClient.h>
+#include <aws/core/client/CircuitBreaker.h>
 #include <aws/core/monitoring/CoreMetrics.h>
 
 namespace Aws
@@ -46,6 +47,11 @@ namespace Aws
         void OnFinish(const Aws::String& serviceName, const Aws::String& requestName,
             const std::shared_ptr<const Aws::Http::HttpRequest>& request, const Aws::Vector<void*>& contexts);
 
+        /**
+         * Wrapper function of OnCircuitStateChanged defined by all monitoring instances
+         */
+        void OnCircuitStateChanged(const Aws::String& serviceName, const Aws::String& circuitName, Aws::Client::CircuitState state);
+
         typedef std::function<Aws::UniquePtr<MonitoringFactory>()> MonitoringFactoryCreateFunction;
 
         /**
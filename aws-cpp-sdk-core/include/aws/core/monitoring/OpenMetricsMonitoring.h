@@ -0,0 +1,188 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/client/CircuitBreaker.h>
+#include <aws/core/monitoring/MonitoringInterface.h>
+#include <aws/core/monitoring/MonitoringFactory.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/ReaderWriterLock.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace Aws
+{
+    namespace Client
+    {
+        class RetryQuotaContainer;
+    }
+
+    namespace Net
+    {
+        class SimpleHttpListener;
+    }
+
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class PooledThreadExecutor;
+        }
+    }
+
+    namespace Monitoring
+    {
+        struct OpenMetricsOperation;
+
+        /**
+         * Process wide store of SDK client metrics, rendered in OpenMetrics (Prometheus) text exposition format.
+         * Per service and operation it keeps counters of api calls, failed api calls, attempts, throttled attempts and retries,
+         * the number of api calls in flight, and histograms of api call latency and of the time spent waiting for a pooled connection.
+         * Gauges sampled at render time (retry quota left, executor queue depth, or anything else) can be added next to them.
+         * The text is available through Render(), or over http from an optional listener bound to the loopback interface.
+         */
+        class AWS_CORE_API OpenMetricsRegistry
+        {
+        public:
+            /**
+             * Content type of the text returned by Render().
+             */
+            static const char CONTENT_TYPE[];
+
+            OpenMetricsRegistry();
+            ~OpenMetricsRegistry();
+
+            OpenMetricsRegistry(const OpenMetricsRegistry&) = delete;
+            OpenMetricsRegistry& operator=(const OpenMetricsRegistry&) = delete;
+
+            /**
+             * @brief Adds a gauge sampled every time metrics are rendered.
+             * @param name, name of the metric family, gauges sharing a name must differ by their labels.
+             * @param help, description of the metric family, only the one given first for a name is kept.
+             * @param labels, label names and values identifying this gauge within its family.
+             * @param valueProvider, called at render time, it must not call back into this registry. A NaN value omits the sample.
+             */
+            void AddGauge(const Aws::String& name, const Aws::String& help, const Aws::Map<Aws::String, Aws::String>& labels,
+                const std::function<double()>& valueProvider);
+
+            /**
+             * Adds gauge aws_sdk_retry_quota_available{client="clientName"}, e.g. for StandardRetryStrategy::GetRetryQuotaContainer().
+             * Only a weak reference to the container is kept.
+             */
+            void AddRetryQuotaGauge(const Aws::String& clientName, const std::shared_ptr<Aws::Client::RetryQuotaContainer>& retryQuotaContainer);
+
+            /**
+             * Adds gauge aws_sdk_executor_queue_depth{executor="executorName"}. Only a weak reference to the executor is kept.
+             */
+            void AddExecutorQueueDepthGauge(const Aws::String& executorName, const std::shared_ptr<Aws::Utils::Threading::PooledThreadExecutor>& executor);
+
+            /**
+             * Sets gauge aws_sdk_circuit_state{service="serviceName",circuit="circuitName"}: 0 closed, 1 open, 2 half open.
+             * OpenMetricsMonitoring calls it on every state change of a CircuitBreaker circuit.
+             */
+            void SetCircuitState(const Aws::String& serviceName, const Aws::String& circuitName, Aws::Client::CircuitState state);
+
+            /**
+             * Renders every metric in OpenMetrics text format, terminated by "# EOF".
+             */
+            Aws::String Render() const;
+
+            /**
+             * @brief Serves Render() over http on 127.0.0.1:port, from a background thread.
+             * @param port, the port to listen on, 0 to let the system pick a free one (see GetListenerPort()).
+             * @return false if the listener is already running, the port could not be bound or the platform is not supported.
+             */
+            bool StartListener(unsigned short port = 0);
+
+            void StopListener();
+
+            /**
+             * The port the listener is bound to, 0 if it is not running.
+             */
+            unsigned short GetListenerPort() const;
+
+            /**
+             * Gets, creating it on first use, the metrics of an operation. The pointer stays valid for the lifetime of the registry.
+             */
+            OpenMetricsOperation* GetOperation(const Aws::String& serviceName, const Aws::String& requestName);
+
+        private:
+            struct Gauge
+            {
+                Aws::String labels;
+                std::function<double()> valueProvider;
+            };
+
+            struct GaugeFamily
+            {
+                Aws::String help;
+                Aws::Vector<Gauge> gauges;
+            };
+
+            mutable Aws::Utils::Threading::ReaderWriterLock m_operationsLock;
+            Aws::Map<std::pair<Aws::String, Aws::String>, Aws::UniquePtr<OpenMetricsOperation>> m_operations;
+
+            mutable std::mutex m_gaugesLock;
+            Aws::Map<Aws::String, GaugeFamily> m_gauges;
+            Aws::Map<Aws::String, std::shared_ptr<std::atomic<int>>> m_circuitStates;
+
+            mutable std::mutex m_listenerLock;
+            Aws::UniquePtr<Aws::Net::SimpleHttpListener> m_listener;
+        };
+
+        /**
+         * Monitoring implementation feeding an OpenMetricsRegistry.
+         */
+        class AWS_CORE_API OpenMetricsMonitoring : public MonitoringInterface
+        {
+        public:
+            OpenMetricsMonitoring(const std::shared_ptr<OpenMetricsRegistry>& registry);
+
+            void* OnRequestStarted(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request) const override;
+
+            void OnRequestSucceeded(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
+                const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const override;
+
+            void OnRequestFailed(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
+                const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const override;
+
+            void OnRequestRetry(const Aws::String& serviceName, const Aws::String& requestName,
+                const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const override;
+
+            void OnFinish(const Aws::String& serviceName, const Aws::String& requestName,
+                const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const override;
+
+            void OnCircuitStateChanged(const Aws::String& serviceName, const Aws::String& circuitName, Aws::Client::CircuitState state) const override;
+
+        private:
+            void RecordAttempt(const CoreMetricsCollection& metricsFromCore, void* context) const;
+
+            std::shared_ptr<OpenMetricsRegistry> m_registry;
+        };
+
+        /**
+         * Creates OpenMetricsMonitoring instances that all feed the same registry, e.g.
+         *   auto registry = Aws::MakeShared<OpenMetricsRegistry>(tag);
+         *   options.monitoringOptions.customizedMonitoringFactory_create_fn.push_back([registry]() {
+         *       return Aws::MakeUnique<OpenMetricsMonitoringFactory>(tag, registry); });
+         */
+        class AWS_CORE_API OpenMetricsMonitoringFactory : public MonitoringFactory
+        {
+        public:
+            OpenMetricsMonitoringFactory(const std::shared_ptr<OpenMetricsRegistry>& registry);
+
+            Aws::UniquePtr<MonitoringInterface> CreateMonitoringInstance() const override;
+
+        private:
+            std::shared_ptr<OpenMetricsRegistry> m_registry;
+        };
+    } // namespace Monitoring
+} // namespace Aws
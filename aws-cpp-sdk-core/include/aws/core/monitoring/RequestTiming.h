@@ -0,0 +1,154 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <chrono>
+#include <memory>
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        /**
+         * Phases an api call goes through. Apart from ResponseParsing and RetryDelay, every phase happens once per attempt.
+         */
+        enum class RequestPhase
+        {
+            /**
+             * Building the http request from the request object, including the serialization of its payload.
+             */
+            Serialization,
+            Signing,
+            /**
+             * Waiting for a connection from the http client pool.
+             */
+            ConnectionAcquisition,
+            DnsLookup,
+            TcpConnect,
+            TlsHandshake,
+            /**
+             * From the start of the request transfer to the first byte of the response: request upload plus server processing.
+             */
+            TimeToFirstByte,
+            /**
+             * Transfer of the response body.
+             */
+            ResponseTransfer,
+            /**
+             * Unmarshalling of the response or error payload.
+             */
+            ResponseParsing,
+            /**
+             * Backoff before retrying a failed attempt.
+             */
+            RetryDelay
+        };
+
+        AWS_CORE_API const char* GetRequestPhaseName(RequestPhase phase);
+
+        /**
+         * A single timed phase of an api call.
+         */
+        struct AWS_CORE_API RequestSpan
+        {
+            RequestPhase phase;
+            /**
+             * 1 based index of the attempt the phase belongs to.
+             */
+            long attempt;
+            std::chrono::steady_clock::time_point startTime;
+            std::chrono::microseconds duration;
+        };
+
+        class RequestTiming;
+
+        /**
+         * Hook to export the phases of api calls as tracing spans, set on ClientConfiguration::requestTracer.
+         */
+        class AWS_CORE_API RequestTracer
+        {
+        public:
+            virtual ~RequestTracer() = default;
+
+            /**
+             * Called on the thread making the api call every time one of its phases completes. Must not block.
+             */
+            virtual void OnSpan(const RequestTiming& timing, const RequestSpan& span) const = 0;
+        };
+
+        /**
+         * Per phase and per attempt timing of a single api call, attached to its outcome, see AmazonWebServiceResult::GetRequestTiming()
+         * and AWSError::GetRequestTiming().
+         * Phases measured by the http client (connection acquisition, DNS, TCP, TLS, time to first byte and response transfer) are
+         * reported by the client in milliseconds and laid out one after the other from the start of the http transfer,
+         * phases measured by the SDK itself have microsecond resolution.
+         * Phases the http client does not report are missing.
+         */
+        class AWS_CORE_API RequestTiming
+        {
+        public:
+            /**
+             * @param serviceName, requestName and invocationId identify the api call, e.g. for tracers.
+             * @param tracer, if set, receives every span as it is added.
+             */
+            RequestTiming(const Aws::String& serviceName, const Aws::String& requestName, const Aws::String& invocationId,
+                const std::shared_ptr<RequestTracer>& tracer = nullptr);
+
+            /**
+             * Marks the start of a new attempt, spans added from now on belong to it.
+             */
+            void StartAttempt();
+
+            /**
+             * Adds a span to the current attempt.
+             */
+            void AddSpan(RequestPhase phase, std::chrono::steady_clock::time_point startTime, std::chrono::microseconds duration);
+
+            /**
+             * Adds a span to the current attempt that started at startTime and ends now.
+             */
+            void AddSpan(RequestPhase phase, std::chrono::steady_clock::time_point startTime);
+
+            inline const Aws::String& GetServiceName() const { return m_serviceName; }
+            inline const Aws::String& GetRequestName() const { return m_requestName; }
+            inline const Aws::String& GetInvocationId() const { return m_invocationId; }
+            inline long GetAttemptCount() const { return m_attemptCount; }
+            inline const Aws::Vector<RequestSpan>& GetSpans() const { return m_spans; }
+
+            /**
+             * When the api call started.
+             */
+            inline std::chrono::steady_clock::time_point GetStartTime() const { return m_startTime; }
+
+            /**
+             * Time from the start of the api call to the end of its last span.
+             */
+            std::chrono::microseconds GetTotalDuration() const;
+
+            /**
+             * Time spent in phase, summed over all attempts.
+             */
+            std::chrono::microseconds GetPhaseDuration(RequestPhase phase) const;
+
+            /**
+             * Time spent in phase during the given attempt.
+             */
+            std::chrono::microseconds GetPhaseDuration(RequestPhase phase, long attempt) const;
+
+        private:
+            Aws::String m_serviceName;
+            Aws::String m_requestName;
+            Aws::String m_invocationId;
+            std::shared_ptr<RequestTracer> m_tracer;
+            std::chrono::steady_clock::time_point m_startTime;
+            std::chrono::steady_clock::time_point m_endTime;
+            long m_attemptCount;
+            Aws::Vector<RequestSpan> m_spans;
+        };
+    } // namespace Monitoring
+} // namespace Aws
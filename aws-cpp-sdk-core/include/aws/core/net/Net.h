@@ -6,6 +6,8 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
 namespace Aws
 {
@@ -19,5 +21,8 @@ namespace Aws
 
         // Cleanup network stack.
         void CleanupNetwork();
+
+        // Numeric IPv4 and IPv6 addresses of host, in the order the system resolver returned them. Empty if it can't be resolved.
+        AWS_CORE_API Aws::Vector<Aws::String> ResolveHostAddresses(const Aws::String& host);
     }
 }
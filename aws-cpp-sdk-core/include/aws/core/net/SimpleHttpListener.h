@@ -0,0 +1,69 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <atomic>
+#include <functional>
+#include <thread>
+
+namespace Aws
+{
+    namespace Net
+    {
+        /**
+         * Minimal HTTP/1.1 server bound to the loopback interface, answering every GET request with the same dynamically generated document.
+         * It serves one connection at a time on a single background thread and is meant for local scraping of diagnostics (e.g. metrics),
+         * not for general purpose serving.
+         */
+        class AWS_CORE_API SimpleHttpListener
+        {
+        public:
+            /**
+             * @brief Constructor of SimpleHttpListener, the listener is not started until Start() is called.
+             * @param contentType, value of the Content-Type header of every response.
+             * @param bodyProvider, called for every request to produce the response body.
+             */
+            SimpleHttpListener(const Aws::String& contentType, const std::function<Aws::String()>& bodyProvider);
+
+            ~SimpleHttpListener();
+
+            SimpleHttpListener(const SimpleHttpListener&) = delete;
+            SimpleHttpListener& operator=(const SimpleHttpListener&) = delete;
+
+            /**
+             * @brief Binds to 127.0.0.1 on port and starts serving on a background thread.
+             * @param port, the port to listen on, 0 to let the system pick a free one (see GetPort()).
+             * @return true on success, false if the listener is already running, the socket could not be bound, or the platform is not supported.
+             */
+            bool Start(unsigned short port);
+
+            /**
+             * Stops serving and closes the listening socket. Blocks until the background thread exits.
+             */
+            void Stop();
+
+            inline bool IsRunning() const { return m_running.load(); }
+
+            /**
+             * The port actually bound, 0 if not running.
+             */
+            inline unsigned short GetPort() const { return m_port; }
+
+        private:
+            void Serve();
+            void HandleConnection(int connection) const;
+
+            Aws::String m_contentType;
+            std::function<Aws::String()> m_bodyProvider;
+            int m_listenSocket;
+            unsigned short m_port;
+            std::atomic<bool> m_running;
+            std::thread m_serveThread;
+        };
+    }
+}
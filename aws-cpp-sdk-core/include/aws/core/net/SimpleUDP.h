@@ -98,6 +98,16 @@ namespace Aws
              */
             int SendData(const uint8_t* data, size_t dataLen) const;
 
+            /**
+             * @brief Send several datagrams to server in as few system calls as the platform allows (a single sendmmsg on Linux),
+             * only usable if hostIP and port are available.
+             * @param data, array of count pointers, each one to the content of a datagram.
+             * @param dataLen, array of count lengths, dataLen[i] is the length of data[i].
+             * @param count, the number of datagrams to send.
+             * @return the number of datagrams sent on success, -1 on error, check errno for detailed error information.
+             */
+            int SendDataBatch(const uint8_t* const* data, const size_t* dataLen, size_t count) const;
+
             /**
              * @brief Send data to server.
              * @param address, the server's address info.
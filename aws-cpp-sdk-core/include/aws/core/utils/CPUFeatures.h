@@ -0,0 +1,44 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+/**
+ * AWS_CPU_X86_SIMD is defined when the compiler can build SSSE3 and AVX2 code paths without global compiler flags,
+ * functions using them must be marked with AWS_TARGET_SSSE3 or AWS_TARGET_AVX2 and only called after checking
+ * the corresponding CPUFeatures function.
+ */
+#if (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)) && \
+    (defined(_MSC_VER) || defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#define AWS_CPU_X86_SIMD 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#define AWS_TARGET_SSSE3
+#define AWS_TARGET_AVX2
+#else
+#define AWS_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define AWS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace CPUFeatures
+        {
+            /**
+             * Whether the CPU running the process supports SSSE3. Detected once and cached.
+             */
+            AWS_CORE_API bool HasSSSE3();
+
+            /**
+             * Whether the CPU running the process supports AVX2, and the OS saves the AVX registers. Detected once and cached.
+             */
+            AWS_CORE_API bool HasAVX2();
+        } // namespace CPUFeatures
+    } // namespace Utils
+} // namespace Aws
@@ -6,42 +6,252 @@
 #pragma once
 
 #include <aws/core/utils/DateTime.h>
-#include <aws/core/utils/Cache.h>
-#include <aws/core/utils/threading/ReaderWriterLock.h>
+#include <aws/core/utils/memory/stl/AWSList.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
 
 namespace Aws
 {
     namespace Utils
     {
-        template <typename TKey, typename TValue>
+        /**
+         * Hash used to pick the shard (and bucket) of a ConcurrentCache key. Defaults to std::hash.
+         */
+        template <typename TKey>
+        struct CacheKeyHash
+        {
+            size_t operator()(const TKey& key) const
+            {
+                return std::hash<TKey>()(key);
+            }
+        };
+
+        /**
+         * Aws::String may use a custom allocator, which std::hash does not cover. FNV-1a over the characters.
+         */
+        template <>
+        struct CacheKeyHash<Aws::String>
+        {
+            size_t operator()(const Aws::String& key) const
+            {
+                uint64_t hash = 14695981039346656037ULL;
+                for (char c : key)
+                {
+                    hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+                }
+                return static_cast<size_t>(hash);
+            }
+        };
+
+        /**
+         * Counters of a ConcurrentCache, summed over its shards.
+         */
+        struct CacheStats
+        {
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            // Live entries dropped to make room for new ones.
+            uint64_t evictions = 0;
+            // Expired entries dropped when looked up or when making room.
+            uint64_t expirations = 0;
+            size_t size = 0;
+        };
+
+        /**
+         * Thread safe in-memory cache with a time to live per entry.
+         * Keys are spread over independently locked shards, so that concurrent lookups of different keys do not
+         * serialize on one lock. Each shard holds at most its share of the cache size and evicts its least recently
+         * used entry when full. Expired entries are dropped when they are looked up or reach the end of the LRU list.
+         * All operations are O(1).
+         */
+        template <typename TKey, typename TValue, typename THash = CacheKeyHash<TKey>>
         class ConcurrentCache
         {
         public:
-            explicit ConcurrentCache(size_t size = 1000) : m_cache(size) { }
+            /**
+             * @param size Maximum number of entries, split evenly over the shards (rounded up).
+             * @param shardCount Number of shards, rounded down to a power of two and to at most size.
+             */
+            explicit ConcurrentCache(size_t size = 1000, size_t shardCount = 16) :
+                m_shards(ShardCountFor(size, shardCount)),
+                m_shardMask(m_shards.size() - 1)
+            {
+                const size_t shardCapacity = (size + m_shards.size() - 1) / m_shards.size();
+                for (auto& shard : m_shards)
+                {
+                    shard.capacity = shardCapacity;
+                }
+            }
+
+            ConcurrentCache(const ConcurrentCache&) = delete;
+            ConcurrentCache& operator=(const ConcurrentCache&) = delete;
 
+            /**
+             * Retrieves the value associated with the given key if it exists and has not expired and returns true.
+             * Otherwise, returns false.
+             */
             bool Get(const TKey& key, TValue& value) const
             {
-                Aws::Utils::Threading::ReaderLockGuard g(m_rwlock);
-                return m_cache.Get(key, value);
+                const size_t hash = m_hash(key);
+                Shard& shard = ShardFor(hash);
+                std::lock_guard<std::mutex> locker(shard.lock);
+                auto it = shard.index.find(key);
+                if (it == shard.index.end())
+                {
+                    shard.misses++;
+                    return false;
+                }
+
+                auto entry = it->second;
+                if (Clock::now() > entry->expiration)
+                {
+                    shard.index.erase(it);
+                    shard.entries.erase(entry);
+                    shard.misses++;
+                    shard.expirations++;
+                    return false;
+                }
+
+                shard.entries.splice(shard.entries.begin(), shard.entries, entry);
+                shard.hits++;
+                value = entry->value;
+                return true;
             }
 
+            /**
+             * Add or update a cache entry, which expires after the given duration.
+             */
             template<typename UValue>
             void Put(const TKey& key, UValue&& val, std::chrono::milliseconds duration)
             {
-                Aws::Utils::Threading::WriterLockGuard g(m_rwlock);
-                m_cache.Put(key, std::forward<UValue>(val), duration);
+                PutImpl(key, std::forward<UValue>(val), duration);
             }
 
             template<typename UValue>
             void Put(TKey&& key, UValue&& val, std::chrono::milliseconds duration)
             {
-                Aws::Utils::Threading::WriterLockGuard g(m_rwlock);
-                m_cache.Put(std::move(key), std::forward<UValue>(val), duration);
+                PutImpl(std::move(key), std::forward<UValue>(val), duration);
+            }
+
+            /**
+             * Removes the entry of the given key. Returns whether there was one.
+             */
+            bool Remove(const TKey& key)
+            {
+                Shard& shard = ShardFor(m_hash(key));
+                std::lock_guard<std::mutex> locker(shard.lock);
+                auto it = shard.index.find(key);
+                if (it == shard.index.end())
+                {
+                    return false;
+                }
+                shard.entries.erase(it->second);
+                shard.index.erase(it);
+                return true;
+            }
+
+            CacheStats GetStats() const
+            {
+                CacheStats stats;
+                for (auto& shard : m_shards)
+                {
+                    std::lock_guard<std::mutex> locker(shard.lock);
+                    stats.hits += shard.hits;
+                    stats.misses += shard.misses;
+                    stats.evictions += shard.evictions;
+                    stats.expirations += shard.expirations;
+                    stats.size += shard.index.size();
+                }
+                return stats;
             }
 
         private:
-            Aws::Utils::Cache<TKey, TValue> m_cache;
-            mutable Aws::Utils::Threading::ReaderWriterLock m_rwlock;
+            using Clock = std::chrono::steady_clock;
+
+            struct Entry
+            {
+                TKey key;
+                TValue value;
+                Clock::time_point expiration;
+            };
+
+            using EntryList = Aws::List<Entry>;
+            using EntryIndex = std::unordered_map<TKey, typename EntryList::iterator, THash, std::equal_to<TKey>,
+                Aws::Allocator<std::pair<const TKey, typename EntryList::iterator>>>;
+
+            struct Shard
+            {
+                std::mutex lock;
+                // Most recently used first.
+                EntryList entries;
+                EntryIndex index;
+                size_t capacity = 0;
+                uint64_t hits = 0;
+                uint64_t misses = 0;
+                uint64_t evictions = 0;
+                uint64_t expirations = 0;
+            };
+
+            static size_t ShardCountFor(size_t size, size_t shardCount)
+            {
+                size_t count = 1;
+                while (count * 2 <= shardCount && count * 2 <= size)
+                {
+                    count *= 2;
+                }
+                return count;
+            }
+
+            Shard& ShardFor(size_t hash) const
+            {
+                // Mix the high bits in, std::hash of integers is the identity.
+                hash ^= hash >> 16;
+                return m_shards[(hash * 0x9E3779B1u >> 8) & m_shardMask];
+            }
+
+            template<typename UKey, typename UValue>
+            void PutImpl(UKey&& key, UValue&& val, std::chrono::milliseconds duration)
+            {
+                const Clock::time_point expiration = Clock::now() + duration;
+                Shard& shard = ShardFor(m_hash(key));
+                std::lock_guard<std::mutex> locker(shard.lock);
+                auto it = shard.index.find(key);
+                if (it != shard.index.end())
+                {
+                    auto entry = it->second;
+                    entry->value = std::forward<UValue>(val);
+                    entry->expiration = expiration;
+                    shard.entries.splice(shard.entries.begin(), shard.entries, entry);
+                    return;
+                }
+
+                if (shard.index.size() >= shard.capacity && !shard.entries.empty())
+                {
+                    auto& last = shard.entries.back();
+                    if (Clock::now() > last.expiration)
+                    {
+                        shard.expirations++;
+                    }
+                    else
+                    {
+                        shard.evictions++;
+                    }
+                    shard.index.erase(last.key);
+                    shard.entries.pop_back();
+                }
+
+                shard.entries.push_front(Entry { std::forward<UKey>(key), std::forward<UValue>(val), expiration });
+                shard.index.emplace(shard.entries.front().key, shard.entries.begin());
+            }
+
+            mutable Aws::Vector<Shard> m_shards;
+            const size_t m_shardMask;
+            THash m_hash;
         };
     }
 }
@@ -149,6 +149,14 @@ namespace Aws
                 return error;
             }
 
+            /**
+             * casts the underlying error to an r-value so that caller can take ownership of underlying resources.
+             */
+            inline E&& GetErrorWithOwnership()
+            {
+                return std::move(error);
+            }
+
             template<typename T>
             inline T GetError()
             {
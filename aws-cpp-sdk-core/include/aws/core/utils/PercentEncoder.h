@@ -0,0 +1,55 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Table driven percent-encoder (upper case hex digits). The set of characters left unescaped is computed once,
+         * encoding then writes straight into the caller's buffer without intermediate streams or strings.
+         * Runs of characters that need no escaping are classified and copied 16 bytes at a time when SSSE3 is available.
+         */
+        class AWS_CORE_API PercentEncoder
+        {
+        public:
+            /**
+             * ASCII letters, digits and the characters in unescapedChars are left as is, every other byte is escaped.
+             */
+            explicit PercentEncoder(const char* unescapedChars);
+
+            /**
+             * Size of the buffer Encode needs for length bytes of input.
+             */
+            static size_t MaxEncodedLength(size_t length) { return length * 3; }
+
+            /**
+             * Encodes length bytes of data into output, which must hold at least MaxEncodedLength(length) bytes.
+             * Returns the number of bytes written.
+             */
+            size_t Encode(const char* data, size_t length, char* output) const;
+
+            /**
+             * Appends the encoding of length bytes of data to output.
+             */
+            void Append(const char* data, size_t length, Aws::String& output) const;
+
+            inline bool IsUnescaped(unsigned char c) const { return m_unescaped[c]; }
+
+        private:
+            bool m_unescaped[256];
+            // For each low nibble, the bit set of high nibbles (ASCII only) that form an unescaped character.
+            uint8_t m_unescapedHighNibbles[16];
+        };
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,52 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+/**
+ * Statically defined tracing (SDT/USDT) probes on the hot paths of the SDK, to trace latency and contention live
+ * with perf, bpftrace or SystemTap, e.g.
+ *   bpftrace -e 'usdt:/path/to/libaws-cpp-sdk-core.so:aws_sdk:attempt__start { @start[arg2] = nsecs; }
+ *                usdt:/path/to/libaws-cpp-sdk-core.so:aws_sdk:attempt__end /@start[arg0]/ { @us = hist((nsecs - @start[arg0]) / 1000); delete(@start[arg0]); }'
+ *
+ * Probes are only compiled in when the SDK is built on Linux with -DENABLE_SDT_PROBES=ON and <sys/sdt.h> is available
+ * (systemtap-sdt-dev or systemtap-sdt-devel). Otherwise the macros expand to nothing and their arguments are not evaluated.
+ * An enabled probe that nothing is attached to costs a single nop.
+ *
+ * Probes of provider aws_sdk, and their arguments:
+ *   attempt__start      (const char* serviceName, const char* requestName, HttpRequest* request)
+ *   attempt__end        (HttpRequest* request, int httpResponseCode), -1 if no response was received
+ *   retry__decision     (HttpRequest* request, long attemptedRetries, int errorType, int retrying, long delayMs)
+ *   sign__start         (const char* signerName, HttpRequest* request)
+ *   sign__end           (const char* signerName, HttpRequest* request, int signed)
+ *   curl__acquire__start(CurlHandleContainer* container)
+ *   curl__acquire       (CurlHandleContainer* container, CURL* handle)
+ *   curl__release       (CurlHandleContainer* container, CURL* handle)
+ *   curl__grow          (CurlHandleContainer* container, unsigned handlesAdded, unsigned poolSize)
+ *   executor__submit    (Executor* executor, std::function<void()>* task, size_t queueDepth), for DefaultExecutor task is null
+ *                       and queueDepth is the number of threads running
+ *   executor__start     (Executor* executor, std::function<void()>* task)
+ */
+#if defined(AWS_SDK_ENABLE_SDT_PROBES)
+
+#include <sys/sdt.h>
+
+#define AWS_SDK_PROBE(name) DTRACE_PROBE(aws_sdk, name)
+#define AWS_SDK_PROBE1(name, arg1) DTRACE_PROBE1(aws_sdk, name, arg1)
+#define AWS_SDK_PROBE2(name, arg1, arg2) DTRACE_PROBE2(aws_sdk, name, arg1, arg2)
+#define AWS_SDK_PROBE3(name, arg1, arg2, arg3) DTRACE_PROBE3(aws_sdk, name, arg1, arg2, arg3)
+#define AWS_SDK_PROBE4(name, arg1, arg2, arg3, arg4) DTRACE_PROBE4(aws_sdk, name, arg1, arg2, arg3, arg4)
+#define AWS_SDK_PROBE5(name, arg1, arg2, arg3, arg4, arg5) DTRACE_PROBE5(aws_sdk, name, arg1, arg2, arg3, arg4, arg5)
+
+#else
+
+#define AWS_SDK_PROBE(name)
+#define AWS_SDK_PROBE1(name, arg1)
+#define AWS_SDK_PROBE2(name, arg1, arg2)
+#define AWS_SDK_PROBE3(name, arg1, arg2, arg3)
+#define AWS_SDK_PROBE4(name, arg1, arg2, arg3, arg4)
+#define AWS_SDK_PROBE5(name, arg1, arg2, arg3, arg4, arg5)
+
+#endif
@@ -4,19 +4,65 @@
  */
 #pragma once
 
+#include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
 
 namespace Aws
 {
     namespace Utils
     {
+        /**
+         * Lane an acquisition waits in. While a resource manager has waiters in a lane, acquisitions from the lanes after it
+         * wait too, e.g. so that latency sensitive calls get connections ahead of bulk transfers sharing the pool.
+         */
+        enum class AcquirePriority
+        {
+            HIGH,
+            NORMAL,
+            LOW
+        };
+
+        static const size_t ACQUIRE_PRIORITY_COUNT = 3;
+
+        /**
+         * How long the acquisitions of one priority waited for a resource.
+         */
+        struct ResourceWaitStatistics
+        {
+            static const size_t BUCKET_COUNT = 6;
+
+            ResourceWaitStatistics() : acquireCount(0), timeoutCount(0), waiting(0), waitHistogram() {}
+
+            /**
+             * Upper bound of the wait times counted in a histogram bucket: 100us, 1ms, 10ms, 100ms and 1s. The last bucket
+             * counts the longer waits.
+             */
+            static std::chrono::microseconds GetBucketUpperBound(size_t bucket)
+            {
+                std::chrono::microseconds bound(100);
+                for (size_t i = 0; i < bucket; ++i)
+                {
+                    bound *= 10;
+                }
+                return bound;
+            }
+
+            uint64_t acquireCount;
+            uint64_t timeoutCount;
+            // Acquisitions waiting right now.
+            size_t waiting;
+            uint64_t waitHistogram[BUCKET_COUNT];
+        };
+
         /**
          * Generic resource manager with Acquire/Release semantics. Acquire will block waiting on a an available resource. Release will
-         * cause one blocked acquisition to unblock.
+         * cause one blocked acquisition to unblock, taken from the highest priority lane that has waiters.
          *
          * You must call ShutdownAndWait() when finished with this container, this unblocks the listening thread and gives you a chance to
          * clean up the resource if needed.
@@ -26,28 +72,42 @@ namespace Aws
         class ExclusiveOwnershipResourceManager
         {
         public:
-            ExclusiveOwnershipResourceManager() : m_shutdown(false) {}
+            ExclusiveOwnershipResourceManager() : m_shutdown(false), m_waiting() {}
 
             /**
              * Returns a resource with exclusive ownership. You must call Release on the resource when you are finished or other
              * threads will block waiting to acquire it.
              *
+             * @param priority lane to wait in when no resource is available.
              * @return instance of RESOURCE_TYPE
              */
-            RESOURCE_TYPE Acquire()
+            RESOURCE_TYPE Acquire(AcquirePriority priority = AcquirePriority::NORMAL)
             {
                 std::unique_lock<std::mutex> locker(m_queueLock);
-                while(!m_shutdown.load() && m_resources.size() == 0)
-                {
-                    m_semaphore.wait(locker, [&](){ return m_shutdown.load() || m_resources.size() > 0; });
-                }
+                bool acquired = WaitForResource(locker, priority, nullptr);
+                AWS_UNREFERENCED_PARAM(acquired);
+                assert(acquired);
 
-                assert(!m_shutdown.load());
+                return TakeResource(locker);
+            }
 
-                RESOURCE_TYPE resource = m_resources.back();
-                m_resources.pop_back();
+            /**
+             * Like Acquire(), but gives up after waiting for timeout.
+             *
+             * @param resource set to the acquired resource on success.
+             * @return false if no resource became available within timeout or the manager is shutting down.
+             */
+            bool TryAcquire(RESOURCE_TYPE& resource, std::chrono::milliseconds timeout, AcquirePriority priority = AcquirePriority::NORMAL)
+            {
+                const auto deadline = std::chrono::steady_clock::now() + timeout;
+                std::unique_lock<std::mutex> locker(m_queueLock);
+                if (!WaitForResource(locker, priority, &deadline))
+                {
+                    return false;
+                }
 
-                return resource;
+                resource = TakeResource(locker);
+                return true;
             }
 
             /**
@@ -71,10 +131,50 @@ namespace Aws
             {
                 std::unique_lock<std::mutex> locker(m_queueLock);
                 m_resources.push_back(resource);
-                locker.unlock();
+                NotifyWaiter(locker);
                 m_semaphore.notify_one();
             }
 
+            /**
+             * Wait statistics of the acquisitions from the priority lane, since the manager was created.
+             */
+            ResourceWaitStatistics GetWaitStatistics(AcquirePriority priority = AcquirePriority::NORMAL)
+            {
+                std::lock_guard<std::mutex> locker(m_queueLock);
+                const size_t lane = static_cast<size_t>(priority);
+                ResourceWaitStatistics statistics = m_statistics[lane];
+                statistics.waiting = m_waiting[lane];
+                return statistics;
+            }
+
+            /**
+             * Takes the resources currently available for acquisition that match predicate out of the pool, e.g. to close idle
+             * connections. Resources in use are not looked at. The caller now owns the returned resources.
+             *
+             * @param predicate called with each available resource, under the lock of the pool.
+             * @return the resources removed from the pool.
+             */
+            template<typename PREDICATE>
+            Aws::Vector<RESOURCE_TYPE> RemoveAvailableIf(PREDICATE predicate)
+            {
+                Aws::Vector<RESOURCE_TYPE> removed;
+                std::lock_guard<std::mutex> locker(m_queueLock);
+                auto kept = m_resources.begin();
+                for (auto it = m_resources.begin(); it != m_resources.end(); ++it)
+                {
+                    if (predicate(*it))
+                    {
+                        removed.push_back(*it);
+                    }
+                    else
+                    {
+                        *kept++ = *it;
+                    }
+                }
+                m_resources.erase(kept, m_resources.end());
+                return removed;
+            }
+
             /**
              * Does not block or even touch the semaphores. This is intended for setup only, do not use this after Acquire has been called for the first time.
              *
@@ -99,6 +199,10 @@ namespace Aws
                 Aws::Vector<RESOURCE_TYPE> resources;
                 std::unique_lock<std::mutex> locker(m_queueLock);
                 m_shutdown = true;
+                for (auto& lane : m_lanes)
+                {
+                    lane.notify_all();
+                }
 
                 //wait for all acquired resources to be released.
                 while (m_resources.size() < resourceCount)
@@ -113,10 +217,103 @@ namespace Aws
             }
 
         private:
+            // A resource can be taken from a lane when no lane ahead of it has waiters.
+            bool CanAcquire(size_t lane) const
+            {
+                if (m_resources.empty())
+                {
+                    return false;
+                }
+                for (size_t ahead = 0; ahead < lane; ++ahead)
+                {
+                    if (m_waiting[ahead] > 0)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            // Returns with locker held. False on timeout, or on shutdown while waiting.
+            bool WaitForResource(std::unique_lock<std::mutex>& locker, AcquirePriority priority, const std::chrono::steady_clock::time_point* deadline)
+            {
+                const size_t lane = static_cast<size_t>(priority);
+                ResourceWaitStatistics& statistics = m_statistics[lane];
+                if (!m_shutdown.load() && CanAcquire(lane))
+                {
+                    ++statistics.acquireCount;
+                    ++statistics.waitHistogram[0];
+                    return true;
+                }
+
+                const auto start = std::chrono::steady_clock::now();
+                auto ready = [&]() { return m_shutdown.load() || CanAcquire(lane); };
+                ++m_waiting[lane];
+                bool signaled = true;
+                if (deadline)
+                {
+                    signaled = m_lanes[lane].wait_until(locker, *deadline, ready);
+                }
+                else
+                {
+                    m_lanes[lane].wait(locker, ready);
+                }
+                --m_waiting[lane];
+
+                if (!signaled || m_shutdown.load())
+                {
+                    if (!signaled)
+                    {
+                        ++statistics.timeoutCount;
+                    }
+                    // Lanes behind this one may have been held back by it.
+                    NotifyWaiter(locker);
+                    locker.lock();
+                    return false;
+                }
+
+                const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+                size_t bucket = 0;
+                while (bucket + 1 < ResourceWaitStatistics::BUCKET_COUNT && wait >= ResourceWaitStatistics::GetBucketUpperBound(bucket))
+                {
+                    ++bucket;
+                }
+                ++statistics.acquireCount;
+                ++statistics.waitHistogram[bucket];
+                return true;
+            }
+
+            RESOURCE_TYPE TakeResource(std::unique_lock<std::mutex>& locker)
+            {
+                RESOURCE_TYPE resource = m_resources.back();
+                m_resources.pop_back();
+                NotifyWaiter(locker);
+                return resource;
+            }
+
+            // Wakes up a waiter of the highest priority lane that has any, if a resource is left for it. Unlocks locker.
+            void NotifyWaiter(std::unique_lock<std::mutex>& locker)
+            {
+                size_t lane = 0;
+                while (lane < ACQUIRE_PRIORITY_COUNT && m_waiting[lane] == 0)
+                {
+                    ++lane;
+                }
+                const bool notify = lane < ACQUIRE_PRIORITY_COUNT && !m_resources.empty();
+                locker.unlock();
+                if (notify)
+                {
+                    m_lanes[lane].notify_one();
+                }
+            }
+
             Aws::Vector<RESOURCE_TYPE> m_resources;
             std::mutex m_queueLock;
             std::condition_variable m_semaphore;
             std::atomic<bool> m_shutdown;
+            std::condition_variable m_lanes[ACQUIRE_PRIORITY_COUNT];
+            size_t m_waiting[ACQUIRE_PRIORITY_COUNT];
+            ResourceWaitStatistics m_statistics[ACQUIRE_PRIORITY_COUNT];
         };
     }
 }
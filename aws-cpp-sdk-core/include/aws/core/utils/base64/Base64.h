@@ -30,6 +30,7 @@ namespace Aws
 
             /**
              * interface for platform specific Base64 encoding/decoding.
+             * With the default (MIME) encoding table, SSSE3 or AVX2 code is used when the CPU supports it.
              */
             class AWS_CORE_API Base64
             {
@@ -61,6 +62,7 @@ namespace Aws
             private:
                 char m_mimeBase64EncodingTable[64];
                 uint8_t m_mimeBase64DecodingTable[256];
+                bool m_isMimeEncodingTable;
 
             };
 
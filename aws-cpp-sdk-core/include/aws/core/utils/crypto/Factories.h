@@ -108,6 +108,13 @@ namespace Aws
              * Create SecureRandomBytes instance
              */
             AWS_CORE_API std::shared_ptr<SecureRandomBytes> CreateSecureRandomBytesImplementation();
+
+            /**
+             * Fills buffer with bufferSize bytes from the SecureRandomBytes implementation. Small requests are served from a
+             * per-thread buffer refilled in chunks, so this neither allocates nor calls into the platform RNG for every call.
+             * Thread safe. Returns false if the random source failed or none is available.
+             */
+            AWS_CORE_API bool GetBufferedSecureRandomBytes(unsigned char* buffer, size_t bufferSize);
           
             /**
              * Set the global factory for MD5 Hash providers
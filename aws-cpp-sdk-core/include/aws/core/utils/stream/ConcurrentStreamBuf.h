@@ -8,6 +8,8 @@
 #include <aws/core/auth/AWSAuthSigner.h>
 #include <aws/common/array_list.h>
 
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 #include <condition_variable>
 #include <streambuf>
@@ -25,6 +27,12 @@ namespace Aws
              * NOTE: iostreams maintain state for readers and writers. This means that you can have at most two
              * concurrent threads, one for reading and one for writing. Multiple readers or multiple writers are not
              * thread-safe and will result in race-conditions.
+             *
+             * The buffer is a single-producer/single-consumer ring: the put area and the get area point straight into
+             * the ring, so written bytes are never copied again before they are read. The two sides only synchronize
+             * through the ring's read and write positions; the mutex and condition variable are used to sleep when the
+             * ring is full (the writer blocks until the reader catches up) or empty.
+             * Bytes written become visible to the reader when the stream is flushed or the put area fills up.
              */
             class AWS_CORE_API ConcurrentStreamBuf : public std::streambuf
             {
@@ -46,12 +54,18 @@ namespace Aws
                 void FlushPutArea();
 
             private:
-                Aws::Vector<unsigned char> m_getArea;
-                Aws::Vector<unsigned char> m_putArea;
-                Aws::Vector<unsigned char> m_backbuf; // used to shuttle data from the put area to the get area
-                std::mutex m_lock; // synchronize access to the common backbuffer
+                template<typename Predicate>
+                void WaitUntil(std::atomic<bool>& waiting, Predicate ready);
+                void Wake(const std::atomic<bool>& waiting);
+
+                Aws::Vector<unsigned char> m_buffer; // the ring
+                std::atomic<uint64_t> m_writePos; // total bytes published by the writer
+                std::atomic<uint64_t> m_readPos; // total bytes released by the reader
+                std::atomic<bool> m_readerWaiting;
+                std::atomic<bool> m_writerWaiting;
+                std::mutex m_lock; // only taken to sleep or wake up the other side
                 std::condition_variable m_signal;
-                bool m_eof;
+                std::atomic<bool> m_eof;
             };
         }
     }
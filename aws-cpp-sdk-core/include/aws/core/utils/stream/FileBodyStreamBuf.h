@@ -0,0 +1,99 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <streambuf>
+#include <ios>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * Read-only stream buf over a byte range of a file, read with positional reads on the file descriptor.
+             * Reads of at least a few kilobytes (what the HTTP clients and the hashes ask for) go straight from the file into
+             * the caller's buffer, without the intermediate copy a filebuf makes; smaller reads are buffered.
+             * Seeking is supported and does not touch the file, so the body can be hashed, signed and re-sent on retries.
+             */
+            class AWS_CORE_API FileBodyStreamBuf : public std::streambuf
+            {
+            public:
+                /**
+                 * Opens path for reading. length is capped at the end of the file, by default the range goes up to it.
+                 * Check IsOpen() before using the stream buf.
+                 */
+                FileBodyStreamBuf(const Aws::String& path, uint64_t offset = 0, uint64_t length = UINT64_MAX);
+                ~FileBodyStreamBuf();
+
+                FileBodyStreamBuf(const FileBodyStreamBuf&) = delete;
+                FileBodyStreamBuf& operator=(const FileBodyStreamBuf&) = delete;
+
+                bool IsOpen() const;
+
+                /**
+                 * Length of the byte range, regardless of the read position.
+                 */
+                uint64_t GetLength() const { return m_length; }
+
+            protected:
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+                int_type underflow() override;
+                std::streamsize xsgetn(char* s, std::streamsize n) override;
+                std::streamsize showmanyc() override;
+
+            private:
+                uint64_t CurrentPosition() const;
+                // Reads up to length bytes at position (relative to the range) into dest, returns the number of bytes read.
+                size_t ReadAt(uint64_t position, char* dest, size_t length);
+
+#ifdef _WIN32
+                void* m_file;
+#else
+                int m_file;
+#endif
+                uint64_t m_offset; // of the range in the file
+                uint64_t m_length;
+                uint64_t m_getAreaOffset; // range offset of eback(), or of the next read when the get area is empty
+                Aws::Vector<char> m_buffer; // allocated on the first small read
+            };
+
+            /**
+             * An Aws::IOStream reading a file through its own FileBodyStreamBuf. Use it as a request body in place of an
+             * Aws::FStream: the HTTP clients and AWSClient recognize it (without RTTI) to learn the content length without
+             * seeking and to read straight into their send buffers.
+             */
+            class AWS_CORE_API FileBodyStream : public Aws::IOStream
+            {
+            public:
+                /**
+                 * The stream is in a failed state if the file can't be opened.
+                 */
+                FileBodyStream(const Aws::String& path, uint64_t offset = 0, uint64_t length = UINT64_MAX);
+
+                uint64_t GetLength() const { return m_streambuf.GetLength(); }
+
+                /**
+                 * Returns the file body stream buf that stream reads from if stream is a FileBodyStream, nullptr otherwise.
+                 */
+                static FileBodyStreamBuf* GetFileBodyStreamBuf(std::ios& stream);
+
+            private:
+                static int StreamIndex();
+
+                FileBodyStreamBuf m_streambuf;
+            };
+        }
+    }
+}
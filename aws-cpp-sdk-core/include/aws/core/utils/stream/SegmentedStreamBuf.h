@@ -0,0 +1,113 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSList.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <streambuf>
+#include <ios>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * Read-only stream buf over a chain of buffers (scatter-gather), so that a request body assembled from several
+             * pieces does not have to be copied into a single stream first. The get area points straight into the
+             * current segment and reads spanning segments are copied segment by segment.
+             * Seeking is supported, so the body can be hashed, signed and re-sent on retries.
+             */
+            class AWS_CORE_API SegmentedStreamBuf : public std::streambuf
+            {
+            public:
+                SegmentedStreamBuf();
+
+                SegmentedStreamBuf(const SegmentedStreamBuf&) = delete;
+                SegmentedStreamBuf& operator=(const SegmentedStreamBuf&) = delete;
+
+                /**
+                 * Appends a borrowed buffer. This class never takes ownership of it: it must stay alive and unchanged
+                 * while the stream is in use.
+                 */
+                void Append(const unsigned char* data, size_t length);
+
+                /**
+                 * Appends a buffer owned by the stream buf from now on. The string is moved, not copied.
+                 */
+                void Append(Aws::String&& data);
+
+                /**
+                 * Total length of all the segments, regardless of the read position.
+                 */
+                size_t GetLength() const { return m_length; }
+
+                size_t GetSegmentCount() const { return m_segments.size(); }
+
+            protected:
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+                int_type underflow() override;
+                std::streamsize xsgetn(char* s, std::streamsize n) override;
+                std::streamsize showmanyc() override;
+
+            private:
+                struct Segment
+                {
+                    const char* data;
+                    size_t length;
+                    size_t offset; // of the first byte in the stream
+                };
+
+                size_t CurrentPosition() const;
+
+                Aws::Vector<Segment> m_segments; // never holds empty segments
+                Aws::List<Aws::String> m_ownedData; // list nodes don't move, so neither do the strings' buffers
+                size_t m_nextSegment; // segment loaded by the next underflow
+                size_t m_getAreaOffset; // stream offset of eback()
+                size_t m_length;
+            };
+
+            /**
+             * An Aws::IOStream reading from its own SegmentedStreamBuf. Use it as a request body: the HTTP clients and
+             * AWSClient recognize it (without RTTI) to learn the content length without seeking and to copy straight
+             * from the segments.
+             */
+            class AWS_CORE_API SegmentedStream : public Aws::IOStream
+            {
+            public:
+                SegmentedStream();
+
+                /**
+                 * Appends a borrowed buffer, see SegmentedStreamBuf::Append.
+                 */
+                void Append(const unsigned char* data, size_t length) { m_streambuf.Append(data, length); }
+
+                /**
+                 * Appends a buffer owned by the stream from now on. The string is moved, not copied.
+                 */
+                void Append(Aws::String&& data) { m_streambuf.Append(std::move(data)); }
+
+                size_t GetLength() const { return m_streambuf.GetLength(); }
+
+                /**
+                 * Returns the segmented stream buf that stream reads from if stream is a SegmentedStream, nullptr otherwise.
+                 */
+                static SegmentedStreamBuf* GetSegmentedStreamBuf(std::ios& stream);
+
+            private:
+                static int StreamIndex();
+
+                SegmentedStreamBuf m_streambuf;
+            };
+        }
+    }
+}
@@ -93,12 +93,17 @@ namespace Aws
                 PooledThreadExecutor(PooledThreadExecutor&&) = delete;
                 PooledThreadExecutor& operator =(PooledThreadExecutor&&) = delete;
 
+                /**
+                * Number of tasks submitted but not yet picked up by a thread of the pool.
+                */
+                size_t GetQueueDepth() const;
+
             protected:
                 bool SubmitToThread(std::function<void()>&&) override;
 
             private:
                 Aws::Queue<std::function<void()>*> m_tasks;
-                std::mutex m_queueLock;
+                mutable std::mutex m_queueLock;
                 Aws::Utils::Threading::Semaphore m_sync;
                 Aws::Vector<ThreadTask*> m_threadTaskHandles;
                 size_t m_poolSize;
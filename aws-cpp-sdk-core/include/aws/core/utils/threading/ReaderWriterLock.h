@@ -6,10 +6,10 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
-#include <aws/core/utils/threading/Semaphore.h>
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 
 namespace Aws
@@ -21,11 +21,19 @@ namespace Aws
             /**
              * This lock is optimized for frequent reads and infrequent writes.
              * However, writers get priority to the lock.
+             * Readers are counted in a single counter until two of them hold the lock at once. The lock then allocates
+             * slots, each on its own cache line, and spreads readers over them by thread id so that concurrent readers
+             * on different cores do not contend on a shared counter. Writers wait for the counters to drain.
              */
             class AWS_CORE_API ReaderWriterLock
             {
             public:
                 ReaderWriterLock();
+                ~ReaderWriterLock();
+
+                ReaderWriterLock(const ReaderWriterLock&) = delete;
+                ReaderWriterLock& operator=(const ReaderWriterLock&) = delete;
+
                 /**
                  * Enters the lock in Reader-mode.
                  * This call blocks until no writers are acquiring the lock.
@@ -52,11 +60,20 @@ namespace Aws
                  */
                 void UnlockWriter();
             private:
+                struct ReaderSlot;
+
+                std::atomic<int64_t>& CurrentThreadReaders();
+                int64_t CountReaders() const;
+                void AllocateReaderSlots();
+
                 std::atomic<int64_t> m_readers;
-                std::atomic<int64_t> m_holdouts;
-                Semaphore m_readerSem;
-                Semaphore m_writerSem;
+                std::atomic<ReaderSlot*> m_readerSlots;
+                void* m_readerSlotsMemory;
+                std::atomic<bool> m_writerActive;
                 std::mutex m_writerLock;
+                std::mutex m_waitMutex;
+                std::condition_variable m_readersDone;
+                std::condition_variable m_writerDone;
             };
 
             class AWS_CORE_API ReaderLockGuard
@@ -0,0 +1,97 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSList.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+             * Runs tasks after a delay on a single background thread, using a hashed timer wheel: timers are hashed by
+             * their expiry tick into a fixed number of slots, so scheduling and cancelling are O(1) whatever the number of
+             * pending timers, and each tick only looks at the timers of one slot.
+             * Delays are rounded up to the tick duration. Tasks run on the scheduler thread and must be short, hand
+             * anything longer off to an Executor. The thread is only started by the first call to Schedule().
+             * Pending timers don't run when the scheduler is destroyed, their onCancel callback does instead.
+             */
+            class AWS_CORE_API TimerScheduler
+            {
+            public:
+                typedef uint64_t TimerId;
+
+                /**
+                 * wheelSize is rounded up to a power of two.
+                 */
+                TimerScheduler(std::chrono::milliseconds tickDuration = std::chrono::milliseconds(10), size_t wheelSize = 512);
+                ~TimerScheduler();
+
+                TimerScheduler(const TimerScheduler&) = delete;
+                TimerScheduler& operator=(const TimerScheduler&) = delete;
+
+                /**
+                 * Runs task once delay has elapsed. Returns an id that can be passed to Cancel().
+                 */
+                TimerId Schedule(std::chrono::milliseconds delay, std::function<void()>&& task);
+
+                /**
+                 * Same as above, but onCancel runs instead of task if the timer is cancelled, or still pending when the
+                 * scheduler is destroyed. It runs on the thread cancelling the timer or destroying the scheduler.
+                 */
+                TimerId Schedule(std::chrono::milliseconds delay, std::function<void()>&& task, std::function<void()>&& onCancel);
+
+                /**
+                 * Removes a timer that hasn't fired yet and runs its onCancel callback. Returns false if it already fired, or
+                 * was already cancelled.
+                 */
+                bool Cancel(TimerId id);
+
+                /**
+                 * Number of timers scheduled but not fired yet.
+                 */
+                size_t GetPendingCount() const;
+
+            private:
+                struct Timer
+                {
+                    TimerId id;
+                    uint64_t expiryTick;
+                    std::function<void()> task;
+                    std::function<void()> onCancel;
+                };
+                typedef Aws::List<Timer> Slot;
+
+                uint64_t TickOf(std::chrono::steady_clock::time_point timePoint) const;
+                void Run();
+
+                const std::chrono::steady_clock::time_point m_start;
+                const std::chrono::milliseconds m_tickDuration;
+                Aws::Vector<Slot> m_wheel;
+                size_t m_wheelMask;
+                Aws::UnorderedMap<TimerId, Slot::iterator> m_timers;
+                // Next tick to process, every timer of the earlier ticks has fired.
+                uint64_t m_currentTick;
+                TimerId m_nextId;
+                bool m_shutdown;
+                mutable std::mutex m_lock;
+                std::condition_variable m_signal;
+                std::thread m_thread;
+            };
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
@@ -4,7 +4,7 @@
  */
 
 #include <aws/core/AmazonSerializableWebServiceRequest.h>
-#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/SegmentedStreamBuf.h>
 
 using namespace Aws;
 
@@ -15,8 +15,10 @@ std::shared_ptr<Aws::IOStream> AmazonSerializableWebServiceRequest::GetBody() co
 
     if (!payload.empty())
     {
-      payloadBody = Aws::MakeShared<Aws::StringStream>("AmazonSerializableWebServiceRequest");
-      *payloadBody << payload;
+      // The serialized payload is moved into the body rather than copied into a string stream.
+      auto segmentedBody = Aws::MakeShared<Aws::Utils::Stream::SegmentedStream>("AmazonSerializableWebServiceRequest");
+      segmentedBody->Append(std::move(payload));
+      payloadBody = segmentedBody;
     }
 
     return payloadBody;
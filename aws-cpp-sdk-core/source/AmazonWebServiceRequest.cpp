@@ -10,6 +10,10 @@ using namespace Aws;
 
 AmazonWebServiceRequest::AmazonWebServiceRequest() :
     m_responseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod),
+    m_requestPriority(Aws::Utils::AcquirePriority::NORMAL),
+    m_requestCompressionAlgorithm(Aws::Client::CompressionAlgorithm::NONE),
+    m_requestCompressionAlgorithmHasBeenSet(false),
+    m_callDeadline(std::chrono::steady_clock::time_point::max()),
     m_onDataReceived(nullptr),
     m_onDataSent(nullptr),
     m_continueRequest(nullptr),
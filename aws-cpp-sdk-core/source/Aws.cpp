@@ -97,6 +97,7 @@ namespace Aws
         Aws::Http::SetInstallSigPipeHandlerFlag(options.httpOptions.installSigPipeHandler);
         Aws::Http::InitHttp();
         Aws::InitializeEnumOverflowContainer();
+        Aws::InitializeDefaultTimerScheduler();
         cJSON_Hooks hooks;
         hooks.malloc_fn = [](size_t sz) { return Aws::Malloc("cJSON_Tag", sz); };
         hooks.free_fn = Aws::Free;
@@ -112,6 +113,7 @@ namespace Aws
         Aws::Internal::CleanupEC2MetadataClient();
         Aws::Net::CleanupNetwork();
         Aws::CleanupEnumOverflowContainer();
+        Aws::CleanupDefaultTimerScheduler();
         Aws::Http::CleanupHttp();
         Aws::Utils::Crypto::CleanupCrypto();
 
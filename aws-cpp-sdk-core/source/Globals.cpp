@@ -5,6 +5,8 @@
 #include <aws/core/Globals.h>
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/threading/TimerScheduler.h>
+#include <mutex>
 
 namespace Aws
 {
@@ -25,4 +27,29 @@ namespace Aws
     {
         Aws::Delete(g_enumOverflow);
     }
+
+    static const char TIMER_SCHEDULER_TAG[] = "GlobalTimerScheduler";
+    static std::mutex g_timerSchedulerLock;
+    static std::shared_ptr<Utils::Threading::TimerScheduler> g_timerScheduler;
+
+    std::shared_ptr<Utils::Threading::TimerScheduler> GetDefaultTimerScheduler()
+    {
+        std::lock_guard<std::mutex> locker(g_timerSchedulerLock);
+        return g_timerScheduler;
+    }
+
+    void InitializeDefaultTimerScheduler()
+    {
+        std::lock_guard<std::mutex> locker(g_timerSchedulerLock);
+        g_timerScheduler = Aws::MakeShared<Utils::Threading::TimerScheduler>(TIMER_SCHEDULER_TAG);
+    }
+
+    void CleanupDefaultTimerScheduler()
+    {
+        std::shared_ptr<Utils::Threading::TimerScheduler> timerScheduler;
+        {
+            std::lock_guard<std::mutex> locker(g_timerSchedulerLock);
+            timerScheduler.swap(g_timerScheduler);
+        }
+    }
 }
@@ -25,6 +25,8 @@
 #include <iomanip>
 #include <math.h>
 #include <cstring>
+#include <cctype>
+#include <algorithm>
 
 using namespace Aws;
 using namespace Aws::Client;
@@ -69,79 +71,147 @@ namespace Aws
     }
 }
 
-static Aws::String CanonicalizeRequestSigningString(HttpRequest& request, bool urlEscapePath)
+//The signing timestamp in ISO 8601 basic format ("%Y%m%dT%H%M%SZ") starts with the simple date ("%Y%m%d").
+static Aws::String SimpleDateOf(const Aws::String& iso8601BasicTimestamp)
+{
+    return iso8601BasicTimestamp.substr(0, 8);
+}
+
+/**
+ * Builds the method, path and query string lines of the canonical request. reserveForRest is the size of what the caller
+ * appends afterwards (headers, signed headers and payload hash), so the whole canonical request is built in one allocation.
+ */
+static Aws::String CanonicalizeRequestSigningString(HttpRequest& request, bool urlEscapePath, size_t reserveForRest)
 {
     request.CanonicalizeRequest();
-    Aws::StringStream signingStringStream;
-    signingStringStream << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
 
-    URI uriCpy = request.GetUri();
+    const Aws::String& path = request.GetUri().GetPath();
     // Many AWS services do not decode the URL before calculating SignatureV4 on their end.
     // This results in the signature getting calculated with a double encoded URL.
-    // That means we have to double encode it here for the signature to match on the service side.
-    if(urlEscapePath)
-    {
-        // RFC3986 is how we encode the URL before sending it on the wire.
-        auto rfc3986EncodedPath = URI::URLEncodePathRFC3986(uriCpy.GetPath());
-        uriCpy.SetPath(rfc3986EncodedPath);
-        // However, SignatureV4 uses this URL encoding scheme
-        signingStringStream << NEWLINE << uriCpy.GetURLEncodedPath() << NEWLINE;
-    }
-    else
+    // That means we have to double encode it here for the signature to match on the service side:
+    // RFC3986 is how we encode the URL before sending it on the wire, however, SignatureV4 uses URLEncodePath's scheme.
+    // For the services that DO decode the URL first; we don't need to double encode it.
+    Aws::String canonicalPath = urlEscapePath ? URI::URLEncodePath(URI::URLEncodePathRFC3986(path)) : URI::URLEncodePath(path);
+    const bool needsLeadingSlash = canonicalPath.empty() || canonicalPath.front() != '/';
+
+    const char* method = HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
+    const Aws::String& queryString = request.GetQueryString();
+
+    Aws::String signingString;
+    signingString.reserve(strlen(method) + canonicalPath.size() + queryString.size() + 4 + reserveForRest);
+    signingString.append(method);
+    signingString.append(NEWLINE);
+    if (needsLeadingSlash)
     {
-        // For the services that DO decode the URL first; we don't need to double encode it.
-        uriCpy.SetPath(uriCpy.GetURLEncodedPath());
-        signingStringStream << NEWLINE << uriCpy.GetPath() << NEWLINE;
+        signingString.push_back('/');
     }
+    signingString.append(canonicalPath);
+    signingString.append(NEWLINE);
 
-    if (request.GetQueryString().find('=') != std::string::npos)
+    if (queryString.find('=') != std::string::npos)
     {
-        signingStringStream << request.GetQueryString().substr(1) << NEWLINE;
+        signingString.append(queryString, 1, Aws::String::npos);
+        signingString.append(NEWLINE);
     }
-    else if (request.GetQueryString().size() > 1)
+    else if (queryString.size() > 1)
     {
-        signingStringStream << request.GetQueryString().substr(1) << "=" << NEWLINE;
+        signingString.append(queryString, 1, Aws::String::npos);
+        signingString.append("=");
+        signingString.append(NEWLINE);
     }
     else
     {
-        signingStringStream << NEWLINE;
+        signingString.append(NEWLINE);
     }
 
-    return signingStringStream.str();
+    return signingString;
 }
 
-static Http::HeaderValueCollection CanonicalizeHeaders(Http::HeaderValueCollection&& headers)
+static Aws::String CanonicalizeHeaderValue(const Aws::String& value)
 {
-    Http::HeaderValueCollection canonicalHeaders;
-    for (const auto& header : headers)
-    {
-        auto trimmedHeaderName = StringUtils::Trim(header.first.c_str());
-        auto trimmedHeaderValue = StringUtils::Trim(header.second.c_str());
+    auto trimmedHeaderValue = StringUtils::Trim(value.c_str());
 
-        //multiline gets converted to line1,line2,etc...
-        auto headerMultiLine = StringUtils::SplitOnLine(trimmedHeaderValue);
-        Aws::String headerValue = headerMultiLine.size() == 0 ? "" : headerMultiLine[0];
+    //multiline gets converted to line1,line2,etc...
+    auto headerMultiLine = StringUtils::SplitOnLine(trimmedHeaderValue);
+    Aws::String headerValue = headerMultiLine.size() == 0 ? "" : headerMultiLine[0];
 
-        if (headerMultiLine.size() > 1)
+    if (headerMultiLine.size() > 1)
+    {
+        for(size_t i = 1; i < headerMultiLine.size(); ++i)
         {
-            for(size_t i = 1; i < headerMultiLine.size(); ++i)
-            {
-                headerValue += ",";
-                headerValue += StringUtils::Trim(headerMultiLine[i].c_str());
-            }
+            headerValue += ",";
+            headerValue += StringUtils::Trim(headerMultiLine[i].c_str());
         }
+    }
 
-        //duplicate spaces need to be converted to one.
-        Aws::String::iterator new_end =
-            std::unique(headerValue.begin(), headerValue.end(),
-                [=](char lhs, char rhs) { return (lhs == rhs) && (lhs == ' '); }
-        );
-        headerValue.erase(new_end, headerValue.end());
+    //duplicate spaces need to be converted to one.
+    Aws::String::iterator new_end =
+        std::unique(headerValue.begin(), headerValue.end(),
+            [=](char lhs, char rhs) { return (lhs == rhs) && (lhs == ' '); }
+    );
+    headerValue.erase(new_end, headerValue.end());
 
-        canonicalHeaders[trimmedHeaderName] = headerValue;
+    return headerValue;
+}
+
+// Most header values are canonical already: single line, no surrounding whitespace and no duplicate spaces.
+static bool IsCanonicalHeaderValue(const Aws::String& value)
+{
+    if (value.empty())
+    {
+        return true;
+    }
+    if (isspace(static_cast<unsigned char>(value.front())) || isspace(static_cast<unsigned char>(value.back())))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < value.size(); ++i)
+    {
+        if (value[i] == '\n' || value[i] == '\r' || (value[i] == ' ' && i + 1 < value.size() && value[i + 1] == ' '))
+        {
+            return false;
+        }
     }
+    return true;
+}
+
+/**
+ * Appends "name:value" and a new line for each header of request that shouldSign accepts to canonicalHeaders, and "name;" to
+ * signedHeaders. Headers are visited in place, in the order of their names, rather than copied.
+ */
+template<typename SHOULD_SIGN>
+static void AppendCanonicalHeaders(const Http::HttpRequest& request, SHOULD_SIGN shouldSign, Aws::String& canonicalHeaders, Aws::String& signedHeaders)
+{
+    request.ForEachHeader([&](const char* name, const Aws::String& value)
+    {
+        if (!shouldSign(name))
+        {
+            return;
+        }
 
-    return canonicalHeaders;
+        // Header names don't have surrounding whitespace unless a caller put it there.
+        const char* nameEnd = name + strlen(name);
+        while (name < nameEnd && isspace(static_cast<unsigned char>(*name)))
+        {
+            ++name;
+        }
+        while (nameEnd > name && isspace(static_cast<unsigned char>(*(nameEnd - 1))))
+        {
+            --nameEnd;
+        }
+
+        canonicalHeaders.append(name, nameEnd).append(":");
+        if (IsCanonicalHeaderValue(value))
+        {
+            canonicalHeaders.append(value);
+        }
+        else
+        {
+            canonicalHeaders.append(CanonicalizeHeaderValue(value));
+        }
+        canonicalHeaders.append(NEWLINE);
+        signedHeaders.append(name, nameEnd).append(";");
+    });
 }
 
 AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
@@ -168,7 +238,13 @@ AWSAuthV4Signer::~AWSAuthV4Signer()
 
 bool AWSAuthV4Signer::ShouldSignHeader(const Aws::String& header) const
 {
-    return m_unsignedHeaders.find(Aws::Utils::StringUtils::ToLower(header.c_str())) == m_unsignedHeaders.cend();
+    return ShouldSignHeader(header.c_str());
+}
+
+bool AWSAuthV4Signer::ShouldSignHeader(const char* header) const
+{
+    return std::none_of(m_unsignedHeaders.cbegin(), m_unsignedHeaders.cend(),
+        [header](const Aws::String& unsignedHeader) { return StringUtils::CaselessCompare(header, unsignedHeader.c_str()); });
 }
 
 bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, const char* region, bool signBody) const
@@ -225,24 +301,14 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, const char* r
     Aws::String dateHeaderValue = now.ToGmtString(DateFormat::ISO_8601_BASIC);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
+    Aws::String canonicalHeadersString;
+    Aws::String signedHeadersValue;
 
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
+    AppendCanonicalHeaders(request, [this](const char* header) { return ShouldSignHeader(header); }, canonicalHeadersString, signedHeadersValue);
 
-    Aws::String canonicalHeadersString = headersStream.str();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
 
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
+    //remove the last semi-colon of the signed headers parameter
     if (!signedHeadersValue.empty())
     {
         signedHeadersValue.pop_back();
@@ -251,7 +317,8 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, const char* r
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath);
+    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath,
+        canonicalHeadersString.size() + signedHeadersValue.size() + 2 * strlen(NEWLINE) + 64);
 
     //append v4 stuff to the canonical request string.
     canonicalRequestString.append(canonicalHeadersString);
@@ -273,18 +340,17 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, const char* r
 
     auto sha256Digest = hashResult.GetResult();
     Aws::String canonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
-    Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
+    Aws::String simpleDate = SimpleDateOf(dateHeaderValue);
 
     Aws::String signingRegion = region ? region : m_region;
     Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, canonicalRequestHash, signingRegion, m_serviceName);
     auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate, signingRegion, m_serviceName);
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << signingRegion << "/" << m_serviceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << finalSignature;
+    Aws::String awsAuthString(AWS_HMAC_SHA256);
+    awsAuthString.append(" ").append(CREDENTIAL).append(EQ).append(credentials.GetAWSAccessKeyId()).append("/").append(simpleDate)
+        .append("/").append(signingRegion).append("/").append(m_serviceName).append("/").append(AWS4_REQUEST).append(", ")
+        .append(SIGNED_HEADERS).append(EQ).append(signedHeadersValue).append(", ").append(SIGNATURE).append(EQ).append(finalSignature);
 
-    auto awsAuthString = ss.str();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
     request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
@@ -326,23 +392,13 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char
     Aws::String dateQueryValue = now.ToGmtString(DateFormat::ISO_8601_BASIC);
     request.AddQueryStringParameter(Http::AWS_DATE_HEADER, dateQueryValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
+    Aws::String canonicalHeadersString;
+    Aws::String signedHeadersValue;
+    AppendCanonicalHeaders(request, [this](const char* header) { return ShouldSignHeader(header); }, canonicalHeadersString, signedHeadersValue);
 
-    Aws::String canonicalHeadersString = headersStream.str();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
 
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue(signedHeadersStream.str());
-    //remove that last semi-colon
+    //remove the last semi-colon of the signed headers parameter
     if (!signedHeadersValue.empty())
     {
         signedHeadersValue.pop_back();
@@ -351,22 +407,22 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char
     request.AddQueryStringParameter(X_AMZ_SIGNED_HEADERS, signedHeadersValue);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value: " << signedHeadersValue);
 
-    Aws::StringStream ss;
     Aws::String signingRegion = region ? region : m_region;
     Aws::String signingServiceName = serviceName ? serviceName : m_serviceName;
-    Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
-    ss << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << signingRegion << "/" << signingServiceName << "/" << AWS4_REQUEST;
+    Aws::String simpleDate = SimpleDateOf(dateQueryValue);
+    Aws::String credential(credentials.GetAWSAccessKeyId());
+    credential.append("/").append(simpleDate).append("/").append(signingRegion).append("/").append(signingServiceName)
+        .append("/").append(AWS4_REQUEST);
 
     request.AddQueryStringParameter(X_AMZ_ALGORITHM, AWS_HMAC_SHA256);
-    request.AddQueryStringParameter(X_AMZ_CREDENTIAL, ss.str());
-    ss.str("");
+    request.AddQueryStringParameter(X_AMZ_CREDENTIAL, credential);
 
     request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
     request.SetSigningRegion(signingRegion);
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath);
+    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath,
+        canonicalHeadersString.size() + signedHeadersValue.size() + 2 * strlen(NEWLINE) + 64);
 
     //append v4 stuff to the canonical request string.
     canonicalRequestString.append(canonicalHeadersString);
@@ -430,8 +486,6 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const Aws::String& stringToSign,
 {
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Final String to sign: " << stringToSign);
 
-    Aws::StringStream ss;
-
     auto hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), key);
     if (!hashResult.IsSuccess())
     {
@@ -483,12 +537,13 @@ Aws::String AWSAuthV4Signer::GenerateStringToSign(const Aws::String& dateValue,
         const Aws::String& canonicalRequestHash, const Aws::String& region, const Aws::String& serviceName) const
 {
     //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
+    Aws::String stringToSign;
+    stringToSign.reserve(strlen(AWS_HMAC_SHA256) + dateValue.size() + simpleDate.size() + region.size() + serviceName.size()
+        + strlen(AWS4_REQUEST) + canonicalRequestHash.size() + 8);
+    stringToSign.append(AWS_HMAC_SHA256).append(NEWLINE).append(dateValue).append(NEWLINE).append(simpleDate).append("/")
+        .append(region).append("/").append(serviceName).append("/").append(AWS4_REQUEST).append(NEWLINE).append(canonicalRequestHash);
 
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << region << "/"
-        << serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
-
-    return ss.str();
+    return stringToSign;
 }
 
 Aws::Utils::ByteBuffer AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey,
@@ -565,24 +620,14 @@ bool AWSAuthEventStreamV4Signer::SignRequest(Aws::Http::HttpRequest& request, co
     Aws::String dateHeaderValue = now.ToGmtString(DateFormat::ISO_8601_BASIC);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
+    Aws::String canonicalHeadersString;
+    Aws::String signedHeadersValue;
 
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
+    AppendCanonicalHeaders(request, [this](const char* header) { return ShouldSignHeader(header); }, canonicalHeadersString, signedHeadersValue);
 
-    Aws::String canonicalHeadersString = headersStream.str();
     AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Canonical Header String: " << canonicalHeadersString);
 
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
+    //remove the last semi-colon of the signed headers parameter
     if (!signedHeadersValue.empty())
     {
         signedHeadersValue.pop_back();
@@ -591,7 +636,8 @@ bool AWSAuthEventStreamV4Signer::SignRequest(Aws::Http::HttpRequest& request, co
     AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Signed Headers value:" << signedHeadersValue);
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, true/* m_urlEscapePath */);
+    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, true/* m_urlEscapePath */,
+        canonicalHeadersString.size() + signedHeadersValue.size() + 2 * strlen(NEWLINE) + 64);
 
     //append v4 stuff to the canonical request string.
     canonicalRequestString.append(canonicalHeadersString);
@@ -613,18 +659,17 @@ bool AWSAuthEventStreamV4Signer::SignRequest(Aws::Http::HttpRequest& request, co
 
     auto sha256Digest = hashResult.GetResult();
     Aws::String canonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
-    Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
+    Aws::String simpleDate = SimpleDateOf(dateHeaderValue);
 
     Aws::String signingRegion = region ? region : m_region;
     Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, canonicalRequestHash, signingRegion, m_serviceName);
     auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate, signingRegion, m_serviceName);
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << signingRegion << "/" << m_serviceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << HashingUtils::HexEncode(finalSignature);
+    Aws::String awsAuthString(AWS_HMAC_SHA256);
+    awsAuthString.append(" ").append(CREDENTIAL).append(EQ).append(credentials.GetAWSAccessKeyId()).append("/").append(simpleDate)
+        .append("/").append(signingRegion).append("/").append(m_serviceName).append("/").append(AWS4_REQUEST).append(", ")
+        .append(SIGNED_HEADERS).append(EQ).append(signedHeadersValue).append(", ").append(SIGNATURE).append(EQ).append(HashingUtils::HexEncode(finalSignature));
 
-    auto awsAuthString = ss.str();
     AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
     request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
@@ -710,7 +755,13 @@ bool AWSAuthEventStreamV4Signer::SignEventMessage(Event::Message& message, Aws::
 
 bool AWSAuthEventStreamV4Signer::ShouldSignHeader(const Aws::String& header) const
 {
-    return std::find(m_unsignedHeaders.cbegin(), m_unsignedHeaders.cend(), Aws::Utils::StringUtils::ToLower(header.c_str())) == m_unsignedHeaders.cend();
+    return ShouldSignHeader(header.c_str());
+}
+
+bool AWSAuthEventStreamV4Signer::ShouldSignHeader(const char* header) const
+{
+    return std::none_of(m_unsignedHeaders.cbegin(), m_unsignedHeaders.cend(),
+        [header](const Aws::String& unsignedHeader) { return StringUtils::CaselessCompare(header, unsignedHeader.c_str()); });
 }
 
 Utils::ByteBuffer AWSAuthEventStreamV4Signer::GenerateSignature(const AWSCredentials& credentials, const Aws::String& stringToSign,
@@ -737,8 +788,6 @@ Utils::ByteBuffer AWSAuthEventStreamV4Signer::GenerateSignature(const Aws::Strin
 {
     AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Final String to sign: " << stringToSign);
 
-    Aws::StringStream ss;
-
     auto hashResult = m_HMAC.Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), key);
     if (!hashResult.IsSuccess())
     {
@@ -754,12 +803,13 @@ Aws::String AWSAuthEventStreamV4Signer::GenerateStringToSign(const Aws::String&
         const Aws::String& canonicalRequestHash, const Aws::String& region, const Aws::String& serviceName) const
 {
     //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
-
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << region << "/"
-        << serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
+    Aws::String stringToSign;
+    stringToSign.reserve(strlen(AWS_HMAC_SHA256) + dateValue.size() + simpleDate.size() + region.size() + serviceName.size()
+        + strlen(AWS4_REQUEST) + canonicalRequestHash.size() + 8);
+    stringToSign.append(AWS_HMAC_SHA256).append(NEWLINE).append(dateValue).append(NEWLINE).append(simpleDate).append("/")
+        .append(region).append("/").append(serviceName).append("/").append(AWS4_REQUEST).append(NEWLINE).append(canonicalRequestHash);
 
-    return ss.str();
+    return stringToSign;
 }
 
 Aws::Utils::ByteBuffer AWSAuthEventStreamV4Signer::ComputeHash(const Aws::String& secretKey,
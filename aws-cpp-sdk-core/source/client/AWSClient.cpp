@@ -9,6 +9,7 @@
 #include <aws/core/auth/AWSAuthSignerProvider.h>
 #include <aws/core/client/AWSError.h>
 #include <aws/core/client/AWSErrorMarshaller.h>
+#include <aws/core/client/CircuitBreaker.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/client/CoreErrors.h>
 #include <aws/core/client/RetryStrategy.h>
@@ -18,10 +19,13 @@
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/http/URI.h>
 #include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/stream/SegmentedStreamBuf.h>
+#include <aws/core/utils/stream/FileBodyStreamBuf.h>
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/Globals.h>
@@ -31,11 +35,17 @@
 #include <aws/core/utils/crypto/Factories.h>
 #include <aws/core/utils/event/EventStream.h>
 #include <aws/core/utils/UUID.h>
+#include <aws/core/utils/Probes.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/TimerScheduler.h>
 #include <aws/core/monitoring/MonitoringManager.h>
+#include <aws/core/monitoring/RequestTiming.h>
 #include <aws/core/Region.h>
 
 #include <cstring>
 #include <cassert>
+#include <condition_variable>
+#include <mutex>
 
 using namespace Aws;
 using namespace Aws::Client;
@@ -53,6 +63,36 @@ static const std::chrono::milliseconds TIME_DIFF_MAX = std::chrono::minutes(4);
 //-4 Minutes
 static const std::chrono::milliseconds TIME_DIFF_MIN = std::chrono::minutes(-4);
 
+/**
+ * Async calls of a client whose next attempt is waiting for its backoff, or running on the executor. The client cancels
+ * the first and waits for the second before it is destroyed, the retries share this with it.
+ */
+struct AWSClient::AsyncRetries
+{
+    AsyncRetries() : running(0), shutdown(false) {}
+
+    bool IsShutdown()
+    {
+        std::lock_guard<std::mutex> locker(lock);
+        return shutdown;
+    }
+
+    void Release()
+    {
+        std::lock_guard<std::mutex> locker(lock);
+        if (--running == 0)
+        {
+            signal.notify_all();
+        }
+    }
+
+    std::mutex lock;
+    std::condition_variable signal;
+    Aws::Set<Aws::Utils::Threading::TimerScheduler::TimerId> timers;
+    size_t running;
+    bool shutdown;
+};
+
 static CoreErrors GuessBodylessErrorType(Aws::Http::HttpResponseCode responseCode)
 {
     switch (responseCode)
@@ -93,7 +133,7 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     const std::shared_ptr<Aws::Client::AWSAuthSigner>& signer,
     const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller) :
     m_region(configuration.region),
-    m_httpClient(CreateHttpClient(configuration)),
+    m_httpClient(configuration.httpClient ? configuration.httpClient : CreateHttpClient(configuration)),
     m_signerProvider(Aws::MakeUnique<Aws::Auth::DefaultAuthSignerProvider>(AWS_CLIENT_LOG_TAG, signer)),
     m_errorMarshaller(errorMarshaller),
     m_retryStrategy(configuration.retryStrategy),
@@ -102,7 +142,15 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
     m_requestTimeoutMs(configuration.requestTimeoutMs),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_requestTracer(configuration.requestTracer),
+    m_enableRequestTiming(configuration.enableRequestTiming || configuration.requestTracer),
+    m_executor(configuration.executor),
+    m_retryScheduler(configuration.retryScheduler ? configuration.retryScheduler : Aws::GetDefaultTimerScheduler()),
+    m_asyncRetries(Aws::MakeShared<AsyncRetries>(AWS_CLIENT_LOG_TAG)),
+    m_circuitBreaker(configuration.circuitBreaker),
+    m_requestCompressionAlgorithm(configuration.requestCompressionAlgorithm),
+    m_requestMinCompressionSizeBytes(configuration.requestMinCompressionSizeBytes)
 {
 }
 
@@ -110,7 +158,7 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
     const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller) :
     m_region(configuration.region),
-    m_httpClient(CreateHttpClient(configuration)),
+    m_httpClient(configuration.httpClient ? configuration.httpClient : CreateHttpClient(configuration)),
     m_signerProvider(signerProvider),
     m_errorMarshaller(errorMarshaller),
     m_retryStrategy(configuration.retryStrategy),
@@ -119,8 +167,38 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
     m_requestTimeoutMs(configuration.requestTimeoutMs),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_requestTracer(configuration.requestTracer),
+    m_enableRequestTiming(configuration.enableRequestTiming || configuration.requestTracer),
+    m_executor(configuration.executor),
+    m_retryScheduler(configuration.retryScheduler ? configuration.retryScheduler : Aws::GetDefaultTimerScheduler()),
+    m_asyncRetries(Aws::MakeShared<AsyncRetries>(AWS_CLIENT_LOG_TAG)),
+    m_circuitBreaker(configuration.circuitBreaker),
+    m_requestCompressionAlgorithm(configuration.requestCompressionAlgorithm),
+    m_requestMinCompressionSizeBytes(configuration.requestMinCompressionSizeBytes)
+{
+}
+
+AWSClient::~AWSClient()
 {
+    ShutdownAsyncRetries();
+}
+
+void AWSClient::ShutdownAsyncRetries()
+{
+    std::unique_lock<std::mutex> locker(m_asyncRetries->lock);
+    m_asyncRetries->shutdown = true;
+    Aws::Vector<Aws::Utils::Threading::TimerScheduler::TimerId> timers(m_asyncRetries->timers.begin(), m_asyncRetries->timers.end());
+    locker.unlock();
+
+    // Cancelled retries end their call with the last error on the executor, waited for below.
+    for (const auto id : timers)
+    {
+        m_retryScheduler->Cancel(id);
+    }
+
+    locker.lock();
+    m_asyncRetries->signal.wait(locker, [this] { return m_asyncRetries->running == 0; });
 }
 
 void AWSClient::DisableRequestProcessing()
@@ -193,86 +271,316 @@ bool AWSClient::AdjustClockSkew(HttpResponseOutcome& outcome, const char* signer
     return false;
 }
 
-HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    HttpMethod method,
-    const char* signerName,
-    const char* signerRegionOverride) const
+static void AddHttpClientSpans(Aws::Monitoring::RequestTiming& requestTiming, const Aws::Monitoring::HttpClientMetricsCollection& httpClientMetrics,
+    std::chrono::steady_clock::time_point transferStartTime)
 {
-    std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
+    using namespace Aws::Monitoring;
+    // Http clients report these phases as durations in milliseconds, they happen one after the other.
+    static const std::pair<Aws::String, RequestPhase> httpClientPhases[] = {
+        std::make_pair(GetHttpClientMetricNameByType(HttpClientMetricsType::AcquireConnectionLatency), RequestPhase::ConnectionAcquisition),
+        std::make_pair(GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency), RequestPhase::DnsLookup),
+        std::make_pair(GetHttpClientMetricNameByType(HttpClientMetricsType::TcpLatency), RequestPhase::TcpConnect),
+        std::make_pair(GetHttpClientMetricNameByType(HttpClientMetricsType::TlsHandshakeLatency), RequestPhase::TlsHandshake),
+        std::make_pair(GetHttpClientMetricNameByType(HttpClientMetricsType::TimeToFirstByteLatency), RequestPhase::TimeToFirstByte),
+        std::make_pair(GetHttpClientMetricNameByType(HttpClientMetricsType::ResponseTransferLatency), RequestPhase::ResponseTransfer)
+    };
+
+    auto startTime = transferStartTime;
+    for (const auto& httpClientPhase : httpClientPhases)
+    {
+        auto metric = httpClientMetrics.find(httpClientPhase.first);
+        if (metric != httpClientMetrics.end())
+        {
+            std::chrono::microseconds duration = std::chrono::milliseconds(metric->second);
+            requestTiming.AddSpan(httpClientPhase.second, startTime, duration);
+            startTime += duration;
+        }
+    }
+}
+
+static void AttachRequestTiming(HttpResponseOutcome& outcome, const std::shared_ptr<Aws::Monitoring::RequestTiming>& requestTiming)
+{
+    if (!requestTiming)
+    {
+        return;
+    }
+    if (outcome.IsSuccess())
+    {
+        outcome.GetResult()->SetRequestTiming(requestTiming);
+        return;
+    }
+    AWSError<CoreErrors> error(outcome.GetErrorWithOwnership());
+    error.SetRequestTiming(requestTiming);
+    outcome = std::move(error);
+}
+
+template<typename PAYLOAD_TYPE>
+static AmazonWebServiceResult<PAYLOAD_TYPE> WithRequestTiming(AmazonWebServiceResult<PAYLOAD_TYPE>&& result,
+    const std::shared_ptr<Aws::Monitoring::RequestTiming>& requestTiming)
+{
+    result.SetRequestTiming(requestTiming);
+    return std::move(result);
+}
+
+static AWSError<CoreErrors> WithRequestTiming(AWSError<CoreErrors>&& error, const std::shared_ptr<Aws::Monitoring::RequestTiming>& requestTiming)
+{
+    error.SetRequestTiming(requestTiming);
+    return std::move(error);
+}
+
+static void AddRetryDelaySpan(const std::shared_ptr<Aws::Monitoring::RequestTiming>& requestTiming, std::chrono::steady_clock::time_point sleepStartTime)
+{
+    if (requestTiming)
+    {
+        requestTiming->AddSpan(Aws::Monitoring::RequestPhase::RetryDelay, sleepStartTime);
+    }
+}
+
+static void AddResponseParsingSpan(const std::shared_ptr<Aws::Monitoring::RequestTiming>& requestTiming, std::chrono::steady_clock::time_point parseStartTime)
+{
+    if (requestTiming)
+    {
+        requestTiming->AddSpan(Aws::Monitoring::RequestPhase::ResponseParsing, parseStartTime);
+    }
+}
+
+struct AWSClient::RetryContext
+{
+    // Null for payloadless requests, only named by requestName.
+    const Aws::AmazonWebServiceRequest* request;
+    const char* requestName;
+    // steady_clock::time_point::max() for calls without a deadline.
+    std::chrono::steady_clock::time_point deadline;
+    std::shared_ptr<HttpRequest> httpRequest;
     HttpResponseOutcome outcome;
     AWSError<CoreErrors> lastError;
     Aws::Monitoring::CoreMetricsCollection coreMetrics;
-    auto contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest);
-    const char* signerRegion = signerRegionOverride;
+    Aws::Vector<void*> contexts;
+    const char* signerRegion;
     Aws::String regionFromResponse;
-
-    Aws::String invocationId = UUID::RandomUUID();
+    DateTime serverTime;
+    std::chrono::milliseconds clockSkew;
+    Aws::String invocationId;
     RequestInfo requestInfo;
-    requestInfo.attempt = 1;
-    requestInfo.maxAttempts = 0;
-    httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, invocationId);
-    httpRequest->SetHeaderValue(Http::SDK_REQUEST_HEADER, requestInfo);
+    std::shared_ptr<Aws::Monitoring::RequestTiming> requestTiming;
+    long retries;
+    std::chrono::steady_clock::time_point attemptStartTime;
+    Aws::String circuitName;
+    // False when the last attempt was refused without being sent, the call then ends with its outcome.
+    bool attemptSent;
+};
 
-    for (long retries = 0;; retries++)
+struct AWSClient::AsyncRetryContext : public AWSClient::RetryContext
+{
+    AsyncRetryContext(const Aws::Http::URI& uri, const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request, HttpMethod method,
+                      const char* signerName, const char* signerRegionOverride, const HttpResponseOutcomeHandler& handler) :
+        uri(uri), sharedRequest(request), method(method), signerName(signerName),
+        signerRegionOverride(signerRegionOverride ? signerRegionOverride : ""), hasSignerRegionOverride(signerRegionOverride != nullptr),
+        handler(handler), retryTimer(0)
+    {}
+
+    Aws::Http::URI uri;
+    // Keeps RetryContext::request alive.
+    std::shared_ptr<const Aws::AmazonWebServiceRequest> sharedRequest;
+    HttpMethod method;
+    // Copies, the caller's strings may not outlive the first attempt.
+    Aws::String signerName;
+    Aws::String signerRegionOverride;
+    bool hasSignerRegionOverride;
+    HttpResponseOutcomeHandler handler;
+    // Timer of the scheduled retry, guarded by AsyncRetries::lock.
+    Aws::Utils::Threading::TimerScheduler::TimerId retryTimer;
+};
+
+/**
+ * Gives back the probe slot of an attempt the circuit breaker allowed if its outcome is not counted, e.g. when the attempt
+ * throws, so that a half open circuit doesn't wait for a probe that will never finish.
+ */
+class CircuitBreakerAttempt
+{
+public:
+    CircuitBreakerAttempt(CircuitBreaker* circuitBreaker, const Aws::String& circuitName) :
+        m_circuitBreaker(circuitBreaker), m_circuitName(circuitName)
+    {}
+
+    ~CircuitBreakerAttempt()
     {
-        m_retryStrategy->GetSendToken();
-        outcome = AttemptOneRequest(httpRequest, request, signerName, signerRegion);
-        if (retries == 0)
-        {
-            m_retryStrategy->RequestBookkeeping(outcome);
-        }
-        else
-        {
-            m_retryStrategy->RequestBookkeeping(outcome, lastError);
-        }
-        coreMetrics.httpClientMetrics = httpRequest->GetRequestMetrics();
-        if (outcome.IsSuccess())
+        if (m_circuitBreaker)
         {
-            Aws::Monitoring::OnRequestSucceeded(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, outcome, coreMetrics, contexts);
-            AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request successful returning.");
-            break;
+            m_circuitBreaker->OnAttemptAbandoned(m_circuitName);
         }
-        lastError = outcome.GetError();
+    }
 
-        DateTime serverTime = GetServerTimeFromError(outcome.GetError());
-        auto clockSkew = DateTime::Diff(serverTime, DateTime::Now());
+    void Finish(const char* serviceName, const HttpResponseOutcome& outcome)
+    {
+        CircuitBreaker* circuitBreaker = m_circuitBreaker;
+        m_circuitBreaker = nullptr;
+        circuitBreaker->OnAttemptFinished(serviceName ? serviceName : "", m_circuitName,
+            !outcome.IsSuccess() && circuitBreaker->IsFailure(outcome.GetError()));
+    }
 
-        Aws::Monitoring::OnRequestFailed(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, outcome, coreMetrics, contexts);
+private:
+    CircuitBreaker* m_circuitBreaker;
+    const Aws::String& m_circuitName;
+};
 
-        if (!m_httpClient->IsRequestProcessingEnabled())
+void AWSClient::InitRetryContext(RetryContext& context, const Aws::Http::URI& uri, const Aws::AmazonWebServiceRequest* request,
+    const char* requestName, HttpMethod method, const char* signerRegionOverride) const
+{
+    context.request = request;
+    context.requestName = request ? request->GetServiceRequestName() : requestName;
+    context.deadline = request ? request->GetCallDeadline() : (std::chrono::steady_clock::time_point::max)();
+    context.httpRequest = CreateHttpRequest(uri, method, GetResponseStreamFactory(context));
+    context.contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), context.requestName, context.httpRequest);
+    context.signerRegion = signerRegionOverride;
+    context.clockSkew = std::chrono::milliseconds(0);
+    context.retries = 0;
+    context.attemptSent = false;
+
+    context.invocationId = UUID::RandomUUID();
+    context.requestInfo.attempt = 1;
+    context.requestInfo.maxAttempts = 0;
+    context.httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, context.invocationId);
+    context.httpRequest->SetHeaderValue(Http::SDK_REQUEST_HEADER, context.requestInfo);
+    if (m_enableRequestTiming)
+    {
+        context.requestTiming = Aws::MakeShared<Aws::Monitoring::RequestTiming>(AWS_CLIENT_LOG_TAG,
+            GetServiceClientName() ? GetServiceClientName() : "", context.requestName, context.invocationId, m_requestTracer);
+    }
+}
+
+Aws::IOStreamFactory AWSClient::GetResponseStreamFactory(const RetryContext& context)
+{
+    return context.request ? context.request->GetResponseStreamFactory() : Aws::IOStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+}
+
+void AWSClient::AttemptOnce(RetryContext& context, const char* signerName) const
+{
+    context.attemptStartTime = std::chrono::steady_clock::now();
+    context.attemptSent = false;
+    if (context.attemptStartTime >= context.deadline)
+    {
+        AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "The deadline of the call passed, not sending the request.");
+        context.outcome = AWSError<CoreErrors>(CoreErrors::REQUEST_TIMEOUT, "RequestTimeout", "The deadline of the call passed before the request was sent", false/*retryable*/);
+        return;
+    }
+
+    if (m_circuitBreaker)
+    {
+        context.circuitName = m_circuitBreaker->GetCircuitName(context.httpRequest->GetUri().GetAuthority(), context.requestName);
+        if (!m_circuitBreaker->AllowAttempt(GetServiceClientName() ? GetServiceClientName() : "", context.circuitName))
         {
-            AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request was cancelled externally.");
-            break;
+            AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Circuit " << context.circuitName << " is open, not sending the request.");
+            context.outcome = AWSError<CoreErrors>(CoreErrors::SERVICE_UNAVAILABLE, "CircuitBreakerOpen",
+                "Too many recent attempts to " + context.circuitName + " failed, the request was not sent", false/*retryable*/);
+            return;
         }
+    }
+    CircuitBreakerAttempt circuitBreakerAttempt(m_circuitBreaker.get(), context.circuitName);
 
-        // Adjust region
-        bool retryWithCorrectRegion = false;
-        HttpResponseCode httpResponseCode = outcome.GetError().GetResponseCode();
-        if (httpResponseCode == HttpResponseCode::MOVED_PERMANENTLY ||  // 301
-            httpResponseCode == HttpResponseCode::TEMPORARY_REDIRECT || // 307
-            httpResponseCode == HttpResponseCode::BAD_REQUEST ||        // 400
-            httpResponseCode == HttpResponseCode::FORBIDDEN)            // 403
+    context.attemptSent = true;
+    m_retryStrategy->GetSendToken();
+    if (context.requestTiming)
+    {
+        context.requestTiming->StartAttempt();
+    }
+    if (context.request)
+    {
+        context.outcome = AttemptOneRequest(context.httpRequest, *context.request, signerName, context.signerRegion, context.requestTiming.get());
+    }
+    else
+    {
+        // BuildHttpRequest sets it on the others.
+        context.httpRequest->SetDeadline(context.deadline);
+        context.outcome = AttemptOneRequest(context.httpRequest, signerName, context.requestName, context.signerRegion, context.requestTiming.get());
+    }
+    if (m_circuitBreaker)
+    {
+        circuitBreakerAttempt.Finish(GetServiceClientName(), context.outcome);
+    }
+    if (context.retries == 0)
+    {
+        m_retryStrategy->RequestBookkeeping(context.outcome);
+    }
+    else
+    {
+        m_retryStrategy->RequestBookkeeping(context.outcome, context.lastError);
+    }
+    context.coreMetrics.httpClientMetrics = context.httpRequest->GetRequestMetrics();
+    if (context.outcome.IsSuccess())
+    {
+        Aws::Monitoring::OnRequestSucceeded(this->GetServiceClientName(), context.requestName, context.httpRequest, context.outcome, context.coreMetrics, context.contexts);
+        AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request successful returning.");
+    }
+}
+
+bool AWSClient::PrepareRetry(RetryContext& context, const char* signerName, long& sleepMillis, bool& shouldSleep) const
+{
+    HttpResponseOutcome& outcome = context.outcome;
+    context.lastError = outcome.GetError();
+
+    context.serverTime = GetServerTimeFromError(outcome.GetError());
+    context.clockSkew = DateTime::Diff(context.serverTime, DateTime::Now());
+
+    Aws::Monitoring::OnRequestFailed(this->GetServiceClientName(), context.requestName, context.httpRequest, outcome, context.coreMetrics, context.contexts);
+
+    if (!m_httpClient->IsRequestProcessingEnabled())
+    {
+        AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request was cancelled externally.");
+        return false;
+    }
+
+    // Adjust region
+    bool retryWithCorrectRegion = false;
+    HttpResponseCode httpResponseCode = outcome.GetError().GetResponseCode();
+    if (httpResponseCode == HttpResponseCode::MOVED_PERMANENTLY ||  // 301
+        httpResponseCode == HttpResponseCode::TEMPORARY_REDIRECT || // 307
+        httpResponseCode == HttpResponseCode::BAD_REQUEST ||        // 400
+        httpResponseCode == HttpResponseCode::FORBIDDEN)            // 403
+    {
+        context.regionFromResponse = GetErrorMarshaller()->ExtractRegion(outcome.GetError());
+        if (m_region == Aws::Region::AWS_GLOBAL && !context.regionFromResponse.empty() && context.regionFromResponse != context.signerRegion)
         {
-            regionFromResponse = GetErrorMarshaller()->ExtractRegion(outcome.GetError());
-            if (m_region == Aws::Region::AWS_GLOBAL && !regionFromResponse.empty() && regionFromResponse != signerRegion)
-            {
-                signerRegion = regionFromResponse.c_str();
-                retryWithCorrectRegion = true;
-            }
+            context.signerRegion = context.regionFromResponse.c_str();
+            retryWithCorrectRegion = true;
         }
+    }
+
+    sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), context.retries);
+    //AdjustClockSkew returns true means clock skew was the problem and skew was adjusted, false otherwise.
+    //sleep if clock skew and region was NOT the problem. AdjustClockSkew may update error inside outcome.
+    shouldSleep = !AdjustClockSkew(outcome, signerName) && !retryWithCorrectRegion;
 
-        long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
-        //AdjustClockSkew returns true means clock skew was the problem and skew was adjusted, false otherwise.
-        //sleep if clock skew and region was NOT the problem. AdjustClockSkew may update error inside outcome.
-        bool shouldSleep = !AdjustClockSkew(outcome, signerName) && !retryWithCorrectRegion;
+    bool shouldRetry = retryWithCorrectRegion || m_retryStrategy->ShouldRetry(outcome.GetError(), context.retries);
+    AWS_SDK_PROBE5(retry__decision, context.httpRequest.get(), context.retries, static_cast<int>(outcome.GetError().GetErrorType()),
+        static_cast<int>(shouldRetry), sleepMillis);
+    if (!shouldRetry)
+    {
+        return false;
+    }
+
+    if (m_circuitBreaker && m_circuitBreaker->GetState(context.circuitName) == CircuitState::OPEN)
+    {
+        AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, not retrying as circuit " << context.circuitName << " is open.");
+        return false;
+    }
 
-        if (!retryWithCorrectRegion && !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
+    if (context.deadline != (std::chrono::steady_clock::time_point::max)())
+    {
+        // The next attempt is assumed to take as long as the last one did.
+        const auto now = std::chrono::steady_clock::now();
+        const auto nextAttemptEnd = now + std::chrono::milliseconds(shouldSleep ? sleepMillis : 0) + (now - context.attemptStartTime);
+        if (nextAttemptEnd > context.deadline)
         {
-            break;
+            AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, not retrying as another attempt would not finish before the deadline of the call.");
+            return false;
         }
+    }
 
-        AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
+    AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
+    if (context.request)
+    {
+        const Aws::AmazonWebServiceRequest& request = *context.request;
         if(request.GetBody())
         {
             request.GetBody()->clear();
@@ -283,140 +591,233 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
         {
             request.GetRequestRetryHandler()(request);
         }
+    }
+    return true;
+}
 
-        if (shouldSleep)
-        {
-            m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
-        }
-
-        Aws::Http::URI newUri(uri.GetURIString());
-        Aws::String newEndpoint = GetErrorMarshaller()->ExtractEndpoint(outcome.GetError());
-        if (!newEndpoint.empty())
-        {
-            newUri.SetAuthority(newEndpoint);
-        }
-        httpRequest = CreateHttpRequest(newUri, method, request.GetResponseStreamFactory());
+void AWSClient::PrepareNextAttempt(RetryContext& context, const Aws::Http::URI& uri, HttpMethod method) const
+{
+    Aws::Http::URI newUri(uri.GetURIString());
+    Aws::String newEndpoint = GetErrorMarshaller()->ExtractEndpoint(context.outcome.GetError());
+    if (!newEndpoint.empty())
+    {
+        newUri.SetAuthority(newEndpoint);
+    }
+    auto previousRequest = context.httpRequest;
+    context.httpRequest = CreateHttpRequest(newUri, method, GetResponseStreamFactory(context));
+    if (previousRequest->HasHeader(Http::CONTENT_ENCODING_HEADER))
+    {
+        // Handed over so that a body compressed by the previous attempt is not compressed again, see CompressRequestBody.
+        context.httpRequest->AddContentBody(previousRequest->GetContentBody());
+        context.httpRequest->SetHeaderValue(Http::CONTENT_ENCODING_HEADER, previousRequest->GetHeaderValue(Http::CONTENT_ENCODING_HEADER));
+    }
 
-        httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, invocationId);
-        if (serverTime.WasParseSuccessful() && serverTime != DateTime())
-        {
-            requestInfo.ttl = DateTime::Now() + clockSkew + std::chrono::milliseconds(m_requestTimeoutMs);
-        }
-        requestInfo.attempt ++;
-        requestInfo.maxAttempts = m_retryStrategy->GetMaxAttempts();
-        httpRequest->SetHeaderValue(Http::SDK_REQUEST_HEADER, requestInfo);
-        Aws::Monitoring::OnRequestRetry(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, contexts);
+    context.httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, context.invocationId);
+    if (context.serverTime.WasParseSuccessful() && context.serverTime != DateTime())
+    {
+        context.requestInfo.ttl = DateTime::Now() + context.clockSkew + std::chrono::milliseconds(m_requestTimeoutMs);
     }
-    Aws::Monitoring::OnFinish(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, contexts);
-    return outcome;
+    context.requestInfo.attempt ++;
+    context.requestInfo.maxAttempts = m_retryStrategy->GetMaxAttempts();
+    context.httpRequest->SetHeaderValue(Http::SDK_REQUEST_HEADER, context.requestInfo);
+    Aws::Monitoring::OnRequestRetry(this->GetServiceClientName(), context.requestName, context.httpRequest, context.contexts);
+    context.retries++;
+}
+
+void AWSClient::FinishAttempts(RetryContext& context) const
+{
+    Aws::Monitoring::OnFinish(this->GetServiceClientName(), context.requestName, context.httpRequest, context.contexts);
+    AttachRequestTiming(context.outcome, context.requestTiming);
 }
 
 HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
     HttpMethod method,
     const char* signerName,
-    const char* requestName,
     const char* signerRegionOverride) const
 {
-    std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
-    HttpResponseOutcome outcome;
-    AWSError<CoreErrors> lastError;
-    Aws::Monitoring::CoreMetricsCollection coreMetrics;
-    auto contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), requestName, httpRequest);
-    const char* signerRegion = signerRegionOverride;
-    Aws::String regionFromResponse;
+    RetryContext context;
+    InitRetryContext(context, uri, &request, nullptr, method, signerRegionOverride);
+    return Attempt(context, uri, method, signerName);
+}
 
-    Aws::String invocationId = UUID::RandomUUID();
-    RequestInfo requestInfo;
-    requestInfo.attempt = 1;
-    requestInfo.maxAttempts = 0;
-    httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, invocationId);
-    httpRequest->SetHeaderValue(Http::SDK_REQUEST_HEADER, requestInfo);
+HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
+    HttpMethod method,
+    const char* signerName,
+    const char* requestName,
+    const char* signerRegionOverride,
+    std::chrono::steady_clock::time_point callDeadline) const
+{
+    RetryContext context;
+    InitRetryContext(context, uri, nullptr, requestName, method, signerRegionOverride);
+    context.deadline = callDeadline;
+    return Attempt(context, uri, method, signerName);
+}
 
-    for (long retries = 0;; retries++)
+HttpResponseOutcome AWSClient::Attempt(RetryContext& context, const Aws::Http::URI& uri, HttpMethod method, const char* signerName) const
+{
+    for (;;)
     {
-        m_retryStrategy->GetSendToken();
-        outcome = AttemptOneRequest(httpRequest, signerName, signerRegion);
-        if (retries == 0)
+        AttemptOnce(context, signerName);
+        if (context.outcome.IsSuccess() || !context.attemptSent)
         {
-            m_retryStrategy->RequestBookkeeping(outcome);
-        }
-        else
-        {
-            m_retryStrategy->RequestBookkeeping(outcome, lastError);
+            break;
         }
-        coreMetrics.httpClientMetrics = httpRequest->GetRequestMetrics();
-        if (outcome.IsSuccess())
+
+        long sleepMillis = 0;
+        bool shouldSleep = false;
+        if (!PrepareRetry(context, signerName, sleepMillis, shouldSleep))
         {
-            Aws::Monitoring::OnRequestSucceeded(this->GetServiceClientName(), requestName, httpRequest, outcome, coreMetrics, contexts);
-            AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request successful returning.");
             break;
         }
-        lastError = outcome.GetError();
 
-        DateTime serverTime = GetServerTimeFromError(outcome.GetError());
-        auto clockSkew = DateTime::Diff(serverTime, DateTime::Now());
+        if (shouldSleep)
+        {
+            auto sleepStartTime = std::chrono::steady_clock::now();
+            m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            AddRetryDelaySpan(context.requestTiming, sleepStartTime);
+        }
+        PrepareNextAttempt(context, uri, method);
+    }
+    FinishAttempts(context);
+    return std::move(context.outcome);
+}
 
-        Aws::Monitoring::OnRequestFailed(this->GetServiceClientName(), requestName, httpRequest, outcome, coreMetrics, contexts);
+void AWSClient::AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const HttpResponseOutcomeHandler& handler) const
+{
+    auto context = Aws::MakeShared<AsyncRetryContext>(AWS_CLIENT_LOG_TAG, uri, request, method, signerName, signerRegionOverride, handler);
+    InitRetryContext(*context, uri, request.get(), nullptr, method, context->hasSignerRegionOverride ? context->signerRegionOverride.c_str() : nullptr);
+    if (ContinueAttemptsAsync(context))
+    {
+        context->handler(std::move(context->outcome));
+    }
+}
 
-        if (!m_httpClient->IsRequestProcessingEnabled())
+bool AWSClient::ContinueAttemptsAsync(const std::shared_ptr<AsyncRetryContext>& context) const
+{
+    const char* signerName = context->signerName.c_str();
+    for (;;)
+    {
+        AttemptOnce(*context, signerName);
+        if (context->outcome.IsSuccess() || !context->attemptSent)
         {
-            AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request was cancelled externally.");
             break;
         }
 
-        // Adjust region
-        bool retryWithCorrectRegion = false;
-        HttpResponseCode httpResponseCode = outcome.GetError().GetResponseCode();
-        if (httpResponseCode == HttpResponseCode::MOVED_PERMANENTLY ||  // 301
-            httpResponseCode == HttpResponseCode::TEMPORARY_REDIRECT || // 307
-            httpResponseCode == HttpResponseCode::BAD_REQUEST ||        // 400
-            httpResponseCode == HttpResponseCode::FORBIDDEN)            // 403
+        long sleepMillis = 0;
+        bool shouldSleep = false;
+        if (!PrepareRetry(*context, signerName, sleepMillis, shouldSleep))
         {
-            regionFromResponse = GetErrorMarshaller()->ExtractRegion(outcome.GetError());
-            if (m_region == Aws::Region::AWS_GLOBAL && !regionFromResponse.empty() && regionFromResponse != signerRegion)
-            {
-                signerRegion = regionFromResponse.c_str();
-                retryWithCorrectRegion = true;
-            }
+            break;
         }
 
-        long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
-        //AdjustClockSkew returns true means clock skew was the problem and skew was adjusted, false otherwise.
-        //sleep if clock skew and region was NOT the problem. AdjustClockSkew may update error inside outcome.
-        bool shouldSleep = !AdjustClockSkew(outcome, signerName) && !retryWithCorrectRegion;
-
-        if (!retryWithCorrectRegion && !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
+        if (shouldSleep && m_retryScheduler && m_executor)
         {
+            if (ScheduleRetry(context, sleepMillis))
+            {
+                return false;
+            }
+            AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "The client is shutting down, returning the last error instead of retrying the request.");
             break;
         }
-
-        AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
-
         if (shouldSleep)
         {
+            auto sleepStartTime = std::chrono::steady_clock::now();
             m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            AddRetryDelaySpan(context->requestTiming, sleepStartTime);
         }
+        PrepareNextAttempt(*context, context->uri, context->method);
+    }
+    FinishAttempts(*context);
+    return true;
+}
 
-        Aws::Http::URI newUri(uri.GetURIString());
-        Aws::String newEndpoint = GetErrorMarshaller()->ExtractEndpoint(outcome.GetError());
-        if (!newEndpoint.empty())
-        {
-            newUri.SetAuthority(newEndpoint);
-        }
-        httpRequest = CreateHttpRequest(newUri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+bool AWSClient::ScheduleRetry(const std::shared_ptr<AsyncRetryContext>& context, long sleepMillis) const
+{
+    // Free this thread during the backoff, the next attempt goes back to the executor once it elapsed. The callbacks hold the
+    // client's async retries rather than the client, which waits for them or cancels them before it is destroyed.
+    const auto asyncRetries = m_asyncRetries;
+    const auto sleepStartTime = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> locker(asyncRetries->lock);
+    if (asyncRetries->shutdown)
+    {
+        return false;
+    }
 
-        httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, invocationId);
-        if (serverTime.WasParseSuccessful() && serverTime != DateTime())
+    ++asyncRetries->running;
+    // Scheduled under the lock, so that the callbacks find the timer registered.
+    context->retryTimer = m_retryScheduler->Schedule(std::chrono::milliseconds(sleepMillis),
+        [this, asyncRetries, context, sleepStartTime]()
         {
-            requestInfo.ttl = DateTime::Now() + clockSkew + std::chrono::milliseconds(m_requestTimeoutMs);
-        }
-        requestInfo.attempt ++;
-        requestInfo.maxAttempts = m_retryStrategy->GetMaxAttempts();
-        httpRequest->SetHeaderValue(Http::SDK_REQUEST_HEADER, requestInfo);
-        Aws::Monitoring::OnRequestRetry(this->GetServiceClientName(), requestName, httpRequest, contexts);
+            AddRetryDelaySpan(context->requestTiming, sleepStartTime);
+            bool shutdown = false;
+            {
+                std::lock_guard<std::mutex> timersLocker(asyncRetries->lock);
+                asyncRetries->timers.erase(context->retryTimer);
+                shutdown = asyncRetries->shutdown;
+            }
+            if (shutdown)
+            {
+                ResumeAttemptsAsync(asyncRetries, context, false);
+                return;
+            }
+            bool submitted = m_executor->Submit([this, asyncRetries, context]()
+            {
+                ResumeAttemptsAsync(asyncRetries, context, !asyncRetries->IsShutdown());
+            });
+            if (!submitted)
+            {
+                AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Executor rejected the retry of the request, returning the last error.");
+                ResumeAttemptsAsync(asyncRetries, context, false);
+            }
+        },
+        [this, asyncRetries, context]()
+        {
+            {
+                std::lock_guard<std::mutex> timersLocker(asyncRetries->lock);
+                asyncRetries->timers.erase(context->retryTimer);
+            }
+            AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "The retry of the request was cancelled, returning the last error.");
+            // This runs on the thread cancelling the timer, e.g. the one destroying the client, the call ends on the executor.
+            bool submitted = m_executor->Submit([this, asyncRetries, context]()
+            {
+                ResumeAttemptsAsync(asyncRetries, context, false);
+            });
+            if (!submitted)
+            {
+                AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Executor rejected the end of a cancelled retry, ending it on the cancelling thread.");
+                ResumeAttemptsAsync(asyncRetries, context, false);
+            }
+        });
+    asyncRetries->timers.insert(context->retryTimer);
+    return true;
+}
+
+void AWSClient::ResumeAttemptsAsync(const std::shared_ptr<AsyncRetries>& asyncRetries, const std::shared_ptr<AsyncRetryContext>& context,
+    bool resume) const
+{
+    bool done = true;
+    if (resume)
+    {
+        PrepareNextAttempt(*context, context->uri, context->method);
+        done = ContinueAttemptsAsync(context);
+    }
+    else
+    {
+        FinishAttempts(*context);
+    }
+
+    // Released before the handler runs, so that the handler may destroy the client.
+    asyncRetries->Release();
+    if (done)
+    {
+        context->handler(std::move(context->outcome));
     }
-    Aws::Monitoring::OnFinish(this->GetServiceClientName(), requestName, httpRequest, contexts);
-    return outcome;
 }
 
 static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& response)
@@ -429,13 +830,30 @@ static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& respo
 }
 
 HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest,
-    const Aws::AmazonWebServiceRequest& request, const char* signerName, const char* signerRegionOverride) const
+    const Aws::AmazonWebServiceRequest& request, const char* signerName, const char* signerRegionOverride,
+    Aws::Monitoring::RequestTiming* requestTiming) const
 {
+    AWS_SDK_PROBE3(attempt__start, GetServiceClientName(), request.GetServiceRequestName(), httpRequest.get());
+    auto phaseStartTime = std::chrono::steady_clock::now();
     BuildHttpRequest(request, httpRequest);
+    if (requestTiming)
+    {
+        requestTiming->AddSpan(Aws::Monitoring::RequestPhase::Serialization, phaseStartTime);
+        phaseStartTime = std::chrono::steady_clock::now();
+    }
+
     auto signer = GetSignerByName(signerName);
-    if (!signer->SignRequest(*httpRequest, signerRegionOverride, request.SignBody()))
+    AWS_SDK_PROBE2(sign__start, signerName, httpRequest.get());
+    bool signedSuccessfully = signer->SignRequest(*httpRequest, signerRegionOverride, request.SignBody());
+    AWS_SDK_PROBE3(sign__end, signerName, httpRequest.get(), static_cast<int>(signedSuccessfully));
+    if (requestTiming)
+    {
+        requestTiming->AddSpan(Aws::Monitoring::RequestPhase::Signing, phaseStartTime);
+    }
+    if (!signedSuccessfully)
     {
         AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
+        AWS_SDK_PROBE2(attempt__end, httpRequest.get(), static_cast<int>(HttpResponseCode::REQUEST_NOT_MADE));
         return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
     }
 
@@ -445,30 +863,52 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpReque
     }
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
+    auto transferStartTime = std::chrono::steady_clock::now();
     std::shared_ptr<HttpResponse> httpResponse(
         m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    if (requestTiming)
+    {
+        AddHttpClientSpans(*requestTiming, httpRequest->GetRequestMetrics(), transferStartTime);
+    }
 
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
+        AWS_SDK_PROBE2(attempt__end, httpRequest.get(), static_cast<int>(httpResponse->GetResponseCode()));
+        auto parseStartTime = std::chrono::steady_clock::now();
         auto error = BuildAWSError(httpResponse);
+        if (requestTiming)
+        {
+            requestTiming->AddSpan(Aws::Monitoring::RequestPhase::ResponseParsing, parseStartTime);
+        }
         return HttpResponseOutcome(std::move(error));
     }
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned successful response.");
+    AWS_SDK_PROBE2(attempt__end, httpRequest.get(), static_cast<int>(httpResponse->GetResponseCode()));
 
     return HttpResponseOutcome(std::move(httpResponse));
 }
 
 HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest,
-    const char* signerName, const char* requestName, const char* signerRegionOverride) const
+    const char* signerName, const char* requestName, const char* signerRegionOverride, Aws::Monitoring::RequestTiming* requestTiming) const
 {
     AWS_UNREFERENCED_PARAM(requestName);
+    AWS_SDK_PROBE3(attempt__start, GetServiceClientName(), requestName, httpRequest.get());
 
+    auto signStartTime = std::chrono::steady_clock::now();
     auto signer = GetSignerByName(signerName);
-    if (!signer->SignRequest(*httpRequest, signerRegionOverride, true))
+    AWS_SDK_PROBE2(sign__start, signerName, httpRequest.get());
+    bool signedSuccessfully = signer->SignRequest(*httpRequest, signerRegionOverride, true);
+    AWS_SDK_PROBE3(sign__end, signerName, httpRequest.get(), static_cast<int>(signedSuccessfully));
+    if (requestTiming)
+    {
+        requestTiming->AddSpan(Aws::Monitoring::RequestPhase::Signing, signStartTime);
+    }
+    if (!signedSuccessfully)
     {
         AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
+        AWS_SDK_PROBE2(attempt__end, httpRequest.get(), static_cast<int>(HttpResponseCode::REQUEST_NOT_MADE));
         return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
     }
 
@@ -476,17 +916,29 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpReque
     AddCommonHeaders(*httpRequest);
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
+    auto transferStartTime = std::chrono::steady_clock::now();
     std::shared_ptr<HttpResponse> httpResponse(
         m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    if (requestTiming)
+    {
+        AddHttpClientSpans(*requestTiming, httpRequest->GetRequestMetrics(), transferStartTime);
+    }
 
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
+        AWS_SDK_PROBE2(attempt__end, httpRequest.get(), static_cast<int>(httpResponse->GetResponseCode()));
+        auto parseStartTime = std::chrono::steady_clock::now();
         auto error = BuildAWSError(httpResponse);
+        if (requestTiming)
+        {
+            requestTiming->AddSpan(Aws::Monitoring::RequestPhase::ResponseParsing, parseStartTime);
+        }
         return HttpResponseOutcome(std::move(error));
     }
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned successful response.");
+    AWS_SDK_PROBE2(attempt__end, httpRequest.get(), static_cast<int>(httpResponse->GetResponseCode()));
 
     return HttpResponseOutcome(std::move(httpResponse));
 }
@@ -500,23 +952,25 @@ StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::Http::URI& u
     HttpResponseOutcome httpResponseOutcome = AttemptExhaustively(uri, request, method, signerName, signerRegionOverride);
     if (httpResponseOutcome.IsSuccess())
     {
-        return StreamOutcome(AmazonWebServiceResult<Stream::ResponseStream>(
+        return StreamOutcome(WithRequestTiming(AmazonWebServiceResult<Stream::ResponseStream>(
             httpResponseOutcome.GetResult()->SwapResponseStreamOwnership(),
-            httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode()));
+            httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode()),
+            httpResponseOutcome.GetResult()->GetRequestTiming()));
     }
 
     return StreamOutcome(std::move(httpResponseOutcome));
 }
 
 StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::Http::URI& uri, Http::HttpMethod method,
-    const char* signerName, const char* requestName, const char* signerRegionOverride) const
+    const char* signerName, const char* requestName, const char* signerRegionOverride, std::chrono::steady_clock::time_point callDeadline) const
 {
-    HttpResponseOutcome httpResponseOutcome = AttemptExhaustively(uri, method, signerName, requestName, signerRegionOverride);
+    HttpResponseOutcome httpResponseOutcome = AttemptExhaustively(uri, method, signerName, requestName, signerRegionOverride, callDeadline);
     if (httpResponseOutcome.IsSuccess())
     {
-        return StreamOutcome(AmazonWebServiceResult<Stream::ResponseStream>(
+        return StreamOutcome(WithRequestTiming(AmazonWebServiceResult<Stream::ResponseStream>(
             httpResponseOutcome.GetResult()->SwapResponseStreamOwnership(),
-            httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode()));
+            httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode()),
+            httpResponseOutcome.GetResult()->GetRequestTiming()));
     }
 
     return StreamOutcome(std::move(httpResponseOutcome));
@@ -531,19 +985,22 @@ XmlOutcome AWSXMLClient::MakeRequestWithEventStream(const Aws::Http::URI& uri,
     HttpResponseOutcome httpOutcome = AttemptExhaustively(uri, request, method, signerName, signerRegionOverride);
     if (httpOutcome.IsSuccess())
     {
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
+        return XmlOutcome(WithRequestTiming(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()),
+            httpOutcome.GetResult()->GetRequestTiming()));
     }
 
     return XmlOutcome(std::move(httpOutcome));
 }
 
 XmlOutcome AWSXMLClient::MakeRequestWithEventStream(const Aws::Http::URI& uri, Http::HttpMethod method,
-    const char* signerName, const char* requestName, const char* signerRegionOverride) const
+    const char* signerName, const char* requestName, const char* signerRegionOverride,
+    std::chrono::steady_clock::time_point callDeadline) const
 {
-    HttpResponseOutcome httpOutcome = AttemptExhaustively(uri, method, signerName, requestName, signerRegionOverride);
+    HttpResponseOutcome httpOutcome = AttemptExhaustively(uri, method, signerName, requestName, signerRegionOverride, callDeadline);
     if (httpOutcome.IsSuccess())
     {
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
+        return XmlOutcome(WithRequestTiming(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()),
+            httpOutcome.GetResult()->GetRequestTiming()));
     }
 
     return XmlOutcome(std::move(httpOutcome));
@@ -598,12 +1055,23 @@ void AWSClient::AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpReq
                                                    "The request may fail if it's not a seekable stream.");
         }
         AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Found body, but content-length has not been set, attempting to compute content-length");
-        body->seekg(0, body->end);
-        auto streamSize = body->tellg();
-        body->seekg(0, body->beg);
-        Aws::StringStream ss;
-        ss << streamSize;
-        httpRequest->SetContentLength(ss.str());
+        if (const auto segmentedBody = Utils::Stream::SegmentedStream::GetSegmentedStreamBuf(*body))
+        {
+            httpRequest->SetContentLength(StringUtils::to_string(segmentedBody->GetLength()));
+        }
+        else if (const auto fileBody = Utils::Stream::FileBodyStream::GetFileBodyStreamBuf(*body))
+        {
+            httpRequest->SetContentLength(StringUtils::to_string(fileBody->GetLength()));
+        }
+        else
+        {
+            body->seekg(0, body->end);
+            auto streamSize = body->tellg();
+            body->seekg(0, body->beg);
+            Aws::StringStream ss;
+            ss << streamSize;
+            httpRequest->SetContentLength(ss.str());
+        }
     }
 
     if (needsContentMd5 && body && !httpRequest->HasHeader(Http::CONTENT_MD5_HEADER))
@@ -652,17 +1120,92 @@ void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
     }
     else
     {
-        AddContentBodyToRequest(httpRequest, request.GetBody(), request.ShouldComputeContentMd5(), request.IsStreaming() && request.IsChunked() && m_httpClient->SupportsChunkedTransferEncoding());
+        const bool isChunked = request.IsStreaming() && request.IsChunked() && m_httpClient->SupportsChunkedTransferEncoding();
+        auto body = request.GetBody();
+        bool needsContentMd5 = request.ShouldComputeContentMd5();
+        if (!isChunked)
+        {
+            // Compressed before the content-length and content-md5 are computed and the payload is signed.
+            auto compressedBody = CompressRequestBody(request, *httpRequest, body);
+            if (compressedBody != body)
+            {
+                // A content-md5 set by the caller is the one of the uncompressed body, it's computed again.
+                needsContentMd5 = needsContentMd5 || httpRequest->HasHeader(Http::CONTENT_MD5_HEADER);
+                httpRequest->DeleteHeader(Http::CONTENT_MD5_HEADER);
+                body = compressedBody;
+            }
+        }
+        AddContentBodyToRequest(httpRequest, body, needsContentMd5, isChunked);
     }
 
     // Pass along handlers for processing data sent/received in bytes
     httpRequest->SetDataReceivedEventHandler(request.GetDataReceivedEventHandler());
+    httpRequest->SetResponseBodySink(request.GetResponseBodySink());
+    httpRequest->SetRequestPriority(request.GetRequestPriority());
+    httpRequest->SetDeadline(request.GetCallDeadline());
     httpRequest->SetDataSentEventHandler(request.GetDataSentEventHandler());
     httpRequest->SetContinueRequestHandle(request.GetContinueRequestHandler());
 
     request.AddQueryStringParameters(httpRequest->GetUri());
 }
 
+std::shared_ptr<Aws::IOStream> AWSClient::CompressRequestBody(const Aws::AmazonWebServiceRequest& request, HttpRequest& httpRequest,
+                                                              const std::shared_ptr<Aws::IOStream>& body) const
+{
+    CompressionAlgorithm algorithm = m_requestCompressionAlgorithm;
+    if (request.RequestCompressionAlgorithmHasBeenSet())
+    {
+        algorithm = request.GetRequestCompressionAlgorithm();
+    }
+    else if (request.IsStreaming())
+    {
+        algorithm = CompressionAlgorithm::NONE;
+    }
+
+    if (!body || algorithm == CompressionAlgorithm::NONE)
+    {
+        return body;
+    }
+
+    // Retries send again the body compressed by the first attempt. The headers of the operation were set again,
+    // the content-length of the uncompressed body among them.
+    const auto& previousBody = httpRequest.GetContentBody();
+    if (previousBody && previousBody != body &&
+        httpRequest.GetHeaderValue(Http::CONTENT_ENCODING_HEADER) == RequestCompression::GetContentEncoding(algorithm))
+    {
+        previousBody->clear();
+        previousBody->seekg(0, previousBody->beg);
+        httpRequest.DeleteHeader(Http::CONTENT_LENGTH_HEADER);
+        return previousBody;
+    }
+
+    if (httpRequest.HasHeader(Http::CONTENT_ENCODING_HEADER))
+    {
+        return body;
+    }
+
+    body->seekg(0, body->end);
+    auto bodySize = body->tellg();
+    body->seekg(0, body->beg);
+    if (bodySize < 0 || static_cast<size_t>(bodySize) < m_requestMinCompressionSizeBytes)
+    {
+        return body;
+    }
+
+    auto compressed = RequestCompression::Compress(*body, algorithm);
+    if (!compressed)
+    {
+        body->seekg(0, body->beg);
+        return body;
+    }
+
+    AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Compressed request body of " << bodySize << " bytes with " << RequestCompression::GetContentEncoding(algorithm));
+    httpRequest.SetHeaderValue(Http::CONTENT_ENCODING_HEADER, RequestCompression::GetContentEncoding(algorithm));
+    // The content-length of the operation, if any, is the uncompressed one.
+    httpRequest.DeleteHeader(Http::CONTENT_LENGTH_HEADER);
+    return compressed;
+}
+
 void AWSClient::AddCommonHeaders(HttpRequest& httpRequest) const
 {
     httpRequest.SetUserAgent(m_userAgent);
@@ -814,55 +1357,81 @@ AWSJsonClient::AWSJsonClient(const Aws::Client::ClientConfiguration& configurati
 }
 
 
-JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method,
-    const char* signerName,
-    const char* signerRegionOverride) const
+// Parses the body of a successful response into a json document.
+static JsonOutcome ToJsonOutcome(HttpResponseOutcome&& httpOutcome)
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName, signerRegionOverride));
     if (!httpOutcome.IsSuccess())
     {
         return JsonOutcome(std::move(httpOutcome));
     }
 
+    const auto& requestTiming = httpOutcome.GetResult()->GetRequestTiming();
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
+    {
+        auto parseStartTime = std::chrono::steady_clock::now();
+        JsonValue jsonValue(httpOutcome.GetResult()->GetResponseBody());
+        AddResponseParsingSpan(requestTiming, parseStartTime);
+
         //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(httpOutcome.GetResult()->GetResponseBody()),
-        httpOutcome.GetResult()->GetHeaders(),
-        httpOutcome.GetResult()->GetResponseCode()));
+        return JsonOutcome(WithRequestTiming(AmazonWebServiceResult<JsonValue>(std::move(jsonValue),
+            httpOutcome.GetResult()->GetHeaders(),
+            httpOutcome.GetResult()->GetResponseCode()), requestTiming));
+    }
 
-    else
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
+    return JsonOutcome(WithRequestTiming(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()), requestTiming));
 }
 
 JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
     Http::HttpMethod method,
     const char* signerName,
-    const char* requestName,
     const char* signerRegionOverride) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName, signerRegionOverride));
+    return ToJsonOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName, signerRegionOverride));
+}
+
+void AWSJsonClient::MakeRequestAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const JsonOutcomeHandler& handler) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, method, signerName, signerRegionOverride,
+        [handler](HttpResponseOutcome&& httpOutcome) { handler(ToJsonOutcome(std::move(httpOutcome))); });
+}
+
+JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* requestName,
+    const char* signerRegionOverride,
+    std::chrono::steady_clock::time_point callDeadline) const
+{
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName, signerRegionOverride, callDeadline));
     if (!httpOutcome.IsSuccess())
     {
         return JsonOutcome(std::move(httpOutcome));
     }
 
+    const auto& requestTiming = httpOutcome.GetResult()->GetRequestTiming();
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
+        auto parseStartTime = std::chrono::steady_clock::now();
         JsonValue jsonValue(httpOutcome.GetResult()->GetResponseBody());
+        AddResponseParsingSpan(requestTiming, parseStartTime);
         if (!jsonValue.WasParseSuccessful())
         {
-            return JsonOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", jsonValue.GetErrorMessage(), false));
+            return JsonOutcome(WithRequestTiming(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", jsonValue.GetErrorMessage(), false), requestTiming));
         }
 
         //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(std::move(jsonValue),
+        return JsonOutcome(WithRequestTiming(AmazonWebServiceResult<JsonValue>(std::move(jsonValue),
             httpOutcome.GetResult()->GetHeaders(),
-            httpOutcome.GetResult()->GetResponseCode()));
+            httpOutcome.GetResult()->GetResponseCode()), requestTiming));
     }
 
-    return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
+    return JsonOutcome(WithRequestTiming(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()), requestTiming));
 }
 
 JsonOutcome AWSJsonClient::MakeEventStreamRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const
@@ -945,55 +1514,77 @@ AWSXMLClient::AWSXMLClient(const Aws::Client::ClientConfiguration& configuration
 {
 }
 
-XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method,
-    const char* signerName,
-    const char* signerRegionOverride) const
+XmlOutcome AWSXMLClient::ToXmlOutcome(HttpResponseOutcome&& httpOutcome)
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName, signerRegionOverride));
     if (!httpOutcome.IsSuccess())
     {
         return XmlOutcome(std::move(httpOutcome));
     }
 
+    const auto& requestTiming = httpOutcome.GetResult()->GetRequestTiming();
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
+        auto parseStartTime = std::chrono::steady_clock::now();
         XmlDocument xmlDoc = XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody());
+        AddResponseParsingSpan(requestTiming, parseStartTime);
 
         if (!xmlDoc.WasParseSuccessful())
         {
             AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Xml parsing for error failed with message " << xmlDoc.GetErrorMessage().c_str());
-            return AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Xml Parse Error", xmlDoc.GetErrorMessage(), false);
+            return WithRequestTiming(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Xml Parse Error", xmlDoc.GetErrorMessage(), false), requestTiming);
         }
 
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc),
-            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
+        return XmlOutcome(WithRequestTiming(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc),
+            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()), requestTiming));
     }
 
-    return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
+    return XmlOutcome(WithRequestTiming(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()), requestTiming));
 }
 
 XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
     Http::HttpMethod method,
     const char* signerName,
-    const char* requestName,
     const char* signerRegionOverride) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName, signerRegionOverride));
+    return ToXmlOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName, signerRegionOverride));
+}
+
+void AWSXMLClient::MakeRequestAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const XmlOutcomeHandler& handler) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, method, signerName, signerRegionOverride,
+        [handler](HttpResponseOutcome&& httpOutcome) { handler(AWSXMLClient::ToXmlOutcome(std::move(httpOutcome))); });
+}
+
+XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* requestName,
+    const char* signerRegionOverride,
+    std::chrono::steady_clock::time_point callDeadline) const
+{
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName, signerRegionOverride, callDeadline));
     if (!httpOutcome.IsSuccess())
     {
         return XmlOutcome(std::move(httpOutcome));
     }
 
+    const auto& requestTiming = httpOutcome.GetResult()->GetRequestTiming();
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(
-            XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody()),
-            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
+        auto parseStartTime = std::chrono::steady_clock::now();
+        XmlDocument xmlDoc = XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody());
+        AddResponseParsingSpan(requestTiming, parseStartTime);
+        return XmlOutcome(WithRequestTiming(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc),
+            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()), requestTiming));
     }
 
-    return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
+    return XmlOutcome(WithRequestTiming(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()), requestTiming));
 }
 
 AWSError<CoreErrors> AWSXMLClient::BuildAWSError(const std::shared_ptr<Http::HttpResponse>& httpResponse) const
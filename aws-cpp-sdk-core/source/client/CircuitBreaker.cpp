@@ -0,0 +1,185 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/client/CircuitBreaker.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/monitoring/MonitoringManager.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+using namespace Aws::Client;
+
+static const char CIRCUIT_BREAKER_TAG[] = "CircuitBreaker";
+
+const char* Aws::Client::GetNameForCircuitState(CircuitState state)
+{
+    switch (state)
+    {
+    case CircuitState::CLOSED:
+        return "CLOSED";
+    case CircuitState::OPEN:
+        return "OPEN";
+    case CircuitState::HALF_OPEN:
+        return "HALF_OPEN";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+CircuitBreakerConfiguration::CircuitBreakerConfiguration() :
+    failureRateThreshold(0.5),
+    minimumAttempts(20),
+    window(std::chrono::seconds(10)),
+    openDuration(std::chrono::seconds(5)),
+    halfOpenProbes(1),
+    perOperation(true)
+{
+}
+
+CircuitBreaker::CircuitBreaker(const CircuitBreakerConfiguration& configuration) :
+    m_configuration(configuration)
+{
+}
+
+Aws::String CircuitBreaker::GetCircuitName(const Aws::String& endpoint, const Aws::String& requestName) const
+{
+    if (!m_configuration.perOperation || requestName.empty())
+    {
+        return endpoint;
+    }
+    Aws::String name;
+    name.reserve(endpoint.size() + requestName.size() + 1);
+    name.append(endpoint).append(1, '/').append(requestName);
+    return name;
+}
+
+bool CircuitBreaker::AllowAttempt(const Aws::String& serviceName, const Aws::String& circuitName)
+{
+    bool allowed = false;
+    bool halfOpened = false;
+    {
+        std::lock_guard<std::mutex> locker(m_circuitsLock);
+        Circuit& circuit = m_circuits[circuitName];
+        const auto now = Now();
+        if (circuit.state == CircuitState::OPEN && now - circuit.openedAt >= m_configuration.openDuration)
+        {
+            circuit.state = CircuitState::HALF_OPEN;
+            circuit.probesInFlight = 0;
+            halfOpened = true;
+        }
+
+        switch (circuit.state)
+        {
+        case CircuitState::CLOSED:
+            allowed = true;
+            break;
+        case CircuitState::HALF_OPEN:
+            allowed = circuit.probesInFlight < m_configuration.halfOpenProbes;
+            if (allowed)
+            {
+                ++circuit.probesInFlight;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (halfOpened)
+    {
+        AWS_LOGSTREAM_INFO(CIRCUIT_BREAKER_TAG, "Circuit " << circuitName << " is half open, letting probes through.");
+        Aws::Monitoring::OnCircuitStateChanged(serviceName, circuitName, CircuitState::HALF_OPEN);
+    }
+    return allowed;
+}
+
+void CircuitBreaker::OnAttemptFinished(const Aws::String& serviceName, const Aws::String& circuitName, bool failed)
+{
+    bool changed = false;
+    CircuitState state = CircuitState::CLOSED;
+    {
+        std::lock_guard<std::mutex> locker(m_circuitsLock);
+        auto iter = m_circuits.find(circuitName);
+        if (iter == m_circuits.end())
+        {
+            return;
+        }
+        Circuit& circuit = iter->second;
+        const auto now = Now();
+        switch (circuit.state)
+        {
+        case CircuitState::CLOSED:
+            if (circuit.attempts == 0 || now - circuit.windowStart >= m_configuration.window)
+            {
+                circuit.windowStart = now;
+                circuit.attempts = 0;
+                circuit.failures = 0;
+            }
+            ++circuit.attempts;
+            circuit.failures += failed ? 1 : 0;
+            if (circuit.attempts >= m_configuration.minimumAttempts &&
+                circuit.failures >= m_configuration.failureRateThreshold * circuit.attempts)
+            {
+                circuit.state = CircuitState::OPEN;
+                circuit.openedAt = now;
+                changed = true;
+            }
+            break;
+        case CircuitState::HALF_OPEN:
+            // Attempts allowed before the circuit opened may finish after it went half open, they are not probes.
+            if (circuit.probesInFlight == 0)
+            {
+                break;
+            }
+            --circuit.probesInFlight;
+            circuit.state = failed ? CircuitState::OPEN : CircuitState::CLOSED;
+            circuit.openedAt = now;
+            circuit.attempts = 0;
+            circuit.failures = 0;
+            changed = true;
+            break;
+        default:
+            break;
+        }
+        state = circuit.state;
+    }
+
+    if (changed)
+    {
+        if (state == CircuitState::OPEN)
+        {
+            AWS_LOGSTREAM_WARN(CIRCUIT_BREAKER_TAG, "Circuit " << circuitName << " is open, failing its attempts for "
+                << m_configuration.openDuration.count() << " ms.");
+        }
+        else
+        {
+            AWS_LOGSTREAM_INFO(CIRCUIT_BREAKER_TAG, "Circuit " << circuitName << " is closed.");
+        }
+        Aws::Monitoring::OnCircuitStateChanged(serviceName, circuitName, state);
+    }
+}
+
+void CircuitBreaker::OnAttemptAbandoned(const Aws::String& circuitName)
+{
+    std::lock_guard<std::mutex> locker(m_circuitsLock);
+    auto iter = m_circuits.find(circuitName);
+    if (iter != m_circuits.end() && iter->second.state == CircuitState::HALF_OPEN && iter->second.probesInFlight > 0)
+    {
+        --iter->second.probesInFlight;
+    }
+}
+
+CircuitState CircuitBreaker::GetState(const Aws::String& circuitName) const
+{
+    std::lock_guard<std::mutex> locker(m_circuitsLock);
+    auto iter = m_circuits.find(circuitName);
+    return iter == m_circuits.end() ? CircuitState::CLOSED : iter->second.state;
+}
+
+bool CircuitBreaker::IsFailure(const AWSError<CoreErrors>& error) const
+{
+    return error.ShouldRetry() || static_cast<int>(error.GetResponseCode()) >= 500;
+}
@@ -40,6 +40,10 @@ ClientConfiguration::ClientConfiguration() :
     scheme(Aws::Http::Scheme::HTTPS),
     useDualStack(false),
     maxConnections(25),
+    maxConnectionsPerEndpoint(0),
+    connectionMaxIdleMs(0),
+    connectionMaxLifetimeMs(0),
+    connectionAcquireTimeoutMs(0),
     httpRequestTimeoutMs(0),
     requestTimeoutMs(3000),
     connectTimeoutMs(1000),
@@ -55,10 +59,14 @@ ClientConfiguration::ClientConfiguration() :
     httpLibOverride(Aws::Http::TransferLibType::DEFAULT_CLIENT),
     followRedirects(FollowRedirectsPolicy::DEFAULT),
     disableExpectHeader(false),
+    requestCompressionAlgorithm(CompressionAlgorithm::NONE),
+    requestMinCompressionSizeBytes(10240),
+    enableResponseDecompression(false),
     enableClockSkewAdjustment(true),
     enableHostPrefixInjection(true),
     enableEndpointDiscovery(false),
-    profileName(Aws::Auth::GetConfigProfileName())
+    profileName(Aws::Auth::GetConfigProfileName()),
+    enableRequestTiming(false)
 {
     AWS_LOGSTREAM_DEBUG(CLIENT_CONFIG_TAG, "ClientConfiguration will use SDK Auto Resolved profile: [" << profileName << "] if not specified by users.");
 
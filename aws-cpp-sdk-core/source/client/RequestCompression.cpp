@@ -0,0 +1,157 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/client/RequestCompression.h>
+#include <aws/core/utils/UnreferencedParam.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#ifdef ENABLE_ZLIB_REQUEST_COMPRESSION
+#include <zlib.h>
+#endif
+
+using namespace Aws::Client;
+
+static const char REQUEST_COMPRESSION_TAG[] = "RequestCompression";
+
+#ifdef ENABLE_ZLIB_REQUEST_COMPRESSION
+static const size_t ZLIB_CHUNK_SIZE = 16 * 1024;
+// Window bits of the largest window, plus 16 for a gzip wrapper instead of a zlib one.
+static const int ZLIB_WINDOW_BITS = 15;
+static const int GZIP_WINDOW_BITS = 15 + 16;
+
+static int GetWindowBits(CompressionAlgorithm algorithm)
+{
+    return algorithm == CompressionAlgorithm::GZIP ? GZIP_WINDOW_BITS : ZLIB_WINDOW_BITS;
+}
+
+// Runs body through a deflate or inflate stream, depending on compress.
+static std::shared_ptr<Aws::IOStream> Transform(Aws::IOStream& body, CompressionAlgorithm algorithm, bool compress)
+{
+    z_stream zs = {};
+    int ret = compress ? deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, GetWindowBits(algorithm), 8, Z_DEFAULT_STRATEGY)
+                       : inflateInit2(&zs, GetWindowBits(algorithm));
+    if (ret != Z_OK)
+    {
+        AWS_LOGSTREAM_ERROR(REQUEST_COMPRESSION_TAG, "Failed to initialize zlib: " << ret);
+        return nullptr;
+    }
+
+    auto output = Aws::MakeShared<Aws::StringStream>(REQUEST_COMPRESSION_TAG);
+    unsigned char in[ZLIB_CHUNK_SIZE];
+    unsigned char out[ZLIB_CHUNK_SIZE];
+    bool finished = false;
+    while (!finished && ret >= Z_OK)
+    {
+        body.read(reinterpret_cast<char*>(in), ZLIB_CHUNK_SIZE);
+        zs.next_in = in;
+        zs.avail_in = static_cast<uInt>(body.gcount());
+        const bool endOfInput = !body;
+        const int flush = compress && endOfInput ? Z_FINISH : Z_NO_FLUSH;
+        do
+        {
+            zs.next_out = out;
+            zs.avail_out = ZLIB_CHUNK_SIZE;
+            ret = compress ? deflate(&zs, flush) : inflate(&zs, Z_NO_FLUSH);
+            // No progress possible this round, not an error.
+            if (ret == Z_BUF_ERROR)
+            {
+                ret = Z_OK;
+            }
+            if (ret == Z_STREAM_ERROR || ret == Z_NEED_DICT || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR)
+            {
+                break;
+            }
+            output->write(reinterpret_cast<char*>(out), ZLIB_CHUNK_SIZE - zs.avail_out);
+        } while (zs.avail_out == 0);
+
+        finished = ret == Z_STREAM_END;
+        if (endOfInput && !finished && ret >= Z_OK)
+        {
+            // Input ran out before the end of the compressed stream.
+            ret = Z_DATA_ERROR;
+        }
+    }
+    if (compress)
+    {
+        deflateEnd(&zs);
+    }
+    else
+    {
+        inflateEnd(&zs);
+    }
+    // Reading up to the end left the body's failbit set.
+    body.clear();
+
+    if (!finished)
+    {
+        AWS_LOGSTREAM_ERROR(REQUEST_COMPRESSION_TAG, "zlib failed to " << (compress ? "compress" : "decompress") << " the body: " << ret);
+        return nullptr;
+    }
+    return output;
+}
+#endif
+
+namespace Aws
+{
+namespace Client
+{
+namespace RequestCompression
+{
+    const char* GetContentEncoding(CompressionAlgorithm algorithm)
+    {
+        switch (algorithm)
+        {
+        case CompressionAlgorithm::GZIP:
+            return "gzip";
+        case CompressionAlgorithm::DEFLATE:
+            return "deflate";
+        default:
+            return nullptr;
+        }
+    }
+
+    bool IsSupported(CompressionAlgorithm algorithm)
+    {
+#ifdef ENABLE_ZLIB_REQUEST_COMPRESSION
+        return algorithm != CompressionAlgorithm::NONE;
+#else
+        AWS_UNREFERENCED_PARAM(algorithm);
+        return false;
+#endif
+    }
+
+    std::shared_ptr<Aws::IOStream> Compress(Aws::IOStream& body, CompressionAlgorithm algorithm)
+    {
+        if (!IsSupported(algorithm))
+        {
+            AWS_LOGSTREAM_WARN(REQUEST_COMPRESSION_TAG, "Request compression isn't supported by this build, sending the body uncompressed.");
+            return nullptr;
+        }
+#ifdef ENABLE_ZLIB_REQUEST_COMPRESSION
+        return Transform(body, algorithm, true);
+#else
+        AWS_UNREFERENCED_PARAM(body);
+        return nullptr;
+#endif
+    }
+
+    std::shared_ptr<Aws::IOStream> Decompress(Aws::IOStream& body, CompressionAlgorithm algorithm)
+    {
+        if (!IsSupported(algorithm))
+        {
+            return nullptr;
+        }
+#ifdef ENABLE_ZLIB_REQUEST_COMPRESSION
+        return Transform(body, algorithm, false);
+#else
+        AWS_UNREFERENCED_PARAM(body);
+        return nullptr;
+#endif
+    }
+} // namespace RequestCompression
+} // namespace Client
+} // namespace Aws
@@ -0,0 +1,195 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/http/CachingDnsResolver.h>
+#include <aws/core/net/Net.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <mutex>
+
+using namespace Aws::Http;
+
+static const char CACHING_DNS_RESOLVER_TAG[] = "CachingDnsResolver";
+// When a refresh fails the stale addresses keep being used, the lookup is tried again after this long.
+static const std::chrono::seconds FAILED_REFRESH_RETRY_INTERVAL(1);
+
+struct CachingDnsResolver::Cache
+{
+    struct Entry
+    {
+        Entry() : next(0), refreshing(false) {}
+
+        Aws::Vector<Aws::String> addresses;
+        // Connections acquired and not released, per address.
+        Aws::Vector<unsigned> inUse;
+        size_t next;
+        std::chrono::steady_clock::time_point expires;
+        bool refreshing;
+    };
+
+    // Replaces the addresses of the entry, keeping the count of connections to the addresses still in it.
+    void Update(Entry& entry, const Aws::Vector<Aws::String>& addresses)
+    {
+        Aws::Vector<unsigned> inUse(addresses.size(), 0);
+        for (size_t i = 0; i < addresses.size(); ++i)
+        {
+            for (size_t j = 0; j < entry.addresses.size(); ++j)
+            {
+                if (entry.addresses[j] == addresses[i])
+                {
+                    inUse[i] = entry.inUse[j];
+                    break;
+                }
+            }
+        }
+        entry.addresses = addresses;
+        entry.inUse.swap(inUse);
+        entry.expires = std::chrono::steady_clock::now() + ttl;
+    }
+
+    std::chrono::milliseconds ttl;
+    AddressSelectionPolicy policy;
+    LookupFunction lookup;
+    std::mutex lock;
+    Aws::UnorderedMap<Aws::String, Entry> entries;
+};
+
+CachingDnsResolver::CachingDnsResolver(std::chrono::milliseconds ttl, AddressSelectionPolicy policy, const LookupFunction& lookup,
+                                       const std::shared_ptr<Aws::Utils::Threading::Executor>& refreshExecutor) :
+    m_cache(Aws::MakeShared<Cache>(CACHING_DNS_RESOLVER_TAG)),
+    m_refreshExecutor(refreshExecutor)
+{
+    m_cache->ttl = ttl;
+    m_cache->policy = policy;
+    m_cache->lookup = lookup ? lookup : LookupFunction(Aws::Net::ResolveHostAddresses);
+}
+
+Aws::String CachingDnsResolver::AcquireAddress(const Aws::String& host)
+{
+    std::unique_lock<std::mutex> locker(m_cache->lock);
+    auto entry = m_cache->entries.find(host);
+    if (entry == m_cache->entries.end() || entry->second.addresses.empty())
+    {
+        // Nothing to hand out meanwhile, this request has to wait for the lookup.
+        locker.unlock();
+        auto addresses = m_cache->lookup(host);
+        if (addresses.empty())
+        {
+            AWS_LOGSTREAM_WARN(CACHING_DNS_RESOLVER_TAG, "Failed to resolve " << host);
+            return {};
+        }
+        locker.lock();
+        entry = m_cache->entries.emplace(host, Cache::Entry()).first;
+        if (entry->second.addresses.empty())
+        {
+            m_cache->Update(entry->second, addresses);
+        }
+    }
+    else if (!entry->second.refreshing && std::chrono::steady_clock::now() >= entry->second.expires)
+    {
+        entry->second.refreshing = true;
+        auto cache = m_cache;
+        if (m_refreshExecutor && m_refreshExecutor->Submit([cache, host]() { Refresh(cache, host); }))
+        {
+            AWS_LOGSTREAM_DEBUG(CACHING_DNS_RESOLVER_TAG, "Refreshing the addresses of " << host << " in the background.");
+        }
+        else
+        {
+            locker.unlock();
+            Refresh(cache, host);
+            locker.lock();
+            entry = m_cache->entries.find(host);
+            if (entry == m_cache->entries.end() || entry->second.addresses.empty())
+            {
+                return {};
+            }
+        }
+    }
+
+    Cache::Entry& found = entry->second;
+    const size_t count = found.addresses.size();
+    size_t picked = found.next % count;
+    if (m_cache->policy == AddressSelectionPolicy::LEAST_LOADED)
+    {
+        // Start the search at the next address in turn, so that idle addresses get picked in turn too.
+        for (size_t i = 1; i < count; ++i)
+        {
+            const size_t candidate = (found.next + i) % count;
+            if (found.inUse[candidate] < found.inUse[picked])
+            {
+                picked = candidate;
+            }
+        }
+    }
+    found.next = picked + 1;
+    ++found.inUse[picked];
+    return found.addresses[picked];
+}
+
+void CachingDnsResolver::ReleaseAddress(const Aws::String& host, const Aws::String& address)
+{
+    std::lock_guard<std::mutex> locker(m_cache->lock);
+    auto entry = m_cache->entries.find(host);
+    if (entry == m_cache->entries.end())
+    {
+        return;
+    }
+    for (size_t i = 0; i < entry->second.addresses.size(); ++i)
+    {
+        if (entry->second.addresses[i] == address)
+        {
+            if (entry->second.inUse[i] > 0)
+            {
+                --entry->second.inUse[i];
+            }
+            return;
+        }
+    }
+}
+
+void CachingDnsResolver::RemoveAddress(const Aws::String& host, const Aws::String& address)
+{
+    std::lock_guard<std::mutex> locker(m_cache->lock);
+    auto entry = m_cache->entries.find(host);
+    if (entry == m_cache->entries.end())
+    {
+        return;
+    }
+    for (size_t i = 0; i < entry->second.addresses.size(); ++i)
+    {
+        if (entry->second.addresses[i] == address)
+        {
+            AWS_LOGSTREAM_DEBUG(CACHING_DNS_RESOLVER_TAG, "Removing address " << address << " of " << host);
+            entry->second.addresses.erase(entry->second.addresses.begin() + i);
+            entry->second.inUse.erase(entry->second.inUse.begin() + i);
+            return;
+        }
+    }
+}
+
+Aws::Vector<Aws::String> CachingDnsResolver::GetCachedAddresses(const Aws::String& host) const
+{
+    std::lock_guard<std::mutex> locker(m_cache->lock);
+    auto entry = m_cache->entries.find(host);
+    return entry == m_cache->entries.end() ? Aws::Vector<Aws::String>() : entry->second.addresses;
+}
+
+void CachingDnsResolver::Refresh(const std::shared_ptr<Cache>& cache, const Aws::String& host)
+{
+    auto addresses = cache->lookup(host);
+    std::lock_guard<std::mutex> locker(cache->lock);
+    Cache::Entry& entry = cache->entries[host];
+    entry.refreshing = false;
+    if (addresses.empty())
+    {
+        AWS_LOGSTREAM_WARN(CACHING_DNS_RESOLVER_TAG, "Failed to refresh the addresses of " << host << ", keeping the cached ones.");
+        entry.expires = std::chrono::steady_clock::now() + FAILED_REFRESH_RETRY_INTERVAL;
+        return;
+    }
+    cache->Update(entry, addresses);
+}
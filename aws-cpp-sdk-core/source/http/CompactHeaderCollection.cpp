@@ -0,0 +1,148 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/http/CompactHeaderCollection.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+using namespace Aws::Http;
+
+// Sorted, so that they can be binary searched.
+static const char* const WELL_KNOWN_HEADER_NAMES[] =
+{
+    "accept",
+    "amz-sdk-invocation-id",
+    "amz-sdk-request",
+    "authorization",
+    "connection",
+    "content-encoding",
+    "content-length",
+    "content-md5",
+    "content-type",
+    "date",
+    "etag",
+    "expect",
+    "host",
+    "server",
+    "transfer-encoding",
+    "user-agent",
+    "x-amz-api-version",
+    "x-amz-content-sha256",
+    "x-amz-date",
+    "x-amz-id-2",
+    "x-amz-request-id",
+    "x-amz-security-token",
+    "x-amz-target",
+    "x-amzn-requestid",
+    "x-amzn-trace-id"
+};
+
+static char ToLowerAscii(char c)
+{
+    return static_cast<char>(::tolower(static_cast<unsigned char>(c)));
+}
+
+// Compares name in any case with a lower case name, in the byte order of the lower case names.
+static int CompareIgnoringCase(const char* name, const char* lowerCaseName)
+{
+    for (;; ++name, ++lowerCaseName)
+    {
+        const unsigned char left = static_cast<unsigned char>(ToLowerAscii(*name));
+        const unsigned char right = static_cast<unsigned char>(*lowerCaseName);
+        if (left != right || left == 0)
+        {
+            return left < right ? -1 : (left > right ? 1 : 0);
+        }
+    }
+}
+
+static const char* FindWellKnownName(const char* name)
+{
+    const char* const* first = WELL_KNOWN_HEADER_NAMES;
+    const char* const* last = WELL_KNOWN_HEADER_NAMES + sizeof(WELL_KNOWN_HEADER_NAMES) / sizeof(WELL_KNOWN_HEADER_NAMES[0]);
+    auto it = std::lower_bound(first, last, name,
+        [](const char* wellKnownName, const char* value) { return CompareIgnoringCase(value, wellKnownName) > 0; });
+    return it != last && CompareIgnoringCase(name, *it) == 0 ? *it : nullptr;
+}
+
+size_t CompactHeaderCollection::LowerBound(const char* name, bool& found) const
+{
+    size_t first = 0;
+    size_t count = m_entries.size();
+    while (count > 0)
+    {
+        const size_t step = count / 2;
+        if (CompareIgnoringCase(name, m_entries[first + step].GetName()) > 0)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    found = first < m_entries.size() && CompareIgnoringCase(name, m_entries[first].GetName()) == 0;
+    return first;
+}
+
+void CompactHeaderCollection::Set(const char* name, Aws::String&& value)
+{
+    bool found = false;
+    const size_t index = LowerBound(name, found);
+    if (found)
+    {
+        m_entries[index].m_value = std::move(value);
+        return;
+    }
+
+    Entry entry;
+    entry.m_wellKnownName = FindWellKnownName(name);
+    if (!entry.m_wellKnownName)
+    {
+        const size_t length = strlen(name);
+        entry.m_name.resize(length);
+        std::transform(name, name + length, entry.m_name.begin(), ToLowerAscii);
+    }
+    entry.m_value = std::move(value);
+
+    // Requests rarely have more headers than this, one allocation covers them all.
+    if (m_entries.capacity() == 0)
+    {
+        m_entries.reserve(16);
+    }
+    m_entries.insert(m_entries.begin() + index, std::move(entry));
+}
+
+const Aws::String* CompactHeaderCollection::Find(const char* name) const
+{
+    bool found = false;
+    const size_t index = LowerBound(name, found);
+    return found ? &m_entries[index].m_value : nullptr;
+}
+
+bool CompactHeaderCollection::Erase(const char* name)
+{
+    bool found = false;
+    const size_t index = LowerBound(name, found);
+    if (found)
+    {
+        m_entries.erase(m_entries.begin() + index);
+    }
+    return found;
+}
+
+HeaderValueCollection CompactHeaderCollection::ToHeaderValueCollection() const
+{
+    HeaderValueCollection headers;
+    for (const auto& entry : m_entries)
+    {
+        // Already in order: each element goes at the end.
+        headers.emplace_hint(headers.end(), entry.GetName(), entry.m_value);
+    }
+    return headers;
+}
@@ -0,0 +1,110 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/http/EndpointConnectionLimiter.h>
+#include <aws/core/http/Scheme.h>
+#include <aws/core/http/URI.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <cassert>
+
+using namespace Aws::Http;
+
+EndpointConnectionLimiter::EndpointConnectionLimiter(unsigned maxConnectionsPerEndpoint) :
+    m_maxConnectionsPerEndpoint(maxConnectionsPerEndpoint)
+{
+}
+
+bool EndpointConnectionLimiter::Acquire(const Aws::String& endpoint, Aws::Utils::AcquirePriority priority, std::chrono::milliseconds timeout)
+{
+    if (m_maxConnectionsPerEndpoint == 0)
+    {
+        return true;
+    }
+
+    const size_t lane = static_cast<size_t>(priority);
+    std::unique_lock<std::mutex> locker(m_lock);
+    // Entries are only erased once nothing is in flight or waiting for their endpoint, so this one outlives the wait.
+    EndpointConnections& connections = m_endpoints[endpoint];
+    auto ready = [&] { return connections.active < m_maxConnectionsPerEndpoint && !connections.HasWaiters(lane); };
+    bool acquired = true;
+    if (!ready())
+    {
+        ++connections.waiting[lane];
+        if (timeout.count() > 0)
+        {
+            acquired = m_signal.wait_for(locker, timeout, ready);
+        }
+        else
+        {
+            m_signal.wait(locker, ready);
+        }
+        --connections.waiting[lane];
+    }
+
+    if (!acquired)
+    {
+        if (connections.active == 0 && !connections.HasWaiters())
+        {
+            m_endpoints.erase(endpoint);
+            return false;
+        }
+        // Waiters of a lower priority may have been held back by this one.
+        locker.unlock();
+        m_signal.notify_all();
+        return false;
+    }
+
+    ++connections.active;
+    const bool roomLeft = connections.active < m_maxConnectionsPerEndpoint && connections.HasWaiters();
+    locker.unlock();
+    if (roomLeft)
+    {
+        m_signal.notify_all();
+    }
+    return true;
+}
+
+void EndpointConnectionLimiter::Release(const Aws::String& endpoint)
+{
+    if (m_maxConnectionsPerEndpoint == 0)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        auto it = m_endpoints.find(endpoint);
+        assert(it != m_endpoints.end() && it->second.active > 0);
+        if (it == m_endpoints.end())
+        {
+            return;
+        }
+        if (--it->second.active == 0 && !it->second.HasWaiters())
+        {
+            m_endpoints.erase(it);
+            return;
+        }
+    }
+    // Waiters for other endpoints go back to sleep, the waiters of this one recheck their count.
+    m_signal.notify_all();
+}
+
+unsigned EndpointConnectionLimiter::GetActiveConnections(const Aws::String& endpoint) const
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    auto it = m_endpoints.find(endpoint);
+    return it == m_endpoints.end() ? 0 : it->second.active;
+}
+
+Aws::String EndpointConnectionLimiter::GetEndpointKey(const URI& uri)
+{
+    Aws::String key(SchemeMapper::ToString(uri.GetScheme()));
+    key.append("://");
+    key.append(uri.GetAuthority());
+    key.append(":");
+    key.append(Aws::Utils::StringUtils::to_string(uri.GetPort()));
+    return key;
+}
@@ -4,11 +4,23 @@
  */
 
 #include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 using namespace Aws;
 using namespace Aws::Http;
 
+// Connections prewarmed at most by http clients that don't tell their pool size, the default ClientConfiguration::maxConnections.
+static const unsigned DEFAULT_MAX_PREWARMED_CONNECTIONS = 25;
+
 HttpClient::HttpClient() :
     m_disableRequestProcessing( false ),
     m_requestProcessingSignalLock(),
@@ -47,3 +59,47 @@ bool HttpClient::ContinueRequest(const Aws::Http::HttpRequest& request) const
 
     return true;
 }
+
+size_t HttpClient::PrewarmConnections(const URI& uri, unsigned connectionCount,
+    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor) const
+{
+    // More requests than the pool holds would only wait for a connection to be released and reuse it.
+    const unsigned maxConnections = GetMaxConnections();
+    connectionCount = (std::min)(connectionCount, maxConnections > 0 ? maxConnections : DEFAULT_MAX_PREWARMED_CONNECTIONS);
+
+    std::atomic<size_t> opened(0);
+    std::mutex pendingLock;
+    std::condition_variable pendingSignal;
+    unsigned pending = connectionCount;
+    auto prewarm = [&]()
+    {
+        auto request = CreateHttpRequest(uri, HttpMethod::HTTP_HEAD, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto response = MakeRequest(request);
+        if (response && !response->HasClientError() && response->GetResponseCode() != HttpResponseCode::REQUEST_NOT_MADE)
+        {
+            ++opened;
+        }
+        std::lock_guard<std::mutex> locker(pendingLock);
+        if (--pending == 0)
+        {
+            pendingSignal.notify_all();
+        }
+    };
+
+    // Concurrent requests can't share a connection, each one makes the pool open its own.
+    Aws::Vector<std::thread> threads;
+    for (unsigned i = 0; i < connectionCount; ++i)
+    {
+        if (!executor || !executor->Submit(prewarm))
+        {
+            threads.emplace_back(prewarm);
+        }
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    std::unique_lock<std::mutex> locker(pendingLock);
+    pendingSignal.wait(locker, [&]() { return pending == 0; });
+    return opened.load();
+}
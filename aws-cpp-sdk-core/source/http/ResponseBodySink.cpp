@@ -0,0 +1,43 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/http/ResponseBodySink.h>
+#include <cstring>
+
+using namespace Aws::Http;
+
+CallbackResponseBodySink::CallbackResponseBodySink(const WriteCallback& onWrite, const ResetCallback& onReset) :
+    m_onWrite(onWrite), m_onReset(onReset)
+{
+}
+
+void CallbackResponseBodySink::Reset()
+{
+    if (m_onReset)
+    {
+        m_onReset();
+    }
+}
+
+bool CallbackResponseBodySink::Write(const char* data, size_t length)
+{
+    return m_onWrite(data, length);
+}
+
+BufferResponseBodySink::BufferResponseBodySink(unsigned char* buffer, size_t capacity) :
+    m_buffer(buffer), m_capacity(capacity), m_bytesWritten(0)
+{
+}
+
+bool BufferResponseBodySink::Write(const char* data, size_t length)
+{
+    if (length > m_capacity - m_bytesWritten)
+    {
+        return false;
+    }
+    memcpy(m_buffer + m_bytesWritten, data, length);
+    m_bytesWritten += length;
+    return true;
+}
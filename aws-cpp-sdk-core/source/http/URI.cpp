@@ -6,14 +6,14 @@
 #include <aws/core/http/URI.h>
 
 #include <aws/core/utils/StringUtils.h>
-#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/PercentEncoder.h>
 #include <aws/core/utils/memory/stl/AWSSet.h>
 
 #include <cstdlib>
+#include <cstring>
 #include <cctype>
 #include <cassert>
 #include <algorithm>
-#include <iomanip>
 
 using namespace Aws::Http;
 using namespace Aws::Utils;
@@ -100,6 +100,27 @@ void URI::SetScheme(Scheme value)
     }
 }
 
+// Appends "/" and the encoding of every non empty segment of path, the way joining StringUtils::Split(path, '/') would.
+static void AppendEncodedPathSegments(const Aws::String& path, const PercentEncoder& encoder, Aws::String& output)
+{
+    size_t segmentStart = 0;
+    while (segmentStart < path.size())
+    {
+        size_t segmentEnd = path.find('/', segmentStart);
+        if (segmentEnd == Aws::String::npos)
+        {
+            segmentEnd = path.size();
+        }
+
+        if (segmentEnd > segmentStart)
+        {
+            output.push_back('/');
+            encoder.Append(path.c_str() + segmentStart, segmentEnd - segmentStart, output);
+        }
+        segmentStart = segmentEnd + 1;
+    }
+}
+
 Aws::String URI::URLEncodePathRFC3986(const Aws::String& path)
 {
     if(path.empty())
@@ -107,73 +128,45 @@ Aws::String URI::URLEncodePathRFC3986(const Aws::String& path)
         return path;
     }
 
-    const Aws::Vector<Aws::String> pathParts = StringUtils::Split(path, '/');
-    Aws::StringStream ss;
-    ss << std::hex << std::uppercase;
+    // escape characters appearing in a URL path according to RFC 3986:
+    // §2.3 unreserved characters are alphanumerics and "-_.~".
+    // The path section of the URL allow reserved characters to appear unescaped (RFC 3986 §2.2 Reserved characters).
+    // NOTE: this implementation does not accurately implement the RFC on purpose to accommodate for
+    // discrepancies in the implementations of URL encoding between AWS services for legacy reasons.
+    static const PercentEncoder encoder("-_.~$&,:=@");
 
-    // escape characters appearing in a URL path according to RFC 3986
-    for (const auto& segment : pathParts)
-    {
-        ss << '/';
-        for(unsigned char c : segment) // alnum results in UB if the value of c is not unsigned char & is not EOF
-        {
-            // §2.3 unreserved characters
-            if (StringUtils::IsAlnum(c))
-            {
-                ss << c;
-                continue;
-            }
-            switch(c)
-            {
-                // §2.3 unreserved characters
-                case '-': case '_': case '.': case '~':
-                // The path section of the URL allow reserved characters to appear unescaped
-                // RFC 3986 §2.2 Reserved characters
-                // NOTE: this implementation does not accurately implement the RFC on purpose to accommodate for
-                // discrepancies in the implementations of URL encoding between AWS services for legacy reasons.
-                case '$': case '&': case ',':
-                case ':': case '=': case '@':
-                    ss << c;
-                    break;
-                default:
-                    ss << '%' << std::setfill('0') << std::setw(2) << (int)((unsigned char)c) << std::setw(0);
-            }
-        }
-    }
+    Aws::String encoded;
+    encoded.reserve(path.size() + path.size() / 2);
+    AppendEncodedPathSegments(path, encoder, encoded);
 
     //if the last character was also a slash, then add that back here.
     if (path.back() == '/')
     {
-        ss << '/';
+        encoded.push_back('/');
     }
 
-    return ss.str();
+    return encoded;
 }
 
 Aws::String URI::URLEncodePath(const Aws::String& path)
 {
-    Aws::Vector<Aws::String> pathParts = StringUtils::Split(path, '/');
-    Aws::StringStream ss;
+    static const PercentEncoder encoder("-_.~");
 
-    for (Aws::Vector<Aws::String>::iterator iter = pathParts.begin(); iter != pathParts.end(); ++iter)
-    {
-        ss << '/' << StringUtils::URLEncode(iter->c_str());
-    }
+    Aws::String encoded;
+    encoded.reserve(path.size() + path.size() / 2);
+    AppendEncodedPathSegments(path, encoder, encoded);
 
     //if the last character was also a slash, then add that back here.
     if (path.length() > 0 && path[path.length() - 1] == '/')
     {
-        ss << '/';
+        encoded.push_back('/');
     }
 
     if (path.length() > 0 && path[0] != '/')
     {
-        return ss.str().substr(1);
-    }
-    else
-    {
-        return ss.str();
+        encoded.erase(0, 1);
     }
+    return encoded;
 }
 
 void URI::SetPath(const Aws::String& value)
@@ -266,30 +259,30 @@ QueryStringParameterCollection URI::GetQueryStringParameters(bool decode) const
 void URI::CanonicalizeQueryString()
 {
     QueryStringParameterCollection sortedParameters = GetQueryStringParameters(false);
-    Aws::StringStream queryStringStream;
-
-    bool first = true;
-
-    if(sortedParameters.size() > 0)
-    {
-        queryStringStream << "?";
-    }
 
     if(m_queryString.find('=') != std::string::npos)
     {
+        Aws::String canonicalQueryString;
+        canonicalQueryString.reserve(m_queryString.size());
+        if(sortedParameters.size() > 0)
+        {
+            canonicalQueryString.push_back('?');
+        }
+
+        bool first = true;
         for (QueryStringParameterCollection::iterator iter = sortedParameters.begin();
              iter != sortedParameters.end(); ++iter)
         {
             if (!first)
             {
-                queryStringStream << "&";
+                canonicalQueryString.push_back('&');
             }
 
             first = false;
-            queryStringStream << iter->first.c_str() << "=" << iter->second.c_str();
+            canonicalQueryString.append(iter->first.c_str()).append("=").append(iter->second.c_str());
         }
 
-        m_queryString = queryStringStream.str();
+        m_queryString = std::move(canonicalQueryString);
     }
 }
 
@@ -304,7 +297,10 @@ void URI::AddQueryStringParameter(const char* key, const Aws::String& value)
         m_queryString.append("&");
     }
 
-    m_queryString.append(StringUtils::URLEncode(key) + "=" + StringUtils::URLEncode(value.c_str()));
+    static const PercentEncoder encoder("-_.~");
+    encoder.Append(key, strlen(key), m_queryString);
+    m_queryString.push_back('=');
+    encoder.Append(value.c_str(), strlen(value.c_str()), m_queryString);
 }
 
 void URI::AddQueryStringParameter(const Aws::Map<Aws::String, Aws::String>& queryStringPairs)
@@ -335,29 +331,28 @@ Aws::String URI::GetURIString(bool includeQueryString) const
 {
     assert(m_authority.size() > 0);
 
-    Aws::StringStream ss;
-    ss << SchemeMapper::ToString(m_scheme) << SEPARATOR << m_authority;
+    const char* scheme = SchemeMapper::ToString(m_scheme);
+    Aws::String uriString;
+    uriString.reserve(strlen(scheme) + 3 + m_authority.size() + 6 + m_path.size() * 2 + m_queryString.size());
+    uriString.append(scheme).append(SEPARATOR).append(m_authority);
 
-    if (m_scheme == Scheme::HTTP && m_port != HTTP_DEFAULT_PORT)
-    {
-        ss << ":" << m_port;
-    }
-    else if (m_scheme == Scheme::HTTPS && m_port != HTTPS_DEFAULT_PORT)
+    if ((m_scheme == Scheme::HTTP && m_port != HTTP_DEFAULT_PORT) ||
+        (m_scheme == Scheme::HTTPS && m_port != HTTPS_DEFAULT_PORT))
     {
-        ss << ":" << m_port;
+        uriString.append(":").append(StringUtils::to_string(m_port));
     }
 
     if(m_path != "/")
     {
-        ss << URLEncodePathRFC3986(m_path);
+        uriString.append(URLEncodePathRFC3986(m_path));
     }
 
     if(includeQueryString)
     {
-        ss << m_queryString;
+        uriString.append(m_queryString);
     }
 
-    return ss.str();
+    return uriString;
 }
 
 void URI::ParseURIParts(const Aws::String& uri)
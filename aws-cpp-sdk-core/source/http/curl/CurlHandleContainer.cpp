@@ -5,6 +5,7 @@
 
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/Probes.h>
 
 #include <algorithm>
 
@@ -12,19 +13,37 @@ using namespace Aws::Utils::Logging;
 using namespace Aws::Http;
 
 static const char* CURL_HANDLE_CONTAINER_TAG = "CurlHandleContainer";
+static const std::chrono::milliseconds MIN_REAPER_INTERVAL(100);
 
 
 CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long httpRequestTimeout, long connectTimeout, bool enableTcpKeepAlive,
-                                        unsigned long tcpKeepAliveIntervalMs, long lowSpeedTime, unsigned long lowSpeedLimit) :
+                                        unsigned long tcpKeepAliveIntervalMs, long lowSpeedTime, unsigned long lowSpeedLimit,
+                                        unsigned long maxIdleTimeMs, unsigned long maxLifetimeMs, unsigned long acquireTimeoutMs) :
                 m_maxPoolSize(maxSize), m_httpRequestTimeout(httpRequestTimeout), m_connectTimeout(connectTimeout), m_enableTcpKeepAlive(enableTcpKeepAlive),
-                m_tcpKeepAliveIntervalMs(tcpKeepAliveIntervalMs), m_lowSpeedTime(lowSpeedTime), m_lowSpeedLimit(lowSpeedLimit), m_poolSize(0)
+                m_tcpKeepAliveIntervalMs(tcpKeepAliveIntervalMs), m_lowSpeedTime(lowSpeedTime), m_lowSpeedLimit(lowSpeedLimit), m_poolSize(0),
+                m_maxIdleTime(maxIdleTimeMs), m_maxLifetime(maxLifetimeMs), m_acquireTimeout(acquireTimeoutMs), m_inUse(0), m_acquireCount(0),
+                m_acquireTimeoutCount(0), m_totalAcquireWait(0),
+                m_maxAcquireWait(0), m_idleConnectionsClosed(0), m_expiredConnectionsClosed(0), m_stopReaper(false)
 {
     AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Initializing CurlHandleContainer with size " << maxSize);
+    if (maxIdleTimeMs > 0 || maxLifetimeMs > 0)
+    {
+        m_reaper = std::thread(&CurlHandleContainer::ReaperLoop, this);
+    }
 }
 
 CurlHandleContainer::~CurlHandleContainer()
 {
     AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Cleaning up CurlHandleContainer.");
+    if (m_reaper.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_reaperLock);
+            m_stopReaper = true;
+        }
+        m_reaperSignal.notify_one();
+        m_reaper.join();
+    }
     for (CURL* handle : m_handleContainer.ShutdownAndWait(m_poolSize))
     {
         AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Cleaning up " << handle);
@@ -32,17 +51,69 @@ CurlHandleContainer::~CurlHandleContainer()
     }
 }
 
-CURL* CurlHandleContainer::AcquireCurlHandle()
+CURL* CurlHandleContainer::AcquireCurlHandle(Aws::Utils::AcquirePriority priority)
+{
+    return AcquireCurlHandle(priority, m_acquireTimeout);
+}
+
+CURL* CurlHandleContainer::AcquireCurlHandle(Aws::Utils::AcquirePriority priority, std::chrono::milliseconds acquireTimeout,
+                                             CurlHandleAcquireFailure* failure)
 {
     AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Attempting to acquire curl connection.");
+    AWS_SDK_PROBE1(curl__acquire__start, this);
 
+    if (failure)
+    {
+        *failure = CurlHandleAcquireFailure::NONE;
+    }
+    const auto start = std::chrono::steady_clock::now();
     if(!m_handleContainer.HasResourcesAvailable())
     {
         AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "No current connections available in pool. Attempting to create new connections.");
-        CheckAndGrowPool();
+        if (!CheckAndGrowPool())
+        {
+            std::lock_guard<std::mutex> locker(m_containerLock);
+            if (m_poolSize == 0)
+            {
+                // Nothing to wait for.
+                AWS_LOGSTREAM_ERROR(CURL_HANDLE_CONTAINER_TAG, "No curl handle could be created.");
+                if (failure)
+                {
+                    *failure = CurlHandleAcquireFailure::CREATION_FAILED;
+                }
+                return nullptr;
+            }
+        }
     }
 
-    CURL* handle = m_handleContainer.Acquire();
+    CURL* handle = nullptr;
+    if (acquireTimeout.count() > 0)
+    {
+        if (!m_handleContainer.TryAcquire(handle, acquireTimeout, priority))
+        {
+            AWS_LOGSTREAM_WARN(CURL_HANDLE_CONTAINER_TAG, "Timed out after " << acquireTimeout.count() << "ms waiting for a curl handle.");
+            if (failure)
+            {
+                *failure = CurlHandleAcquireFailure::TIMED_OUT;
+            }
+            std::lock_guard<std::mutex> locker(m_containerLock);
+            ++m_acquireTimeoutCount;
+            return nullptr;
+        }
+    }
+    else
+    {
+        handle = m_handleContainer.Acquire(priority);
+    }
+    const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    {
+        std::lock_guard<std::mutex> locker(m_containerLock);
+        ++m_inUse;
+        ++m_acquireCount;
+        m_totalAcquireWait += wait;
+        m_maxAcquireWait = (std::max)(m_maxAcquireWait, wait);
+    }
+    AWS_SDK_PROBE2(curl__acquire, this, handle);
     AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Connection has been released. Continuing.");
     AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Returning connection handle " << handle);
     return handle;
@@ -52,9 +123,39 @@ void CurlHandleContainer::ReleaseCurlHandle(CURL* handle)
 {
     if (handle)
     {
-        curl_easy_reset(handle);
-        SetDefaultOptionsOnHandle(handle);
+        CURL* expired = nullptr;
+        {
+            std::lock_guard<std::mutex> locker(m_containerLock);
+            --m_inUse;
+            const auto now = std::chrono::steady_clock::now();
+            auto times = m_handleTimes.find(handle);
+            if (times != m_handleTimes.end() && IsExpired(times->second, now))
+            {
+                // Swap in a fresh handle rather than shrinking the pool, threads may be waiting for this one.
+                CURL* replacement = CreateCurlHandle();
+                if (replacement)
+                {
+                    m_handleTimes.erase(times);
+                    ++m_expiredConnectionsClosed;
+                    expired = handle;
+                    handle = replacement;
+                }
+            }
+            m_handleTimes[handle].released = now;
+        }
+
+        if (expired)
+        {
+            AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Curl handle " << expired << " reached its max lifetime, replaced it with " << handle);
+            curl_easy_cleanup(expired);
+        }
+        else
+        {
+            curl_easy_reset(handle);
+            SetDefaultOptionsOnHandle(handle);
+        }
         AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Releasing curl handle " << handle);
+        AWS_SDK_PROBE2(curl__release, this, handle);
         m_handleContainer.Release(handle);
         AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Notified waiting threads.");
     }
@@ -71,6 +172,8 @@ void CurlHandleContainer::DestroyCurlHandle(CURL* handle)
     {
         std::lock_guard<std::mutex> locker(m_containerLock);
         m_poolSize--;
+        m_inUse--;
+        m_handleTimes.erase(handle);
     }
     AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Destroy curl handle: " << handle << " and decrease pool size by 1.");
 }
@@ -87,11 +190,10 @@ bool CurlHandleContainer::CheckAndGrowPool()
         unsigned actuallyAdded = 0;
         for (unsigned i = 0; i < amountToAdd; ++i)
         {
-            CURL* curlHandle = curl_easy_init();
+            CURL* curlHandle = CreateCurlHandle();
 
             if (curlHandle)
             {
-                SetDefaultOptionsOnHandle(curlHandle);
                 m_handleContainer.Release(curlHandle);
                 ++actuallyAdded;
             }
@@ -104,6 +206,7 @@ bool CurlHandleContainer::CheckAndGrowPool()
 
         AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Pool grown by " << actuallyAdded);
         m_poolSize += actuallyAdded;
+        AWS_SDK_PROBE3(curl__grow, this, actuallyAdded, m_poolSize);
 
         return actuallyAdded > 0;
     }
@@ -113,6 +216,100 @@ bool CurlHandleContainer::CheckAndGrowPool()
     return false;
 }
 
+CURL* CurlHandleContainer::CreateCurlHandle()
+{
+    CURL* handle = curl_easy_init();
+    if (handle)
+    {
+        SetDefaultOptionsOnHandle(handle);
+        const auto now = std::chrono::steady_clock::now();
+        HandleTimes& times = m_handleTimes[handle];
+        times.created = now;
+        times.released = now;
+    }
+    return handle;
+}
+
+bool CurlHandleContainer::IsExpired(const HandleTimes& times, std::chrono::steady_clock::time_point now) const
+{
+    return m_maxLifetime.count() > 0 && now - times.created >= m_maxLifetime;
+}
+
+void CurlHandleContainer::ReapConnections()
+{
+    Aws::Vector<CURL*> closed;
+    {
+        std::lock_guard<std::mutex> locker(m_containerLock);
+        const auto now = std::chrono::steady_clock::now();
+        closed = m_handleContainer.RemoveAvailableIf([&](CURL* handle)
+        {
+            auto times = m_handleTimes.find(handle);
+            if (times == m_handleTimes.end())
+            {
+                return false;
+            }
+            if (IsExpired(times->second, now))
+            {
+                ++m_expiredConnectionsClosed;
+            }
+            else if (m_maxIdleTime.count() > 0 && now - times->second.released >= m_maxIdleTime)
+            {
+                ++m_idleConnectionsClosed;
+            }
+            else
+            {
+                return false;
+            }
+            m_handleTimes.erase(times);
+            return true;
+        });
+        m_poolSize -= static_cast<unsigned>(closed.size());
+    }
+
+    if (!closed.empty())
+    {
+        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Closing " << closed.size() << " idle or expired curl handles.");
+    }
+    for (CURL* handle : closed)
+    {
+        curl_easy_cleanup(handle);
+    }
+}
+
+void CurlHandleContainer::ReaperLoop()
+{
+    std::chrono::milliseconds interval = m_maxIdleTime.count() > 0 ? m_maxIdleTime : m_maxLifetime;
+    if (m_maxLifetime.count() > 0)
+    {
+        interval = (std::min)(interval, m_maxLifetime);
+    }
+    // Half the limit, so that a connection outlives it by at most that much.
+    interval = (std::max)(interval / 2, MIN_REAPER_INTERVAL);
+
+    std::unique_lock<std::mutex> locker(m_reaperLock);
+    while (!m_reaperSignal.wait_for(locker, interval, [this] { return m_stopReaper; }))
+    {
+        locker.unlock();
+        ReapConnections();
+        locker.lock();
+    }
+}
+
+ConnectionPoolMetrics CurlHandleContainer::GetMetrics() const
+{
+    ConnectionPoolMetrics metrics;
+    std::lock_guard<std::mutex> locker(m_containerLock);
+    metrics.poolSize = m_poolSize;
+    metrics.inUse = m_inUse;
+    metrics.acquireCount = m_acquireCount;
+    metrics.acquireTimeoutCount = m_acquireTimeoutCount;
+    metrics.totalAcquireWait = m_totalAcquireWait;
+    metrics.maxAcquireWait = m_maxAcquireWait;
+    metrics.idleConnectionsClosed = m_idleConnectionsClosed;
+    metrics.expiredConnectionsClosed = m_expiredConnectionsClosed;
+    return metrics;
+}
+
 void CurlHandleContainer::SetDefaultOptionsOnHandle(CURL* handle)
 {
     //for timeouts to work in a multi-threaded context,
@@ -9,6 +9,8 @@
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/stream/SegmentedStreamBuf.h>
+#include <aws/core/utils/stream/FileBodyStreamBuf.h>
 #include <aws/core/utils/DateTime.h>
 #include <aws/core/monitoring/HttpClientMetrics.h>
 #include <cassert>
@@ -125,11 +127,16 @@ struct CurlWriteCallbackContext
     CurlWriteCallbackContext(const CurlHttpClient* client,
                              HttpRequest* request,
                              HttpResponse* response,
-                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
+                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter,
+                             CURL* connectionHandle) :
         m_client(client),
         m_request(request),
         m_response(response),
         m_rateLimiter(rateLimiter),
+        m_connectionHandle(connectionHandle),
+        m_bodySink(nullptr),
+        m_bodySinkChecked(false),
+        m_bodySinkRefused(false),
         m_numBytesResponseReceived(0)
     {}
 
@@ -137,6 +144,10 @@ struct CurlWriteCallbackContext
     HttpRequest* m_request;
     HttpResponse* m_response;
     Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    CURL* m_connectionHandle;
+    ResponseBodySink* m_bodySink; // set once the response code is known to be successful
+    bool m_bodySinkChecked;
+    bool m_bodySinkRefused;
     int64_t m_numBytesResponseReceived;
 };
 
@@ -154,6 +165,8 @@ struct CurlReadCallbackContext
 };
 
 static const char* CURL_HTTP_CLIENT_TAG = "CurlHttpClient";
+// Upload buffer size for file bodies, curl defaults to 64KB.
+static const long FILE_BODY_UPLOAD_BUFFER_SIZE = 512 * 1024;
 
 static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
@@ -174,7 +187,33 @@ static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
             context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(sizeToWrite));
         }
 
-        response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        // Only successful bodies go to the sink, error bodies are needed in the response stream by the error marshallers.
+        if (!context->m_bodySinkChecked)
+        {
+            context->m_bodySinkChecked = true;
+            ResponseBodySink* sink = context->m_request->GetResponseBodySink().get();
+            long responseCode = 0;
+            if (sink && curl_easy_getinfo(context->m_connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode) == CURLE_OK &&
+                responseCode >= 200 && responseCode < 300)
+            {
+                sink->Reset();
+                context->m_bodySink = sink;
+            }
+        }
+
+        if (context->m_bodySink)
+        {
+            if (!context->m_bodySink->Write(ptr, sizeToWrite))
+            {
+                AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body sink refused " << sizeToWrite << " bytes, aborting the transfer.");
+                context->m_bodySinkRefused = true;
+                return 0;
+            }
+        }
+        else
+        {
+            response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        }
         auto& receivedHandler = context->m_request->GetDataReceivedEventHandler();
         if (receivedHandler)
         {
@@ -228,8 +267,22 @@ static size_t ReadBody(char* ptr, size_t size, size_t nmemb, void* userdata)
     const size_t amountToRead = size * nmemb;
     if (ioStream != nullptr && amountToRead > 0)
     {
-        ioStream->read(ptr, amountToRead);
-        size_t amountRead = static_cast<size_t>(ioStream->gcount());
+        size_t amountRead = 0;
+        // Scatter-gather bodies are copied straight from their segments, without going through the stream.
+        if (auto segmentedBody = Aws::Utils::Stream::SegmentedStream::GetSegmentedStreamBuf(*ioStream))
+        {
+            amountRead = static_cast<size_t>(segmentedBody->sgetn(ptr, static_cast<std::streamsize>(amountToRead)));
+        }
+        // File bodies are read from the file straight into curl's buffer.
+        else if (auto fileBody = Aws::Utils::Stream::FileBodyStream::GetFileBodyStreamBuf(*ioStream))
+        {
+            amountRead = static_cast<size_t>(fileBody->sgetn(ptr, static_cast<std::streamsize>(amountToRead)));
+        }
+        else
+        {
+            ioStream->read(ptr, amountToRead);
+            amountRead = static_cast<size_t>(ioStream->gcount());
+        }
         auto& sentHandler = request->GetDataSentEventHandler();
         if (sentHandler)
         {
@@ -289,6 +342,23 @@ static size_t SeekBody(void* userdata, curl_off_t offset, int origin)
     return CURL_SEEKFUNC_OK;
 }
 
+// timeoutMs of 0 means no timeout to curl.
+static long CapTimeout(unsigned long timeoutMs, long long capMs)
+{
+    return static_cast<long>(timeoutMs == 0 ? capMs : (std::min)(static_cast<long long>(timeoutMs), capMs));
+}
+
+// What is left of timeout since start, at least 1ms so that it still means a timeout. A timeout of 0 means none.
+static std::chrono::milliseconds RemainingTimeout(std::chrono::milliseconds timeout, std::chrono::steady_clock::time_point start)
+{
+    if (timeout.count() == 0)
+    {
+        return timeout;
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    return (std::max)(timeout - elapsed, std::chrono::milliseconds(1));
+}
+
 void SetOptCodeForHttpMethod(CURL* requestHandle, const std::shared_ptr<HttpRequest>& request)
 {
     switch (request->GetMethod())
@@ -421,7 +491,9 @@ int CurlDebugCallback(CURL *handle, curl_infotype type, char *data, size_t size,
 CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     Base(),
     m_curlHandleContainer(clientConfig.maxConnections, clientConfig.httpRequestTimeoutMs, clientConfig.connectTimeoutMs, clientConfig.enableTcpKeepAlive,
-                          clientConfig.tcpKeepAliveIntervalMs, clientConfig.requestTimeoutMs, clientConfig.lowSpeedLimit),
+                          clientConfig.tcpKeepAliveIntervalMs, clientConfig.requestTimeoutMs, clientConfig.lowSpeedLimit,
+                          clientConfig.connectionMaxIdleMs, clientConfig.connectionMaxLifetimeMs, clientConfig.connectionAcquireTimeoutMs),
+    m_endpointLimiter(clientConfig.maxConnectionsPerEndpoint),
     m_isUsingProxy(!clientConfig.proxyHost.empty()), m_proxyUserName(clientConfig.proxyUserName),
     m_proxyPassword(clientConfig.proxyPassword), m_proxyScheme(SchemeMapper::ToString(clientConfig.proxyScheme)), m_proxyHost(clientConfig.proxyHost),
     m_proxySSLCertPath(clientConfig.proxySSLCertPath), m_proxySSLCertType(clientConfig.proxySSLCertType),
@@ -429,7 +501,9 @@ CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     m_proxyKeyPasswd(clientConfig.proxySSLKeyPassword),
     m_proxyPort(clientConfig.proxyPort), m_verifySSL(clientConfig.verifySSL), m_caPath(clientConfig.caPath),
     m_caFile(clientConfig.caFile),
-    m_disableExpectHeader(clientConfig.disableExpectHeader)
+    m_disableExpectHeader(clientConfig.disableExpectHeader),
+    m_enableResponseDecompression(clientConfig.enableResponseDecompression),
+    m_dnsResolver(clientConfig.dnsResolver)
 {
     if (clientConfig.followRedirects == FollowRedirectsPolicy::NEVER ||
        (clientConfig.followRedirects == FollowRedirectsPolicy::DEFAULT && clientConfig.region == Aws::Region::AWS_GLOBAL))
@@ -459,18 +533,15 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
         writeLimiter->ApplyAndPayForCost(request->GetSize());
     }
 
-    Aws::StringStream headerStream;
-    HeaderValueCollection requestHeaders = request->GetHeaders();
+    Aws::String headerString;
 
     AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Including headers:");
-    for (auto& requestHeader : requestHeaders)
+    request->ForEachHeader([&](const char* name, const Aws::String& value)
     {
-        headerStream.str("");
-        headerStream << requestHeader.first << ": " << requestHeader.second;
-        Aws::String headerString = headerStream.str();
+        headerString.assign(name).append(": ").append(value);
         AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, headerString);
         headers = curl_slist_append(headers, headerString.c_str());
-    }
+    });
 
     if (!request->HasHeader(Http::TRANSFER_ENCODING_HEADER))
     {
@@ -493,22 +564,61 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
         headers = curl_slist_append(headers, "Expect:");
     }
 
-    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
+    Aws::Utils::DateTime startAcquireTime = Aws::Utils::DateTime::Now();
+    // Waiting for the endpoint to fall under its limit counts as acquiring the connection, both waits share the acquire timeout.
+    const auto acquireStart = std::chrono::steady_clock::now();
+    auto acquireTimeout = m_curlHandleContainer.GetAcquireTimeout();
+    if (request->HasDeadline())
+    {
+        // Nor do they go past the deadline of the call.
+        const auto remaining = (std::max)(std::chrono::duration_cast<std::chrono::milliseconds>(request->GetDeadline() - acquireStart),
+            std::chrono::milliseconds(1));
+        acquireTimeout = acquireTimeout.count() == 0 ? remaining : (std::min)(acquireTimeout, remaining);
+    }
+    const Aws::String endpoint = m_endpointLimiter.GetMaxConnectionsPerEndpoint() > 0 ? EndpointConnectionLimiter::GetEndpointKey(uri) : Aws::String();
+    const bool requestProcessingEnabled = IsRequestProcessingEnabled();
+    bool endpointAcquired = false;
+    CURL* connectionHandle = nullptr;
+    CurlHandleAcquireFailure acquireFailure = CurlHandleAcquireFailure::NONE;
+    if (requestProcessingEnabled)
+    {
+        endpointAcquired = m_endpointLimiter.Acquire(endpoint, request->GetRequestPriority(), acquireTimeout);
+        if (endpointAcquired)
+        {
+            connectionHandle = m_curlHandleContainer.AcquireCurlHandle(request->GetRequestPriority(),
+                RemainingTimeout(acquireTimeout, acquireStart), &acquireFailure);
+        }
+        else
+        {
+            AWS_LOGSTREAM_WARN(CURL_HTTP_CLIENT_TAG, "Timed out after " << acquireTimeout.count() << "ms waiting for a connection to " << endpoint);
+            acquireFailure = CurlHandleAcquireFailure::TIMED_OUT;
+        }
+    }
 
     if (connectionHandle)
     {
         AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Obtained connection handle " << connectionHandle);
+        request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::AcquireConnectionLatency), (DateTime::Now() - startAcquireTime).count());
 
         if (headers)
         {
             curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
         }
 
-        CurlWriteCallbackContext writeContext(this, request.get(), response.get(), readLimiter);
+        CurlWriteCallbackContext writeContext(this, request.get(), response.get(), readLimiter, connectionHandle);
         CurlReadCallbackContext readContext(this, request.get(), writeLimiter);
 
         SetOptCodeForHttpMethod(connectionHandle, request);
 
+        // The attempt only gets the time left before the deadline of the call.
+        if (request->HasDeadline())
+        {
+            const long long remainingMs = (std::max)(static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                request->GetDeadline() - std::chrono::steady_clock::now()).count()), 1LL);
+            curl_easy_setopt(connectionHandle, CURLOPT_TIMEOUT_MS, CapTimeout(m_curlHandleContainer.GetHttpRequestTimeout(), remainingMs));
+            curl_easy_setopt(connectionHandle, CURLOPT_CONNECTTIMEOUT_MS, CapTimeout(m_curlHandleContainer.GetConnectTimeout(), remainingMs));
+        }
+
         curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
         curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, WriteData);
         curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
@@ -556,6 +666,12 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
             curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
         }
 
+        if (m_enableResponseDecompression)
+        {
+            // An empty string asks for every encoding this curl was built to decode, and decodes the body as it's received.
+            curl_easy_setopt(connectionHandle, CURLOPT_ACCEPT_ENCODING, "");
+        }
+
 #ifdef ENABLE_CURL_LOGGING
         curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
         curl_easy_setopt(connectionHandle, CURLOPT_DEBUGFUNCTION, CurlDebugCallback);
@@ -599,18 +715,55 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
             curl_easy_setopt(connectionHandle, CURLOPT_PROXY, "");
         }
 
+        // Through a proxy, the proxy resolves the host.
+        struct curl_slist* resolve = nullptr;
+        Aws::String resolvedAddress;
+        if (m_dnsResolver && !m_isUsingProxy)
+        {
+            Aws::StringStream hostAndPort;
+            hostAndPort << uri.GetAuthority() << ":" << uri.GetPort();
+#if LIBCURL_VERSION_NUM >= 0x072A00 // 7.42.0
+            // Curl keeps resolve entries in the DNS cache of the handle, which curl_easy_reset doesn't clear. The address a
+            // previous request pinned on this handle is removed first, so that it's neither used again nor kept over a new one.
+            resolve = curl_slist_append(resolve, ("-" + hostAndPort.str()).c_str());
+#endif
+            resolvedAddress = m_dnsResolver->AcquireAddress(uri.GetAuthority());
+            if (!resolvedAddress.empty())
+            {
+                const bool isIpv6 = resolvedAddress.find(':') != Aws::String::npos;
+                Aws::StringStream ss;
+                ss << hostAndPort.str() << ":" << (isIpv6 ? "[" : "") << resolvedAddress << (isIpv6 ? "]" : "");
+                resolve = curl_slist_append(resolve, ss.str().c_str());
+            }
+            // Only used when this handle opens a new connection, an open one to the host is reused as it is.
+            curl_easy_setopt(connectionHandle, CURLOPT_RESOLVE, resolve);
+        }
+
         if (request->GetContentBody())
         {
             curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, ReadBody);
             curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
             curl_easy_setopt(connectionHandle, CURLOPT_SEEKFUNCTION, SeekBody);
             curl_easy_setopt(connectionHandle, CURLOPT_SEEKDATA, &readContext);
+#if LIBCURL_VERSION_NUM >= 0x073E00 // 7.62.0
+            // Fewer, larger reads from the file. The handle is reset to the default buffer size when it goes back to the pool.
+            if (Aws::Utils::Stream::FileBodyStream::GetFileBodyStreamBuf(*request->GetContentBody()))
+            {
+                curl_easy_setopt(connectionHandle, CURLOPT_UPLOAD_BUFFERSIZE, FILE_BODY_UPLOAD_BUFFER_SIZE);
+            }
+#endif
         }
         OverrideOptionsOnConnectionHandle(connectionHandle);
         Aws::Utils::DateTime startTransmissionTime = Aws::Utils::DateTime::Now();
         CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
         bool shouldContinueRequest = ContinueRequest(*request);
-        if (curlResponseCode != CURLE_OK && shouldContinueRequest)
+        if (writeContext.m_bodySinkRefused)
+        {
+            // Not a network error: sending the request again would not help.
+            response->SetClientErrorType(CoreErrors::USER_CANCELLED);
+            response->SetClientErrorMessage("Response body sink refused the response body");
+        }
+        else if (curlResponseCode != CURLE_OK && shouldContinueRequest)
         {
             response->SetClientErrorType(CoreErrors::NETWORK_CONNECTION);
             Aws::StringStream ss;
@@ -641,7 +794,9 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
 
             if (request->GetMethod() != HttpMethod::HTTP_HEAD &&
                 writeContext.m_client->IsRequestProcessingEnabled() &&
-                response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
+                response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER) &&
+                // The content-length is the one of the encoded body, curl hands over the decoded one.
+                !(m_enableResponseDecompression && response->HasHeader(Aws::Http::CONTENT_ENCODING_HEADER)))
             {
                 const Aws::String& contentLength = response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER);
                 int64_t numBytesResponseReceived = writeContext.m_numBytesResponseReceived;
@@ -671,10 +826,35 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
             request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency), static_cast<int64_t>(timep * 1000));
         }
 
-        ret = curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &timep); // Ssl Latency
+        // Curl reports the following as times elapsed since the start of the transfer, turn them into the duration of each phase.
+        double nameLookupTime = 0, connectTime = 0, appConnectTime = 0, preTransferTime = 0, startTransferTime = 0, totalTime = 0;
+        if (curl_easy_getinfo(connectionHandle, CURLINFO_NAMELOOKUP_TIME, &nameLookupTime) == CURLE_OK &&
+            curl_easy_getinfo(connectionHandle, CURLINFO_CONNECT_TIME, &connectTime) == CURLE_OK && connectTime > 0)
+        {
+            request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::TcpLatency), static_cast<int64_t>((connectTime - nameLookupTime) * 1000));
+        }
+
+        ret = curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &appConnectTime); // Ssl Latency
         if (ret == CURLE_OK)
         {
-            request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(timep * 1000));
+            // Since the start of the transfer, as it always was.
+            request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(appConnectTime * 1000));
+            if (appConnectTime > 0)
+            {
+                request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::TlsHandshakeLatency),
+                    static_cast<int64_t>((appConnectTime - connectTime) * 1000));
+            }
+        }
+
+        if (curl_easy_getinfo(connectionHandle, CURLINFO_PRETRANSFER_TIME, &preTransferTime) == CURLE_OK &&
+            curl_easy_getinfo(connectionHandle, CURLINFO_STARTTRANSFER_TIME, &startTransferTime) == CURLE_OK && startTransferTime > 0)
+        {
+            request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::TimeToFirstByteLatency), static_cast<int64_t>((startTransferTime - preTransferTime) * 1000));
+
+            if (curl_easy_getinfo(connectionHandle, CURLINFO_TOTAL_TIME, &totalTime) == CURLE_OK)
+            {
+                request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ResponseTransferLatency), static_cast<int64_t>((totalTime - startTransferTime) * 1000));
+            }
         }
 
         const char* ip = nullptr;
@@ -683,6 +863,18 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
         {
             request->SetResolvedRemoteHost(ip);
         }
+        if (!resolvedAddress.empty())
+        {
+            m_dnsResolver->ReleaseAddress(uri.GetAuthority(), resolvedAddress);
+            if (curlResponseCode == CURLE_COULDNT_CONNECT)
+            {
+                m_dnsResolver->RemoveAddress(uri.GetAuthority(), resolvedAddress);
+            }
+        }
+        if (resolve)
+        {
+            curl_slist_free_all(resolve);
+        }
         if (curlResponseCode != CURLE_OK)
         {
             m_curlHandleContainer.DestroyCurlHandle(connectionHandle);
@@ -695,6 +887,26 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
         response->GetResponseBody().flush();
         request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency), (DateTime::Now() - startTransmissionTime).count());
     }
+    else if (!requestProcessingEnabled)
+    {
+        // Not sent, and not to be retried either.
+        response->SetClientErrorType(CoreErrors::USER_CANCELLED);
+        response->SetClientErrorMessage("Request processing is disabled.");
+    }
+    else if (acquireFailure == CurlHandleAcquireFailure::CREATION_FAILED)
+    {
+        response->SetClientErrorType(CoreErrors::INTERNAL_FAILURE);
+        response->SetClientErrorMessage("Failed to create a curl handle.");
+    }
+    else
+    {
+        response->SetClientErrorType(CoreErrors::NETWORK_CONNECTION);
+        response->SetClientErrorMessage("Timed out waiting for a connection from the pool.");
+    }
+    if (endpointAcquired)
+    {
+        m_endpointLimiter.Release(endpoint);
+    }
 
     if (headers)
     {
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 
 using namespace Aws::Http;
 using namespace Aws::Http::Standard;
@@ -47,48 +48,53 @@ StandardHttpRequest::StandardHttpRequest(const URI& uri, HttpMethod method) :
 
 HeaderValueCollection StandardHttpRequest::GetHeaders() const
 {
-    HeaderValueCollection headers;
+    return headerMap.ToHeaderValueCollection();
+}
 
-    for (HeaderValueCollection::const_iterator iter = headerMap.begin(); iter != headerMap.end(); ++iter)
+void StandardHttpRequest::ForEachHeader(const HeaderVisitor& visitor) const
+{
+    for (const auto& header : headerMap)
     {
-        headers.emplace(HeaderValuePair(iter->first, iter->second));
+        visitor(header.GetName(), header.GetValue());
     }
-
-    return headers;
 }
 
 const Aws::String& StandardHttpRequest::GetHeaderValue(const char* headerName) const
 {
-    auto iter = headerMap.find(headerName);
-    assert (iter != headerMap.end());
-    return iter->second;
+    const Aws::String* value = headerMap.Find(headerName);
+    assert (value);
+    return value ? *value : m_emptyHeader;
 }
 
 void StandardHttpRequest::SetHeaderValue(const char* headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName)] = StringUtils::Trim(headerValue.c_str());
+    headerMap.Set(headerName, StringUtils::Trim(headerValue.c_str()));
 }
 
 void StandardHttpRequest::SetHeaderValue(const Aws::String& headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName.c_str())] = StringUtils::Trim(headerValue.c_str());
+    headerMap.Set(headerName.c_str(), StringUtils::Trim(headerValue.c_str()));
 }
 
 void StandardHttpRequest::DeleteHeader(const char* headerName)
 {
-    headerMap.erase(StringUtils::ToLower(headerName));
+    headerMap.Erase(headerName);
 }
 
 bool StandardHttpRequest::HasHeader(const char* headerName) const
 {
-    return headerMap.find(StringUtils::ToLower(headerName)) != headerMap.end();
+    return headerMap.Has(headerName);
 }
 
 int64_t StandardHttpRequest::GetSize() const
 {
     int64_t size = 0;
 
-    std::for_each(headerMap.cbegin(), headerMap.cend(), [&](const HeaderValueCollection::value_type& kvPair){ size += kvPair.first.length(); size += kvPair.second.length(); });
+    for (const auto& header : headerMap)
+    {
+        size += strlen(header.GetName());
+        size += header.GetValue().length();
+    }
 
     return size;
 }
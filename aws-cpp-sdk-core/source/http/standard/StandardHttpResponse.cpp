@@ -17,30 +17,29 @@ using namespace Aws::Utils;
 
 HeaderValueCollection StandardHttpResponse::GetHeaders() const
 {
-    HeaderValueCollection headerValueCollection;
+    return headerMap.ToHeaderValueCollection();
+}
 
-    for (Aws::Map<Aws::String, Aws::String>::const_iterator iter = headerMap.begin(); iter != headerMap.end(); ++iter)
+void StandardHttpResponse::ForEachHeader(const HeaderVisitor& visitor) const
+{
+    for (const auto& header : headerMap)
     {
-        headerValueCollection.emplace(HeaderValuePair(iter->first, iter->second));
+        visitor(header.GetName(), header.GetValue());
     }
-
-    return headerValueCollection;
 }
 
 bool StandardHttpResponse::HasHeader(const char* headerName) const
 {
-    return headerMap.find(StringUtils::ToLower(headerName)) != headerMap.end();
+    return headerMap.Has(headerName);
 }
 
 const Aws::String& StandardHttpResponse::GetHeader(const Aws::String& headerName) const
 {
-    Aws::Map<Aws::String, Aws::String>::const_iterator foundValue = headerMap.find(StringUtils::ToLower(headerName.c_str()));
-    return foundValue->second;
+    const Aws::String* value = headerMap.Find(headerName.c_str());
+    return value ? *value : m_emptyHeader;
 }
 
 void StandardHttpResponse::AddHeader(const Aws::String& headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName.c_str())] = headerValue;
+    headerMap.Set(headerName.c_str(), headerValue);
 }
-
-
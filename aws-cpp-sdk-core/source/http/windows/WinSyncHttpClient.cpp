@@ -66,16 +66,15 @@ void* WinSyncHttpClient::AllocateWindowsHttpRequest(const std::shared_ptr<HttpRe
 
 void WinSyncHttpClient::AddHeadersToRequest(const std::shared_ptr<HttpRequest>& request, void* hHttpRequest) const
 {
-    if(request->GetHeaders().size() > 0)
+    Aws::String headerString;
+    request->ForEachHeader([&](const char* name, const Aws::String& value)
     {
-        Aws::StringStream ss;
-        AWS_LOGSTREAM_DEBUG(GetLogTag(), "with headers:");
-        for (auto& header : request->GetHeaders())
-        {
-            ss << header.first << ": " << header.second << "\r\n";
-        }
+        headerString.append(name).append(": ").append(value).append("\r\n");
+    });
 
-        Aws::String headerString = ss.str();
+    if(!headerString.empty())
+    {
+        AWS_LOGSTREAM_DEBUG(GetLogTag(), "with headers:");
         AWS_LOGSTREAM_DEBUG(GetLogTag(), headerString);
 
         DoAddHeaders(hHttpRequest, headerString);
@@ -208,9 +207,30 @@ bool WinSyncHttpClient::BuildSuccessResponse(const std::shared_ptr<HttpRequest>&
 
         bool success = ContinueRequest(*request);
 
+        // Only successful bodies go to the sink, error bodies are needed in the response stream by the error marshallers.
+        const int responseCode = static_cast<int>(response->GetResponseCode());
+        ResponseBodySink* bodySink = responseCode >= 200 && responseCode < 300 ? request->GetResponseBodySink().get() : nullptr;
+        if (bodySink)
+        {
+            bodySink->Reset();
+        }
+
         while (DoReadData(hHttpRequest, body, bodySize, read) && read > 0 && success)
         {
-            response->GetResponseBody().write(body, read);
+            if (bodySink)
+            {
+                if (!bodySink->Write(body, static_cast<size_t>(read)))
+                {
+                    response->SetClientErrorType(CoreErrors::USER_CANCELLED);
+                    response->SetClientErrorMessage("Response body sink refused the response body");
+                    AWS_LOGSTREAM_ERROR(GetLogTag(), "Response body sink refused " << read << " bytes, aborting the transfer.");
+                    return false;
+                }
+            }
+            else
+            {
+                response->GetResponseBody().write(body, read);
+            }
             if (read > 0)
             {
                 numBytesResponseReceived += read;
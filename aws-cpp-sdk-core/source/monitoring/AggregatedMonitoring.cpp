@@ -0,0 +1,311 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/monitoring/AggregatedMonitoring.h>
+#include <aws/core/monitoring/Histogram.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <chrono>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Threading;
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        static const char AGGREGATED_MONITORING_ALLOC_TAG[] = "AggregatedMonitoringAllocTag";
+        static const int CLIENT_ID_LENGTH_LIMIT = 256;
+
+        const int AggregatedMonitoring::AGGREGATED_MONITORING_VERSION = 1;
+        const int64_t AggregatedMonitoring::DEFAULT_FLUSH_INTERVAL_MS = 60000;
+
+        /**
+         * Everything aggregated for a single service and operation, shared by all threads calling it.
+         */
+        struct AggregatedOperationMetrics
+        {
+            AggregatedOperationMetrics(const Aws::String& service, const Aws::String& api) :
+                serviceName(service), requestName(api), retryCount(0), failedApiCallCount(0)
+            {
+            }
+
+            Aws::String serviceName;
+            Aws::String requestName;
+            Histogram apiCallLatency;
+            Histogram attemptLatency;
+            Histogram dnsLatency;
+            Histogram connectLatency;
+            Histogram sslLatency;
+            Histogram attemptsPerApiCall;
+            std::atomic<uint64_t> retryCount;
+            std::atomic<uint64_t> failedApiCallCount;
+        };
+
+        struct AggregatedContext
+        {
+            AggregatedOperationMetrics* metrics = nullptr;
+            std::chrono::steady_clock::time_point apiCallStartTime;
+            std::chrono::steady_clock::time_point attemptStartTime;
+            int retryCount = 0;
+            bool lastAttemptSucceeded = false;
+        };
+
+        static inline int64_t MillisSince(const std::chrono::steady_clock::time_point& start)
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        static inline void RecordHttpClientMetric(Histogram& histogram, const HttpClientMetricsCollection& httpMetrics, const Aws::String& name)
+        {
+            auto iter = httpMetrics.find(name);
+            if (iter != httpMetrics.end())
+            {
+                histogram.Record(iter->second);
+            }
+        }
+
+        static inline void ExportHistogramToJson(Json::JsonValue& json, const Aws::String& name, const HistogramSnapshot& snapshot)
+        {
+            if (snapshot.GetCount() == 0)
+            {
+                return;
+            }
+
+            Json::JsonValue summary;
+            summary.WithInt64("Count", static_cast<int64_t>(snapshot.GetCount()))
+                .WithInt64("Sum", snapshot.GetSum())
+                .WithInt64("Min", snapshot.GetMin())
+                .WithInt64("Max", snapshot.GetMax())
+                .WithInt64("P50", snapshot.GetValueAtPercentile(50.0))
+                .WithInt64("P90", snapshot.GetValueAtPercentile(90.0))
+                .WithInt64("P99", snapshot.GetValueAtPercentile(99.0))
+                .WithInt64("P999", snapshot.GetValueAtPercentile(99.9));
+            json.WithObject(name, std::move(summary));
+        }
+
+        AggregatedMonitoring::AggregatedMonitoring(const Aws::String& clientId, const Aws::String& host, unsigned short port, int64_t flushIntervalMs) :
+            m_udp(host.c_str(), port),
+            m_clientId(clientId.substr(0, CLIENT_ID_LENGTH_LIMIT)),
+            m_flushIntervalMs(flushIntervalMs),
+            m_lastFlushMs(DateTime::Now().Millis()),
+            m_stopFlushing(false)
+        {
+            if (m_flushIntervalMs > 0)
+            {
+                m_flushThread = std::thread(&AggregatedMonitoring::FlushLoop, this);
+            }
+        }
+
+        AggregatedMonitoring::~AggregatedMonitoring()
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_flushMutex);
+                m_stopFlushing = true;
+            }
+            m_flushSignal.notify_one();
+            if (m_flushThread.joinable())
+            {
+                m_flushThread.join();
+            }
+            Flush();
+        }
+
+        void AggregatedMonitoring::FlushLoop()
+        {
+            std::unique_lock<std::mutex> locker(m_flushMutex);
+            while (!m_stopFlushing)
+            {
+                m_flushSignal.wait_for(locker, std::chrono::milliseconds(m_flushIntervalMs), [this]() { return m_stopFlushing; });
+                if (m_stopFlushing)
+                {
+                    break;
+                }
+                locker.unlock();
+                Flush();
+                locker.lock();
+            }
+        }
+
+        AggregatedOperationMetrics* AggregatedMonitoring::GetOperationMetrics(const Aws::String& serviceName, const Aws::String& requestName) const
+        {
+            Aws::String key;
+            key.reserve(serviceName.size() + requestName.size() + 1);
+            key.append(serviceName).append(1, '.').append(requestName);
+
+            ReaderLockGuard guard(m_metricsLock);
+            auto iter = m_metrics.find(key);
+            if (iter != m_metrics.end())
+            {
+                return iter->second.get();
+            }
+
+            guard.UpgradeToWriterLock();
+            auto& metrics = m_metrics[key];
+            if (!metrics)
+            {
+                metrics = Aws::MakeUnique<AggregatedOperationMetrics>(AGGREGATED_MONITORING_ALLOC_TAG, serviceName, requestName);
+            }
+            return metrics.get();
+        }
+
+        void* AggregatedMonitoring::OnRequestStarted(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request) const
+        {
+            AWS_UNREFERENCED_PARAM(request);
+
+            auto context = Aws::New<AggregatedContext>(AGGREGATED_MONITORING_ALLOC_TAG);
+            context->metrics = GetOperationMetrics(serviceName, requestName);
+            context->apiCallStartTime = std::chrono::steady_clock::now();
+            context->attemptStartTime = context->apiCallStartTime;
+            return context;
+        }
+
+        void AggregatedMonitoring::OnRequestSucceeded(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
+            const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(serviceName);
+            AWS_UNREFERENCED_PARAM(requestName);
+            AWS_UNREFERENCED_PARAM(request);
+            AWS_UNREFERENCED_PARAM(outcome);
+            RecordAttempt(metricsFromCore, true, context);
+        }
+
+        void AggregatedMonitoring::OnRequestFailed(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
+            const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(serviceName);
+            AWS_UNREFERENCED_PARAM(requestName);
+            AWS_UNREFERENCED_PARAM(request);
+            AWS_UNREFERENCED_PARAM(outcome);
+            RecordAttempt(metricsFromCore, false, context);
+        }
+
+        void AggregatedMonitoring::RecordAttempt(const CoreMetricsCollection& metricsFromCore, bool succeeded, void* context) const
+        {
+            static const Aws::String dnsLatencyName = GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency);
+            static const Aws::String connectLatencyName = GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency);
+            static const Aws::String sslLatencyName = GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency);
+
+            AggregatedContext* aggregatedContext = static_cast<AggregatedContext*>(context);
+            AggregatedOperationMetrics* metrics = aggregatedContext->metrics;
+            aggregatedContext->lastAttemptSucceeded = succeeded;
+
+            metrics->attemptLatency.Record(MillisSince(aggregatedContext->attemptStartTime));
+            RecordHttpClientMetric(metrics->dnsLatency, metricsFromCore.httpClientMetrics, dnsLatencyName);
+            RecordHttpClientMetric(metrics->connectLatency, metricsFromCore.httpClientMetrics, connectLatencyName);
+            RecordHttpClientMetric(metrics->sslLatency, metricsFromCore.httpClientMetrics, sslLatencyName);
+        }
+
+        void AggregatedMonitoring::OnRequestRetry(const Aws::String& serviceName, const Aws::String& requestName,
+            const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(serviceName);
+            AWS_UNREFERENCED_PARAM(requestName);
+            AWS_UNREFERENCED_PARAM(request);
+
+            AggregatedContext* aggregatedContext = static_cast<AggregatedContext*>(context);
+            aggregatedContext->retryCount++;
+            aggregatedContext->attemptStartTime = std::chrono::steady_clock::now();
+            aggregatedContext->metrics->retryCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void AggregatedMonitoring::OnFinish(const Aws::String& serviceName, const Aws::String& requestName,
+            const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(serviceName);
+            AWS_UNREFERENCED_PARAM(requestName);
+            AWS_UNREFERENCED_PARAM(request);
+
+            AggregatedContext* aggregatedContext = static_cast<AggregatedContext*>(context);
+            AggregatedOperationMetrics* metrics = aggregatedContext->metrics;
+            metrics->apiCallLatency.Record(MillisSince(aggregatedContext->apiCallStartTime));
+            metrics->attemptsPerApiCall.Record(aggregatedContext->retryCount + 1);
+            if (!aggregatedContext->lastAttemptSucceeded)
+            {
+                metrics->failedApiCallCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            Aws::Delete(aggregatedContext);
+        }
+
+        Aws::Vector<Aws::String> AggregatedMonitoring::CollectSummaries() const
+        {
+            int64_t now = DateTime::Now().Millis();
+            int64_t intervalStart = m_lastFlushMs.exchange(now);
+
+            Aws::Vector<Aws::String> summaries;
+            ReaderLockGuard guard(m_metricsLock);
+            summaries.reserve(m_metrics.size());
+            for (const auto& entry : m_metrics)
+            {
+                AggregatedOperationMetrics& metrics = *entry.second;
+                HistogramSnapshot apiCallLatency = metrics.apiCallLatency.Drain();
+                HistogramSnapshot attemptLatency = metrics.attemptLatency.Drain();
+                if (apiCallLatency.GetCount() == 0 && attemptLatency.GetCount() == 0)
+                {
+                    continue;
+                }
+
+                Json::JsonValue json;
+                json.WithString("Type", "ApiCallSummary")
+                    .WithString("Service", metrics.serviceName)
+                    .WithString("Api", metrics.requestName)
+                    .WithString("ClientId", m_clientId)
+                    .WithInt64("Timestamp", intervalStart)
+                    .WithInteger("Version", AGGREGATED_MONITORING_VERSION)
+                    .WithInt64("Interval", now - intervalStart)
+                    .WithInt64("ApiCallCount", static_cast<int64_t>(apiCallLatency.GetCount()))
+                    .WithInt64("FailedApiCallCount", static_cast<int64_t>(metrics.failedApiCallCount.exchange(0, std::memory_order_relaxed)))
+                    .WithInt64("RetryCount", static_cast<int64_t>(metrics.retryCount.exchange(0, std::memory_order_relaxed)));
+                ExportHistogramToJson(json, "Latency", apiCallLatency);
+                ExportHistogramToJson(json, "AttemptLatency", attemptLatency);
+                ExportHistogramToJson(json, "AttemptCount", metrics.attemptsPerApiCall.Drain());
+                ExportHistogramToJson(json, "DnsLatency", metrics.dnsLatency.Drain());
+                ExportHistogramToJson(json, "ConnectLatency", metrics.connectLatency.Drain());
+                ExportHistogramToJson(json, "SslLatency", metrics.sslLatency.Drain());
+                summaries.emplace_back(json.View().WriteCompact());
+            }
+            return summaries;
+        }
+
+        void AggregatedMonitoring::Flush() const
+        {
+            Aws::Vector<Aws::String> summaries = CollectSummaries();
+            if (summaries.empty())
+            {
+                return;
+            }
+
+            Aws::Vector<const uint8_t*> datagrams;
+            Aws::Vector<size_t> lengths;
+            datagrams.reserve(summaries.size());
+            lengths.reserve(summaries.size());
+            for (const auto& summary : summaries)
+            {
+                if (summary.size() > Aws::Net::UDP_BUFFER_SIZE)
+                {
+                    AWS_LOGSTREAM_WARN(AGGREGATED_MONITORING_ALLOC_TAG, "Dropping summary of " << summary.size() << " bytes, larger than the monitoring packet size.");
+                    continue;
+                }
+                datagrams.push_back(reinterpret_cast<const uint8_t*>(summary.c_str()));
+                lengths.push_back(summary.size());
+            }
+
+            int sent = m_udp.SendDataBatch(datagrams.data(), lengths.data(), datagrams.size());
+            AWS_LOGSTREAM_DEBUG(AGGREGATED_MONITORING_ALLOC_TAG, "Sent " << sent << " of " << datagrams.size() << " api call summaries.");
+        }
+
+        AggregatedMonitoringFactory::AggregatedMonitoringFactory(const Aws::String& clientId, const Aws::String& host, unsigned short port, int64_t flushIntervalMs) :
+            m_clientId(clientId), m_host(host), m_port(port), m_flushIntervalMs(flushIntervalMs)
+        {
+        }
+
+        Aws::UniquePtr<MonitoringInterface> AggregatedMonitoringFactory::CreateMonitoringInstance() const
+        {
+            return Aws::MakeUnique<AggregatedMonitoring>(AGGREGATED_MONITORING_ALLOC_TAG, m_clientId, m_host, m_port, m_flushIntervalMs);
+        }
+    } // namespace Monitoring
+} // namespace Aws
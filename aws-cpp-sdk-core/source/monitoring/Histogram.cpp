@@ -0,0 +1,207 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/monitoring/Histogram.h>
+#include <cmath>
+#include <limits>
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        const int Histogram::SUB_BUCKET_BITS;
+        const int64_t Histogram::SUB_BUCKET_COUNT;
+        const int Histogram::HIGHEST_TRACKABLE_BITS;
+        const size_t Histogram::BUCKET_COUNT;
+
+        static inline int MostSignificantBit(uint64_t value)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63 - __builtin_clzll(value);
+#else
+            int msb = 0;
+            while (value >>= 1)
+            {
+                msb++;
+            }
+            return msb;
+#endif
+        }
+
+        static inline void UpdateMin(std::atomic<int64_t>& target, int64_t value)
+        {
+            int64_t current = target.load(std::memory_order_relaxed);
+            while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        static inline void UpdateMax(std::atomic<int64_t>& target, int64_t value)
+        {
+            int64_t current = target.load(std::memory_order_relaxed);
+            while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        HistogramSnapshot::HistogramSnapshot() :
+            m_buckets(Histogram::BUCKET_COUNT, 0),
+            m_count(0),
+            m_sum(0),
+            m_min((std::numeric_limits<int64_t>::max)()),
+            m_max(0)
+        {
+        }
+
+        double HistogramSnapshot::GetMean() const
+        {
+            return m_count ? static_cast<double>(m_sum) / static_cast<double>(m_count) : 0.0;
+        }
+
+        int64_t HistogramSnapshot::GetValueAtPercentile(double percentile) const
+        {
+            if (m_count == 0)
+            {
+                return 0;
+            }
+
+            percentile = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+            uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(m_count)));
+            rank = rank == 0 ? 1 : (rank > m_count ? m_count : rank);
+
+            uint64_t seen = 0;
+            for (size_t index = 0; index < m_buckets.size(); ++index)
+            {
+                seen += m_buckets[index];
+                if (seen >= rank)
+                {
+                    int64_t upperBound = Histogram::GetBucketUpperBound(index);
+                    return upperBound < m_max ? upperBound : m_max;
+                }
+            }
+            return m_max;
+        }
+
+        uint64_t HistogramSnapshot::GetCountAtOrBelow(int64_t value) const
+        {
+            if (value < 0)
+            {
+                return 0;
+            }
+
+            uint64_t count = 0;
+            size_t lastIndex = Histogram::GetBucketIndex(value);
+            for (size_t index = 0; index <= lastIndex; ++index)
+            {
+                count += m_buckets[index];
+            }
+            return count;
+        }
+
+        void HistogramSnapshot::Merge(const HistogramSnapshot& other)
+        {
+            for (size_t index = 0; index < m_buckets.size(); ++index)
+            {
+                m_buckets[index] += other.m_buckets[index];
+            }
+            m_count += other.m_count;
+            m_sum += other.m_sum;
+            m_min = other.m_min < m_min ? other.m_min : m_min;
+            m_max = other.m_max > m_max ? other.m_max : m_max;
+        }
+
+        Histogram::Histogram() :
+            m_sum(0),
+            m_min((std::numeric_limits<int64_t>::max)()),
+            m_max(0)
+        {
+            for (auto& bucket : m_buckets)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        size_t Histogram::GetBucketIndex(int64_t value)
+        {
+            if (value < 0)
+            {
+                value = 0;
+            }
+            else if (value > GetHighestTrackableValue())
+            {
+                value = GetHighestTrackableValue();
+            }
+
+            if (value < 2 * SUB_BUCKET_COUNT)
+            {
+                return static_cast<size_t>(value);
+            }
+
+            int shift = MostSignificantBit(static_cast<uint64_t>(value)) - SUB_BUCKET_BITS;
+            return static_cast<size_t>(shift * SUB_BUCKET_COUNT + (value >> shift));
+        }
+
+        int64_t Histogram::GetBucketLowerBound(size_t index)
+        {
+            if (index < static_cast<size_t>(2 * SUB_BUCKET_COUNT))
+            {
+                return static_cast<int64_t>(index);
+            }
+
+            int64_t shift = static_cast<int64_t>(index) / SUB_BUCKET_COUNT - 1;
+            int64_t subBucket = static_cast<int64_t>(index) - shift * SUB_BUCKET_COUNT;
+            return subBucket << shift;
+        }
+
+        int64_t Histogram::GetBucketUpperBound(size_t index)
+        {
+            if (index < static_cast<size_t>(2 * SUB_BUCKET_COUNT))
+            {
+                return static_cast<int64_t>(index);
+            }
+
+            int64_t shift = static_cast<int64_t>(index) / SUB_BUCKET_COUNT - 1;
+            int64_t subBucket = static_cast<int64_t>(index) - shift * SUB_BUCKET_COUNT;
+            return ((subBucket + 1) << shift) - 1;
+        }
+
+        void Histogram::Record(int64_t value)
+        {
+            value = value < 0 ? 0 : value;
+            m_buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(value, std::memory_order_relaxed);
+            UpdateMin(m_min, value);
+            UpdateMax(m_max, value);
+        }
+
+        HistogramSnapshot Histogram::GetSnapshot() const
+        {
+            HistogramSnapshot snapshot;
+            for (size_t index = 0; index < BUCKET_COUNT; ++index)
+            {
+                snapshot.m_buckets[index] = m_buckets[index].load(std::memory_order_relaxed);
+                snapshot.m_count += snapshot.m_buckets[index];
+            }
+            snapshot.m_sum = m_sum.load(std::memory_order_relaxed);
+            snapshot.m_min = m_min.load(std::memory_order_relaxed);
+            snapshot.m_max = m_max.load(std::memory_order_relaxed);
+            return snapshot;
+        }
+
+        HistogramSnapshot Histogram::Drain()
+        {
+            HistogramSnapshot snapshot;
+            for (size_t index = 0; index < BUCKET_COUNT; ++index)
+            {
+                snapshot.m_buckets[index] = m_buckets[index].exchange(0, std::memory_order_relaxed);
+                snapshot.m_count += snapshot.m_buckets[index];
+            }
+            snapshot.m_sum = m_sum.exchange(0, std::memory_order_relaxed);
+            snapshot.m_min = m_min.exchange((std::numeric_limits<int64_t>::max)(), std::memory_order_relaxed);
+            snapshot.m_max = m_max.exchange(0, std::memory_order_relaxed);
+            return snapshot;
+        }
+    } // namespace Monitoring
+} // namespace Aws
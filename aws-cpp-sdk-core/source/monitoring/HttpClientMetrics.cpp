@@ -18,6 +18,9 @@ namespace Aws
         static const char HTTP_CLIENT_METRICS_DNS_LATENCY[] = "DnsLatency";
         static const char HTTP_CLIENT_METRICS_TCP_LATENCY[] = "TcpLatency";
         static const char HTTP_CLIENT_METRICS_SSL_LATENCY[] = "SslLatency";
+        static const char HTTP_CLIENT_METRICS_TIME_TO_FIRST_BYTE_LATENCY[] = "TimeToFirstByteLatency";
+        static const char HTTP_CLIENT_METRICS_RESPONSE_TRANSFER_LATENCY[] = "ResponseTransferLatency";
+        static const char HTTP_CLIENT_METRICS_TLS_HANDSHAKE_LATENCY[] = "TlsHandshakeLatency";
         static const char HTTP_CLIENT_METRICS_UNKNOWN[] = "Unknown";
 
         using namespace Aws::Utils;
@@ -32,7 +35,10 @@ namespace Aws
                 std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_REQUEST_LATENCY), HttpClientMetricsType::RequestLatency),
                 std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_DNS_LATENCY), HttpClientMetricsType::DnsLatency),
                 std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_TCP_LATENCY), HttpClientMetricsType::TcpLatency),
-                std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_SSL_LATENCY), HttpClientMetricsType::SslLatency)
+                std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_SSL_LATENCY), HttpClientMetricsType::SslLatency),
+                std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_TIME_TO_FIRST_BYTE_LATENCY), HttpClientMetricsType::TimeToFirstByteLatency),
+                std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_RESPONSE_TRANSFER_LATENCY), HttpClientMetricsType::ResponseTransferLatency),
+                std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_TLS_HANDSHAKE_LATENCY), HttpClientMetricsType::TlsHandshakeLatency)
             };
 
             int nameHash = HashingUtils::HashString(name.c_str());
@@ -56,6 +62,9 @@ namespace Aws
                 std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::DnsLatency), HTTP_CLIENT_METRICS_DNS_LATENCY),
                 std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::TcpLatency), HTTP_CLIENT_METRICS_TCP_LATENCY),
                 std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::SslLatency), HTTP_CLIENT_METRICS_SSL_LATENCY),
+                std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::TimeToFirstByteLatency), HTTP_CLIENT_METRICS_TIME_TO_FIRST_BYTE_LATENCY),
+                std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::ResponseTransferLatency), HTTP_CLIENT_METRICS_RESPONSE_TRANSFER_LATENCY),
+                std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::TlsHandshakeLatency), HTTP_CLIENT_METRICS_TLS_HANDSHAKE_LATENCY),
                 std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::Unknown), HTTP_CLIENT_METRICS_UNKNOWN)
             };
 
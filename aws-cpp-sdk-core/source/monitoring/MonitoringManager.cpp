@@ -87,6 +87,19 @@ namespace Aws
             }
         }
 
+        void OnCircuitStateChanged(const Aws::String& serviceName, const Aws::String& circuitName, Aws::Client::CircuitState state)
+        {
+            // Circuit breakers can be used without the monitoring being initialized.
+            if (!s_monitors)
+            {
+                return;
+            }
+            for (const auto& interface: *s_monitors)
+            {
+                interface->OnCircuitStateChanged(serviceName, circuitName, state);
+            }
+        }
+
         void InitMonitoring(const std::vector<MonitoringFactoryCreateFunction>& monitoringFactoryCreateFunctions)
         {
             if (s_monitors)
@@ -0,0 +1,470 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/monitoring/OpenMetricsMonitoring.h>
+#include <aws/core/client/RetryStrategy.h>
+#include <aws/core/net/SimpleHttpListener.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+
+using namespace Aws::Utils::Threading;
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        static const char OPEN_METRICS_ALLOC_TAG[] = "OpenMetricsMonitoringAllocTag";
+
+        const char OpenMetricsRegistry::CONTENT_TYPE[] = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+        // Histogram bucket upper bounds, in milliseconds, and the matching "le" label values in seconds.
+        static const int64_t LATENCY_BOUNDS_MS[] = { 1, 2, 5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000 };
+        static const char* const LATENCY_BOUNDS_LABELS[] = { "0.001", "0.002", "0.005", "0.01", "0.025", "0.05", "0.1", "0.25", "0.5", "1.0", "2.5", "5.0", "10.0", "30.0" };
+        static const size_t LATENCY_BOUNDS_COUNT = sizeof(LATENCY_BOUNDS_MS) / sizeof(LATENCY_BOUNDS_MS[0]);
+
+        /**
+         * Fixed bucket histogram matching the OpenMetrics histogram layout, the last bucket counts samples above every bound.
+         */
+        struct OpenMetricsHistogram
+        {
+            OpenMetricsHistogram() : sumMs(0)
+            {
+                for (auto& bucket : buckets)
+                {
+                    bucket.store(0, std::memory_order_relaxed);
+                }
+            }
+
+            void Record(int64_t valueMs)
+            {
+                valueMs = (std::max)(valueMs, static_cast<int64_t>(0));
+                size_t index = 0;
+                while (index < LATENCY_BOUNDS_COUNT && valueMs > LATENCY_BOUNDS_MS[index])
+                {
+                    index++;
+                }
+                buckets[index].fetch_add(1, std::memory_order_relaxed);
+                sumMs.fetch_add(valueMs, std::memory_order_relaxed);
+            }
+
+            std::atomic<uint64_t> buckets[LATENCY_BOUNDS_COUNT + 1];
+            std::atomic<int64_t> sumMs;
+        };
+
+        /**
+         * Everything recorded for a single service and operation, shared by all threads calling it.
+         */
+        struct OpenMetricsOperation
+        {
+            OpenMetricsOperation(const Aws::String& service, const Aws::String& api) :
+                serviceName(service), requestName(api), apiCalls(0), failedApiCalls(0), attempts(0), throttledAttempts(0), retries(0), inFlight(0)
+            {
+            }
+
+            Aws::String serviceName;
+            Aws::String requestName;
+            std::atomic<uint64_t> apiCalls;
+            std::atomic<uint64_t> failedApiCalls;
+            std::atomic<uint64_t> attempts;
+            std::atomic<uint64_t> throttledAttempts;
+            std::atomic<uint64_t> retries;
+            std::atomic<int64_t> inFlight;
+            OpenMetricsHistogram apiCallLatency;
+            OpenMetricsHistogram connectionAcquireLatency;
+        };
+
+        struct OpenMetricsContext
+        {
+            OpenMetricsOperation* operation = nullptr;
+            std::chrono::steady_clock::time_point apiCallStartTime;
+            bool lastAttemptSucceeded = false;
+        };
+
+        /**
+         * Escapes label values and help text the way the exposition format requires.
+         */
+        static Aws::String EscapeString(const Aws::String& value)
+        {
+            Aws::String escaped;
+            escaped.reserve(value.size());
+            for (char c : value)
+            {
+                switch (c)
+                {
+                    case '\\': escaped.append("\\\\"); break;
+                    case '"': escaped.append("\\\""); break;
+                    case '\n': escaped.append("\\n"); break;
+                    default: escaped.push_back(c); break;
+                }
+            }
+            return escaped;
+        }
+
+        static Aws::String FormatLabels(const Aws::Map<Aws::String, Aws::String>& labels)
+        {
+            Aws::String formatted;
+            for (const auto& label : labels)
+            {
+                formatted.append(formatted.empty() ? "" : ",").append(label.first).append("=\"").append(EscapeString(label.second)).append("\"");
+            }
+            return formatted;
+        }
+
+        static void WriteFamilyHeader(Aws::OStringStream& out, const char* name, const char* type, const Aws::String& help, const char* unit = nullptr)
+        {
+            out << "# TYPE " << name << " " << type << "\n";
+            if (unit)
+            {
+                out << "# UNIT " << name << " " << unit << "\n";
+            }
+            out << "# HELP " << name << " " << EscapeString(help) << "\n";
+        }
+
+        static void WriteCounterFamily(Aws::OStringStream& out, const Aws::Vector<std::pair<Aws::String, const OpenMetricsOperation*>>& operations,
+            const char* name, const char* help, std::atomic<uint64_t> OpenMetricsOperation::* counter)
+        {
+            WriteFamilyHeader(out, name, "counter", help);
+            for (const auto& operation : operations)
+            {
+                out << name << "_total{" << operation.first << "} " << (operation.second->*counter).load(std::memory_order_relaxed) << "\n";
+            }
+        }
+
+        static void WriteHistogramFamily(Aws::OStringStream& out, const Aws::Vector<std::pair<Aws::String, const OpenMetricsOperation*>>& operations,
+            const char* name, const char* help, OpenMetricsHistogram OpenMetricsOperation::* histogram)
+        {
+            WriteFamilyHeader(out, name, "histogram", help, "seconds");
+            for (const auto& operation : operations)
+            {
+                const OpenMetricsHistogram& samples = operation.second->*histogram;
+                // Read the sum first, so that it never covers samples missing from the buckets read after it.
+                int64_t sumMs = samples.sumMs.load(std::memory_order_relaxed);
+                uint64_t cumulative = 0;
+                for (size_t i = 0; i < LATENCY_BOUNDS_COUNT; ++i)
+                {
+                    cumulative += samples.buckets[i].load(std::memory_order_relaxed);
+                    out << name << "_bucket{" << operation.first << ",le=\"" << LATENCY_BOUNDS_LABELS[i] << "\"} " << cumulative << "\n";
+                }
+                cumulative += samples.buckets[LATENCY_BOUNDS_COUNT].load(std::memory_order_relaxed);
+                out << name << "_bucket{" << operation.first << ",le=\"+Inf\"} " << cumulative << "\n";
+                out << name << "_count{" << operation.first << "} " << cumulative << "\n";
+                out << name << "_sum{" << operation.first << "} " << sumMs / 1000 << "." << std::setw(3) << std::setfill('0') << sumMs % 1000 << "\n";
+            }
+        }
+
+        static void WriteGaugeValue(Aws::OStringStream& out, double value)
+        {
+            if (value == std::floor(value) && std::fabs(value) < 1e15)
+            {
+                out << static_cast<int64_t>(value);
+                return;
+            }
+            std::streamsize precision = out.precision(17);
+            out << value;
+            out.precision(precision);
+        }
+
+        static inline bool IsThrottlingError(const Aws::Client::HttpResponseOutcome& outcome)
+        {
+            if (outcome.IsSuccess())
+            {
+                return false;
+            }
+            const auto& error = outcome.GetError();
+            return error.GetErrorType() == Aws::Client::CoreErrors::THROTTLING ||
+                error.GetErrorType() == Aws::Client::CoreErrors::SLOW_DOWN ||
+                error.GetResponseCode() == Aws::Http::HttpResponseCode::TOO_MANY_REQUESTS;
+        }
+
+        OpenMetricsRegistry::OpenMetricsRegistry()
+        {
+        }
+
+        OpenMetricsRegistry::~OpenMetricsRegistry()
+        {
+            StopListener();
+        }
+
+        void OpenMetricsRegistry::AddGauge(const Aws::String& name, const Aws::String& help, const Aws::Map<Aws::String, Aws::String>& labels,
+            const std::function<double()>& valueProvider)
+        {
+            std::lock_guard<std::mutex> locker(m_gaugesLock);
+            GaugeFamily& family = m_gauges[name];
+            if (family.help.empty())
+            {
+                family.help = help;
+            }
+            Gauge gauge;
+            gauge.labels = FormatLabels(labels);
+            gauge.valueProvider = valueProvider;
+            family.gauges.push_back(std::move(gauge));
+        }
+
+        void OpenMetricsRegistry::AddRetryQuotaGauge(const Aws::String& clientName, const std::shared_ptr<Aws::Client::RetryQuotaContainer>& retryQuotaContainer)
+        {
+            std::weak_ptr<Aws::Client::RetryQuotaContainer> weakContainer = retryQuotaContainer;
+            Aws::Map<Aws::String, Aws::String> labels;
+            labels["client"] = clientName;
+            AddGauge("aws_sdk_retry_quota_available", "Retry quota left to the client.", labels, [weakContainer]() {
+                auto container = weakContainer.lock();
+                return container ? static_cast<double>(container->GetRetryQuota()) : std::nan("");
+            });
+        }
+
+        void OpenMetricsRegistry::AddExecutorQueueDepthGauge(const Aws::String& executorName, const std::shared_ptr<PooledThreadExecutor>& executor)
+        {
+            std::weak_ptr<PooledThreadExecutor> weakExecutor = executor;
+            Aws::Map<Aws::String, Aws::String> labels;
+            labels["executor"] = executorName;
+            AddGauge("aws_sdk_executor_queue_depth", "Tasks waiting for a thread of the executor.", labels, [weakExecutor]() {
+                auto pool = weakExecutor.lock();
+                return pool ? static_cast<double>(pool->GetQueueDepth()) : std::nan("");
+            });
+        }
+
+        void OpenMetricsRegistry::SetCircuitState(const Aws::String& serviceName, const Aws::String& circuitName, Aws::Client::CircuitState state)
+        {
+            Aws::Map<Aws::String, Aws::String> labels;
+            labels["service"] = serviceName;
+            labels["circuit"] = circuitName;
+            Aws::String formattedLabels = FormatLabels(labels);
+
+            std::lock_guard<std::mutex> locker(m_gaugesLock);
+            auto& value = m_circuitStates[formattedLabels];
+            if (!value)
+            {
+                value = Aws::MakeShared<std::atomic<int>>(OPEN_METRICS_ALLOC_TAG, 0);
+                GaugeFamily& family = m_gauges["aws_sdk_circuit_state"];
+                if (family.help.empty())
+                {
+                    family.help = "State of the circuit breaker circuit, 0 closed, 1 open, 2 half open.";
+                }
+                Gauge gauge;
+                gauge.labels = std::move(formattedLabels);
+                std::shared_ptr<std::atomic<int>> circuitState = value;
+                gauge.valueProvider = [circuitState]() { return static_cast<double>(circuitState->load(std::memory_order_relaxed)); };
+                family.gauges.push_back(std::move(gauge));
+            }
+            value->store(static_cast<int>(state), std::memory_order_relaxed);
+        }
+
+        OpenMetricsOperation* OpenMetricsRegistry::GetOperation(const Aws::String& serviceName, const Aws::String& requestName)
+        {
+            const auto key = std::make_pair(serviceName, requestName);
+
+            ReaderLockGuard guard(m_operationsLock);
+            auto iter = m_operations.find(key);
+            if (iter != m_operations.end())
+            {
+                return iter->second.get();
+            }
+
+            guard.UpgradeToWriterLock();
+            auto& operation = m_operations[key];
+            if (!operation)
+            {
+                operation = Aws::MakeUnique<OpenMetricsOperation>(OPEN_METRICS_ALLOC_TAG, serviceName, requestName);
+            }
+            return operation.get();
+        }
+
+        Aws::String OpenMetricsRegistry::Render() const
+        {
+            Aws::OStringStream out;
+
+            {
+                ReaderLockGuard guard(m_operationsLock);
+                Aws::Vector<std::pair<Aws::String, const OpenMetricsOperation*>> operations;
+                operations.reserve(m_operations.size());
+                for (const auto& entry : m_operations)
+                {
+                    Aws::Map<Aws::String, Aws::String> labels;
+                    labels["service"] = entry.second->serviceName;
+                    labels["operation"] = entry.second->requestName;
+                    operations.emplace_back(FormatLabels(labels), entry.second.get());
+                }
+
+                WriteCounterFamily(out, operations, "aws_sdk_api_calls", "Completed api calls.", &OpenMetricsOperation::apiCalls);
+                WriteCounterFamily(out, operations, "aws_sdk_api_call_errors", "Api calls whose last attempt failed.", &OpenMetricsOperation::failedApiCalls);
+                WriteCounterFamily(out, operations, "aws_sdk_attempts", "Http attempts, including retries.", &OpenMetricsOperation::attempts);
+                WriteCounterFamily(out, operations, "aws_sdk_throttled_attempts", "Attempts rejected by the service with a throttling error.", &OpenMetricsOperation::throttledAttempts);
+                WriteCounterFamily(out, operations, "aws_sdk_retries", "Attempts retried.", &OpenMetricsOperation::retries);
+
+                WriteFamilyHeader(out, "aws_sdk_api_calls_in_flight", "gauge", "Api calls started but not completed yet.");
+                for (const auto& operation : operations)
+                {
+                    out << "aws_sdk_api_calls_in_flight{" << operation.first << "} " << operation.second->inFlight.load(std::memory_order_relaxed) << "\n";
+                }
+
+                WriteHistogramFamily(out, operations, "aws_sdk_api_call_duration_seconds", "Api call latency, including retries and backoff.",
+                    &OpenMetricsOperation::apiCallLatency);
+                WriteHistogramFamily(out, operations, "aws_sdk_connection_acquire_duration_seconds", "Time spent waiting for a connection from the http client pool.",
+                    &OpenMetricsOperation::connectionAcquireLatency);
+            }
+
+            {
+                std::lock_guard<std::mutex> locker(m_gaugesLock);
+                for (const auto& family : m_gauges)
+                {
+                    WriteFamilyHeader(out, family.first.c_str(), "gauge", family.second.help);
+                    for (const auto& gauge : family.second.gauges)
+                    {
+                        double value = gauge.valueProvider();
+                        if (std::isnan(value))
+                        {
+                            continue;
+                        }
+                        out << family.first;
+                        if (!gauge.labels.empty())
+                        {
+                            out << "{" << gauge.labels << "}";
+                        }
+                        out << " ";
+                        WriteGaugeValue(out, value);
+                        out << "\n";
+                    }
+                }
+            }
+
+            out << "# EOF\n";
+            return out.str();
+        }
+
+        bool OpenMetricsRegistry::StartListener(unsigned short port)
+        {
+            std::lock_guard<std::mutex> locker(m_listenerLock);
+            if (m_listener && m_listener->IsRunning())
+            {
+                return false;
+            }
+            m_listener = Aws::MakeUnique<Aws::Net::SimpleHttpListener>(OPEN_METRICS_ALLOC_TAG, CONTENT_TYPE, [this]() { return Render(); });
+            return m_listener->Start(port);
+        }
+
+        void OpenMetricsRegistry::StopListener()
+        {
+            std::lock_guard<std::mutex> locker(m_listenerLock);
+            if (m_listener)
+            {
+                m_listener->Stop();
+                m_listener = nullptr;
+            }
+        }
+
+        unsigned short OpenMetricsRegistry::GetListenerPort() const
+        {
+            std::lock_guard<std::mutex> locker(m_listenerLock);
+            return m_listener ? m_listener->GetPort() : 0;
+        }
+
+        OpenMetricsMonitoring::OpenMetricsMonitoring(const std::shared_ptr<OpenMetricsRegistry>& registry) :
+            m_registry(registry)
+        {
+        }
+
+        void* OpenMetricsMonitoring::OnRequestStarted(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request) const
+        {
+            AWS_UNREFERENCED_PARAM(request);
+
+            auto context = Aws::New<OpenMetricsContext>(OPEN_METRICS_ALLOC_TAG);
+            context->operation = m_registry->GetOperation(serviceName, requestName);
+            context->apiCallStartTime = std::chrono::steady_clock::now();
+            context->operation->inFlight.fetch_add(1, std::memory_order_relaxed);
+            return context;
+        }
+
+        void OpenMetricsMonitoring::OnRequestSucceeded(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
+            const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(serviceName);
+            AWS_UNREFERENCED_PARAM(requestName);
+            AWS_UNREFERENCED_PARAM(request);
+            AWS_UNREFERENCED_PARAM(outcome);
+
+            static_cast<OpenMetricsContext*>(context)->lastAttemptSucceeded = true;
+            RecordAttempt(metricsFromCore, context);
+        }
+
+        void OpenMetricsMonitoring::OnRequestFailed(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
+            const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(serviceName);
+            AWS_UNREFERENCED_PARAM(requestName);
+            AWS_UNREFERENCED_PARAM(request);
+
+            OpenMetricsContext* openMetricsContext = static_cast<OpenMetricsContext*>(context);
+            openMetricsContext->lastAttemptSucceeded = false;
+            if (IsThrottlingError(outcome))
+            {
+                openMetricsContext->operation->throttledAttempts.fetch_add(1, std::memory_order_relaxed);
+            }
+            RecordAttempt(metricsFromCore, context);
+        }
+
+        void OpenMetricsMonitoring::RecordAttempt(const CoreMetricsCollection& metricsFromCore, void* context) const
+        {
+            static const Aws::String acquireConnectionLatencyName = GetHttpClientMetricNameByType(HttpClientMetricsType::AcquireConnectionLatency);
+
+            OpenMetricsOperation* operation = static_cast<OpenMetricsContext*>(context)->operation;
+            operation->attempts.fetch_add(1, std::memory_order_relaxed);
+            auto iter = metricsFromCore.httpClientMetrics.find(acquireConnectionLatencyName);
+            if (iter != metricsFromCore.httpClientMetrics.end())
+            {
+                operation->connectionAcquireLatency.Record(iter->second);
+            }
+        }
+
+        void OpenMetricsMonitoring::OnRequestRetry(const Aws::String& serviceName, const Aws::String& requestName,
+            const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(serviceName);
+            AWS_UNREFERENCED_PARAM(requestName);
+            AWS_UNREFERENCED_PARAM(request);
+
+            static_cast<OpenMetricsContext*>(context)->operation->retries.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void OpenMetricsMonitoring::OnFinish(const Aws::String& serviceName, const Aws::String& requestName,
+            const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(serviceName);
+            AWS_UNREFERENCED_PARAM(requestName);
+            AWS_UNREFERENCED_PARAM(request);
+
+            OpenMetricsContext* openMetricsContext = static_cast<OpenMetricsContext*>(context);
+            OpenMetricsOperation* operation = openMetricsContext->operation;
+            operation->apiCallLatency.Record(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - openMetricsContext->apiCallStartTime).count());
+            operation->apiCalls.fetch_add(1, std::memory_order_relaxed);
+            if (!openMetricsContext->lastAttemptSucceeded)
+            {
+                operation->failedApiCalls.fetch_add(1, std::memory_order_relaxed);
+            }
+            operation->inFlight.fetch_sub(1, std::memory_order_relaxed);
+            Aws::Delete(openMetricsContext);
+        }
+
+        void OpenMetricsMonitoring::OnCircuitStateChanged(const Aws::String& serviceName, const Aws::String& circuitName, Aws::Client::CircuitState state) const
+        {
+            m_registry->SetCircuitState(serviceName, circuitName, state);
+        }
+
+        OpenMetricsMonitoringFactory::OpenMetricsMonitoringFactory(const std::shared_ptr<OpenMetricsRegistry>& registry) :
+            m_registry(registry)
+        {
+        }
+
+        Aws::UniquePtr<MonitoringInterface> OpenMetricsMonitoringFactory::CreateMonitoringInstance() const
+        {
+            return Aws::MakeUnique<OpenMetricsMonitoring>(OPEN_METRICS_ALLOC_TAG, m_registry);
+        }
+    } // namespace Monitoring
+} // namespace Aws
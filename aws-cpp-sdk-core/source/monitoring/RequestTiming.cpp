@@ -0,0 +1,99 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/monitoring/RequestTiming.h>
+#include <algorithm>
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        // Enough for a call without retries, every phase reported.
+        static const size_t INITIAL_SPAN_CAPACITY = 10;
+
+        const char* GetRequestPhaseName(RequestPhase phase)
+        {
+            switch (phase)
+            {
+                case RequestPhase::Serialization: return "Serialization";
+                case RequestPhase::Signing: return "Signing";
+                case RequestPhase::ConnectionAcquisition: return "ConnectionAcquisition";
+                case RequestPhase::DnsLookup: return "DnsLookup";
+                case RequestPhase::TcpConnect: return "TcpConnect";
+                case RequestPhase::TlsHandshake: return "TlsHandshake";
+                case RequestPhase::TimeToFirstByte: return "TimeToFirstByte";
+                case RequestPhase::ResponseTransfer: return "ResponseTransfer";
+                case RequestPhase::ResponseParsing: return "ResponseParsing";
+                case RequestPhase::RetryDelay: return "RetryDelay";
+                default: return "Unknown";
+            }
+        }
+
+        RequestTiming::RequestTiming(const Aws::String& serviceName, const Aws::String& requestName, const Aws::String& invocationId,
+            const std::shared_ptr<RequestTracer>& tracer) :
+            m_serviceName(serviceName), m_requestName(requestName), m_invocationId(invocationId), m_tracer(tracer),
+            m_startTime(std::chrono::steady_clock::now()), m_endTime(m_startTime), m_attemptCount(0)
+        {
+            m_spans.reserve(INITIAL_SPAN_CAPACITY);
+        }
+
+        void RequestTiming::StartAttempt()
+        {
+            m_attemptCount++;
+        }
+
+        void RequestTiming::AddSpan(RequestPhase phase, std::chrono::steady_clock::time_point startTime, std::chrono::microseconds duration)
+        {
+            RequestSpan span;
+            span.phase = phase;
+            span.attempt = (std::max)(m_attemptCount, 1L);
+            span.startTime = startTime;
+            span.duration = duration;
+            m_spans.push_back(span);
+            m_endTime = (std::max)(m_endTime, startTime + duration);
+
+            if (m_tracer)
+            {
+                m_tracer->OnSpan(*this, span);
+            }
+        }
+
+        void RequestTiming::AddSpan(RequestPhase phase, std::chrono::steady_clock::time_point startTime)
+        {
+            AddSpan(phase, startTime, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime));
+        }
+
+        std::chrono::microseconds RequestTiming::GetTotalDuration() const
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(m_endTime - m_startTime);
+        }
+
+        std::chrono::microseconds RequestTiming::GetPhaseDuration(RequestPhase phase) const
+        {
+            std::chrono::microseconds total(0);
+            for (const auto& span : m_spans)
+            {
+                if (span.phase == phase)
+                {
+                    total += span.duration;
+                }
+            }
+            return total;
+        }
+
+        std::chrono::microseconds RequestTiming::GetPhaseDuration(RequestPhase phase, long attempt) const
+        {
+            std::chrono::microseconds total(0);
+            for (const auto& span : m_spans)
+            {
+                if (span.phase == phase && span.attempt == attempt)
+                {
+                    total += span.duration;
+                }
+            }
+            return total;
+        }
+    } // namespace Monitoring
+} // namespace Aws
@@ -24,5 +24,11 @@ namespace Aws
         void CleanupNetwork()
         {
         }
+
+        Aws::Vector<Aws::String> ResolveHostAddresses(const Aws::String&)
+        {
+            // No portable resolver, the http client then resolves hosts itself.
+            return {};
+        }
     }
 }
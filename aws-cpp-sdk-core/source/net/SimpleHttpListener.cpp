@@ -0,0 +1,38 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/net/SimpleHttpListener.h>
+
+namespace Aws
+{
+    namespace Net
+    {
+        SimpleHttpListener::SimpleHttpListener(const Aws::String& contentType, const std::function<Aws::String()>& bodyProvider) :
+            m_contentType(contentType), m_bodyProvider(bodyProvider), m_listenSocket(-1), m_port(0), m_running(false)
+        {
+        }
+
+        SimpleHttpListener::~SimpleHttpListener()
+        {
+        }
+
+        bool SimpleHttpListener::Start(unsigned short)
+        {
+            return false;
+        }
+
+        void SimpleHttpListener::Stop()
+        {
+        }
+
+        void SimpleHttpListener::Serve()
+        {
+        }
+
+        void SimpleHttpListener::HandleConnection(int) const
+        {
+        }
+    }
+}
@@ -63,6 +63,11 @@ namespace Aws
             return -1;
         }
 
+        int SimpleUDP::SendDataBatch(const uint8_t* const*, const size_t*, size_t) const
+        {
+            return -1;
+        }
+
         int SimpleUDP::SendDataTo(const sockaddr*, size_t, const uint8_t*, size_t) const
         {
             return -1;
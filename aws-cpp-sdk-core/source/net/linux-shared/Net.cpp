@@ -5,6 +5,10 @@
 
 #include <aws/core/net/Net.h>
 
+#include <algorithm>
+#include <netdb.h>
+#include <sys/socket.h>
+
 namespace Aws
 {
     namespace Net
@@ -24,5 +28,30 @@ namespace Aws
         void CleanupNetwork()
         {
         }
+
+        Aws::Vector<Aws::String> ResolveHostAddresses(const Aws::String& host)
+        {
+            Aws::Vector<Aws::String> addresses;
+            addrinfo hints = {};
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            addrinfo* results = nullptr;
+            if (getaddrinfo(host.c_str(), nullptr, &hints, &results) != 0)
+            {
+                return addresses;
+            }
+
+            for (addrinfo* result = results; result; result = result->ai_next)
+            {
+                char address[NI_MAXHOST];
+                if (getnameinfo(result->ai_addr, static_cast<socklen_t>(result->ai_addrlen), address, sizeof(address), nullptr, 0, NI_NUMERICHOST) == 0 &&
+                    std::find(addresses.begin(), addresses.end(), address) == addresses.end())
+                {
+                    addresses.push_back(address);
+                }
+            }
+            freeaddrinfo(results);
+            return addresses;
+        }
     }
 }
@@ -0,0 +1,173 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <unistd.h>
+#include <string.h>
+#include <cerrno>
+#include <aws/core/net/SimpleHttpListener.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+namespace Aws
+{
+    namespace Net
+    {
+        static const char LISTENER_LOG_TAG[] = "SimpleHttpListener";
+        // How often the serving thread wakes up to check whether it should stop.
+        static const int POLL_INTERVAL_MS = 100;
+        static const int IO_TIMEOUT_MS = 1000;
+        static const size_t MAX_REQUEST_HEADER_SIZE = 8192;
+#ifdef MSG_NOSIGNAL
+        static const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+        static const int SEND_FLAGS = 0;
+#endif
+
+        SimpleHttpListener::SimpleHttpListener(const Aws::String& contentType, const std::function<Aws::String()>& bodyProvider) :
+            m_contentType(contentType), m_bodyProvider(bodyProvider), m_listenSocket(-1), m_port(0), m_running(false)
+        {
+        }
+
+        SimpleHttpListener::~SimpleHttpListener()
+        {
+            Stop();
+        }
+
+        bool SimpleHttpListener::Start(unsigned short port)
+        {
+            if (m_running.load())
+            {
+                return false;
+            }
+
+            int sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+            if (sock < 0)
+            {
+                AWS_LOGSTREAM_ERROR(LISTENER_LOG_TAG, "Failed to create listening socket, errno: " << errno);
+                return false;
+            }
+
+            int reuse = 1;
+            setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+            sockaddr_in address;
+            memset(&address, 0, sizeof(address));
+            address.sin_family = AF_INET;
+            address.sin_port = htons(port);
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+            socklen_t addressLength = sizeof(address);
+            if (bind(sock, reinterpret_cast<sockaddr*>(&address), addressLength) != 0 || listen(sock, SOMAXCONN) != 0 ||
+                getsockname(sock, reinterpret_cast<sockaddr*>(&address), &addressLength) != 0)
+            {
+                AWS_LOGSTREAM_ERROR(LISTENER_LOG_TAG, "Failed to listen on 127.0.0.1:" << port << ", errno: " << errno);
+                close(sock);
+                return false;
+            }
+
+            m_listenSocket = sock;
+            m_port = ntohs(address.sin_port);
+            m_running = true;
+            m_serveThread = std::thread(&SimpleHttpListener::Serve, this);
+            AWS_LOGSTREAM_INFO(LISTENER_LOG_TAG, "Listening on 127.0.0.1:" << m_port);
+            return true;
+        }
+
+        void SimpleHttpListener::Stop()
+        {
+            m_running = false;
+            if (m_serveThread.joinable())
+            {
+                m_serveThread.join();
+            }
+            if (m_listenSocket >= 0)
+            {
+                close(m_listenSocket);
+                m_listenSocket = -1;
+            }
+            m_port = 0;
+        }
+
+        void SimpleHttpListener::Serve()
+        {
+            pollfd listenPoll;
+            listenPoll.fd = m_listenSocket;
+            listenPoll.events = POLLIN;
+
+            while (m_running.load())
+            {
+                listenPoll.revents = 0;
+                if (poll(&listenPoll, 1, POLL_INTERVAL_MS) <= 0 || !(listenPoll.revents & POLLIN))
+                {
+                    continue;
+                }
+
+                int connection = accept(m_listenSocket, nullptr, nullptr);
+                if (connection < 0)
+                {
+                    continue;
+                }
+                HandleConnection(connection);
+                close(connection);
+            }
+        }
+
+        void SimpleHttpListener::HandleConnection(int connection) const
+        {
+            timeval timeout;
+            timeout.tv_sec = IO_TIMEOUT_MS / 1000;
+            timeout.tv_usec = (IO_TIMEOUT_MS % 1000) * 1000;
+            setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+            int noSigPipe = 1;
+            setsockopt(connection, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+            // Read until the end of the request headers, the request itself does not matter.
+            Aws::String request;
+            char buffer[1024];
+            while (request.find("\r\n\r\n") == Aws::String::npos && request.size() < MAX_REQUEST_HEADER_SIZE)
+            {
+                ssize_t received = recv(connection, buffer, sizeof(buffer), 0);
+                if (received <= 0)
+                {
+                    return;
+                }
+                request.append(buffer, static_cast<size_t>(received));
+            }
+
+            Aws::StringStream response;
+            if (request.compare(0, 4, "GET ") == 0)
+            {
+                Aws::String body = m_bodyProvider();
+                response << "HTTP/1.1 200 OK\r\nContent-Type: " << m_contentType << "\r\nContent-Length: " << body.size()
+                    << "\r\nConnection: close\r\n\r\n" << body;
+            }
+            else
+            {
+                response << "HTTP/1.1 405 Method Not Allowed\r\nAllow: GET\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+            }
+
+            Aws::String payload = response.str();
+            size_t sent = 0;
+            while (sent < payload.size())
+            {
+                ssize_t written = send(connection, payload.c_str() + sent, payload.size() - sent, SEND_FLAGS);
+                if (written <= 0)
+                {
+                    AWS_LOGSTREAM_DEBUG(LISTENER_LOG_TAG, "Failed to write response, errno: " << errno);
+                    return;
+                }
+                sent += static_cast<size_t>(written);
+            }
+        }
+    }
+}
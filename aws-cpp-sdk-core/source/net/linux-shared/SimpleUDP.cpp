@@ -14,6 +14,7 @@
 #include <string.h>
 #include <aws/core/net/SimpleUDP.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
 namespace Aws
 {
@@ -241,6 +242,48 @@ namespace Aws
             return send(GetUnderlyingSocket(), data, dataLen, 0);
         }
 
+        int SimpleUDP::SendDataBatch(const uint8_t* const* data, const size_t* dataLen, size_t count) const
+        {
+            if (!m_connected)
+            {
+                ConnectToHost(m_hostIP.c_str(), m_port);
+            }
+#if defined(__linux__) && !defined(__ANDROID__)
+            Aws::Vector<iovec> iovecs(count);
+            Aws::Vector<mmsghdr> messages(count);
+            for (size_t i = 0; i < count; i++)
+            {
+                iovecs[i].iov_base = const_cast<uint8_t*>(data[i]);
+                iovecs[i].iov_len = dataLen[i];
+                memset(&messages[i], 0, sizeof(mmsghdr));
+                messages[i].msg_hdr.msg_iov = &iovecs[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            size_t sent = 0;
+            while (sent < count)
+            {
+                int ret = sendmmsg(GetUnderlyingSocket(), &messages[sent], static_cast<unsigned int>(count - sent), 0);
+                if (ret <= 0)
+                {
+                    return sent ? static_cast<int>(sent) : -1;
+                }
+                sent += static_cast<size_t>(ret);
+            }
+            return static_cast<int>(sent);
+#else
+            size_t sent = 0;
+            for (; sent < count; sent++)
+            {
+                if (send(GetUnderlyingSocket(), data[sent], dataLen[sent], 0) < 0)
+                {
+                    return sent ? static_cast<int>(sent) : -1;
+                }
+            }
+            return static_cast<int>(sent);
+#endif
+        }
+
         int SimpleUDP::SendDataTo(const sockaddr* address, size_t addressLength, const uint8_t* data, size_t dataLen) const
         {
             if (m_connected)
@@ -4,7 +4,10 @@
  */
 
 #include <WinSock2.h>
+#include <WS2tcpip.h>
+#include <algorithm>
 #include <cassert>
+#include <aws/core/net/Net.h>
 #include <aws/core/utils/logging/LogMacros.h>
 
 namespace Aws
@@ -44,5 +47,30 @@ namespace Aws
             WSACleanup();
             s_globalNetworkInitiated = false;
         }
+
+        Aws::Vector<Aws::String> ResolveHostAddresses(const Aws::String& host)
+        {
+            Aws::Vector<Aws::String> addresses;
+            addrinfo hints = {};
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            addrinfo* results = nullptr;
+            if (getaddrinfo(host.c_str(), nullptr, &hints, &results) != 0)
+            {
+                return addresses;
+            }
+
+            for (addrinfo* result = results; result; result = result->ai_next)
+            {
+                char address[NI_MAXHOST];
+                if (getnameinfo(result->ai_addr, static_cast<socklen_t>(result->ai_addrlen), address, sizeof(address), nullptr, 0, NI_NUMERICHOST) == 0 &&
+                    std::find(addresses.begin(), addresses.end(), address) == addresses.end())
+                {
+                    addresses.push_back(address);
+                }
+            }
+            freeaddrinfo(results);
+            return addresses;
+        }
     }
 }
@@ -219,6 +219,23 @@ namespace Aws
             return send(GetUnderlyingSocket(), reinterpret_cast<const char*>(data), static_cast<int>(dataLen), 0);
         }
 
+        int SimpleUDP::SendDataBatch(const uint8_t* const* data, const size_t* dataLen, size_t count) const
+        {
+            if (!m_connected)
+            {
+                ConnectToHost(m_hostIP.c_str(), m_port);
+            }
+            size_t sent = 0;
+            for (; sent < count; sent++)
+            {
+                if (send(GetUnderlyingSocket(), reinterpret_cast<const char*>(data[sent]), static_cast<int>(dataLen[sent]), 0) == SOCKET_ERROR)
+                {
+                    return sent ? static_cast<int>(sent) : -1;
+                }
+            }
+            return static_cast<int>(sent);
+        }
+
         int SimpleUDP::SendDataTo(const sockaddr* address, size_t addressLength, const uint8_t* data, size_t dataLen) const
         {
             if (m_connected)
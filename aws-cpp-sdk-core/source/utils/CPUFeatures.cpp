@@ -0,0 +1,94 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/CPUFeatures.h>
+
+#if defined(AWS_CPU_X86_SIMD) && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace CPUFeatures
+        {
+#if defined(AWS_CPU_X86_SIMD) && defined(_MSC_VER) && !defined(__clang__)
+            static const int SSSE3_BIT = 1 << 9; // cpuid(1).ecx
+            static const int OSXSAVE_BIT = 1 << 27; // cpuid(1).ecx
+            static const int AVX_BIT = 1 << 28; // cpuid(1).ecx
+            static const int AVX2_BIT = 1 << 5; // cpuid(7, 0).ebx
+            static const unsigned long long XCR0_SSE_AVX_STATE = 0x6;
+
+            static bool DetectSSSE3()
+            {
+                int info[4];
+                __cpuid(info, 1);
+                return (info[2] & SSSE3_BIT) != 0;
+            }
+
+            static bool DetectAVX2()
+            {
+                int info[4];
+                __cpuid(info, 0);
+                if (info[0] < 7)
+                {
+                    return false;
+                }
+
+                __cpuid(info, 1);
+                if ((info[2] & OSXSAVE_BIT) == 0 || (info[2] & AVX_BIT) == 0)
+                {
+                    return false;
+                }
+                // The OS must save the xmm and ymm registers on context switches.
+                if ((_xgetbv(0) & XCR0_SSE_AVX_STATE) != XCR0_SSE_AVX_STATE)
+                {
+                    return false;
+                }
+
+                __cpuidex(info, 7, 0);
+                return (info[1] & AVX2_BIT) != 0;
+            }
+#elif defined(AWS_CPU_X86_SIMD)
+            static bool DetectSSSE3()
+            {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("ssse3") != 0;
+            }
+
+            static bool DetectAVX2()
+            {
+                // Also checks that the OS saves the ymm registers.
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2") != 0;
+            }
+#else
+            static bool DetectSSSE3()
+            {
+                return false;
+            }
+
+            static bool DetectAVX2()
+            {
+                return false;
+            }
+#endif
+
+            bool HasSSSE3()
+            {
+                static const bool hasSSSE3 = DetectSSSE3();
+                return hasSSSE3;
+            }
+
+            bool HasAVX2()
+            {
+                static const bool hasAVX2 = DetectAVX2();
+                return hasAVX2;
+            }
+        } // namespace CPUFeatures
+    } // namespace Utils
+} // namespace Aws
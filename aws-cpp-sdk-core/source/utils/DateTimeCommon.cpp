@@ -1007,6 +1007,236 @@ private:
     int m_state;
 };
 
+// Fixed width fast paths for the exact renderings services send and the SDK itself produces. They use plain calendar
+// arithmetic (H. Hinnant's days_from_civil/civil_from_days) instead of timegm/gmtime and strftime, anything they do not
+// recognize goes through the state machines and the C library as before.
+static const int64_t SECONDS_PER_DAY = 86400;
+static const char* const WEEKDAY_NAMES[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+static const char* const MONTH_NAMES[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+//Days since 1970-01-01 of a date in the proleptic Gregorian calendar, month in [1, 12]. Days out of range carry over like timegm.
+static int64_t DaysFromCivil(int64_t year, int64_t month, int64_t day)
+{
+    year -= month <= 2 ? 1 : 0;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t yearOfEra = year - era * 400;
+    const int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+static void CivilFromDays(int64_t days, int64_t& year, int& month, int& day)
+{
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const int64_t dayOfEra = days - era * 146097;
+    const int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const int64_t monthIndex = (5 * dayOfYear + 2) / 153;
+    day = static_cast<int>(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+    month = static_cast<int>(monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+    year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+static inline bool ParseFixedDigits(const char* str, int count, int& value)
+{
+    value = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        if (str[i] < '0' || str[i] > '9')
+        {
+            return false;
+        }
+        value = value * 10 + (str[i] - '0');
+    }
+    return true;
+}
+
+static inline std::time_t ToEpochSeconds(int year, int month, int day, int hour, int minute, int second)
+{
+    return static_cast<std::time_t>(DaysFromCivil(year, month, day) * SECONDS_PER_DAY + hour * 3600 + minute * 60 + second);
+}
+
+//"%Y-%m-%dT%H:%M:%SZ" or "%Y-%m-%dT%H:%M:%S.<digits>Z", fractional seconds are dropped like ISO_8601DateParser does.
+static bool TryParseFixedISO_8601(const char* str, size_t len, std::time_t& result)
+{
+    int year, month, day, hour, minute, second;
+    if (len < 20 || str[4] != '-' || str[7] != '-' || str[10] != 'T' || str[13] != ':' || str[16] != ':' ||
+        !ParseFixedDigits(str, 4, year) || !ParseFixedDigits(str + 5, 2, month) || !ParseFixedDigits(str + 8, 2, day) ||
+        !ParseFixedDigits(str + 11, 2, hour) || !ParseFixedDigits(str + 14, 2, minute) || !ParseFixedDigits(str + 17, 2, second) ||
+        month < 1 || month > 12)
+    {
+        return false;
+    }
+
+    size_t index = 19;
+    if (str[index] == '.')
+    {
+        for (++index; str[index] >= '0' && str[index] <= '9'; ++index) {}
+    }
+    if (str[index] != 'Z')
+    {
+        return false;
+    }
+
+    result = ToEpochSeconds(year, month, day, hour, minute, second);
+    return true;
+}
+
+//"%Y%m%dT%H%M%SZ" or "%Y%m%dT%H%M%S000Z"
+static bool TryParseFixedISO_8601Basic(const char* str, size_t len, std::time_t& result)
+{
+    int year, month, day, hour, minute, second, millis;
+    if (len < 16 || str[8] != 'T' ||
+        !ParseFixedDigits(str, 4, year) || !ParseFixedDigits(str + 4, 2, month) || !ParseFixedDigits(str + 6, 2, day) ||
+        !ParseFixedDigits(str + 9, 2, hour) || !ParseFixedDigits(str + 11, 2, minute) || !ParseFixedDigits(str + 13, 2, second) ||
+        month < 1 || month > 12)
+    {
+        return false;
+    }
+
+    if (str[15] != 'Z' && (len < 19 || !ParseFixedDigits(str + 15, 3, millis) || str[18] != 'Z'))
+    {
+        return false;
+    }
+
+    result = ToEpochSeconds(year, month, day, hour, minute, second);
+    return true;
+}
+
+//"%a, %d %b %Y %H:%M:%S GMT" (or UTC), the form of every Date and Last-Modified header.
+static bool TryParseFixedRFC822(const char* str, size_t len, std::time_t& result)
+{
+    int day, year, hour, minute, second;
+    if (len != 29 || str[3] != ',' || str[4] != ' ' || str[7] != ' ' || str[11] != ' ' || str[16] != ' ' ||
+        str[19] != ':' || str[22] != ':' || str[25] != ' ' ||
+        !ParseFixedDigits(str + 5, 2, day) || !ParseFixedDigits(str + 12, 4, year) || !ParseFixedDigits(str + 17, 2, hour) ||
+        !ParseFixedDigits(str + 20, 2, minute) || !ParseFixedDigits(str + 23, 2, second) ||
+        GetWeekDayNumberFromStr(str, 0, 3) < 0 || !IsUtcTimeZone(str + 26))
+    {
+        return false;
+    }
+
+    const int month = GetMonthNumberFromStr(str, 8, 11);
+    if (month < 0)
+    {
+        return false;
+    }
+
+    result = ToEpochSeconds(year, month + 1, day, hour, minute, second);
+    return true;
+}
+
+static bool TryParseFixedFormat(const char* timestamp, DateFormat format, std::time_t& result)
+{
+    const size_t len = strlen(timestamp);
+    if (len > MAX_LEN)
+    {
+        return false;
+    }
+
+    switch (format)
+    {
+    case DateFormat::RFC822:
+        return TryParseFixedRFC822(timestamp, len, result);
+    case DateFormat::ISO_8601:
+        return TryParseFixedISO_8601(timestamp, len, result);
+    case DateFormat::ISO_8601_BASIC:
+        return TryParseFixedISO_8601Basic(timestamp, len, result);
+    case DateFormat::AutoDetect:
+        return TryParseFixedRFC822(timestamp, len, result) || TryParseFixedISO_8601(timestamp, len, result) ||
+            TryParseFixedISO_8601Basic(timestamp, len, result);
+    default:
+        return false;
+    }
+}
+
+static inline char* WriteDigits(char* out, int value, int count)
+{
+    for (int i = count - 1; i >= 0; --i)
+    {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return out + count;
+}
+
+//Renders time in UTC in one of the DateFormats, returns the length written (at most 29) or 0 for years strftime has to deal with.
+static size_t FormatFixedGmt(std::time_t time, DateFormat format, char* out)
+{
+    const int64_t seconds = static_cast<int64_t>(time);
+    const int64_t days = (seconds >= 0 ? seconds : seconds - (SECONDS_PER_DAY - 1)) / SECONDS_PER_DAY;
+    const int secondOfDay = static_cast<int>(seconds - days * SECONDS_PER_DAY);
+
+    int64_t year;
+    int month, day;
+    CivilFromDays(days, year, month, day);
+    if (year < 0 || year > 9999)
+    {
+        return 0;
+    }
+
+    const int hour = secondOfDay / 3600;
+    const int minute = secondOfDay / 60 % 60;
+    const int second = secondOfDay % 60;
+
+    char* cursor = out;
+    switch (format)
+    {
+    case DateFormat::ISO_8601:
+        cursor = WriteDigits(cursor, static_cast<int>(year), 4);
+        *cursor++ = '-';
+        cursor = WriteDigits(cursor, month, 2);
+        *cursor++ = '-';
+        cursor = WriteDigits(cursor, day, 2);
+        *cursor++ = 'T';
+        cursor = WriteDigits(cursor, hour, 2);
+        *cursor++ = ':';
+        cursor = WriteDigits(cursor, minute, 2);
+        *cursor++ = ':';
+        cursor = WriteDigits(cursor, second, 2);
+        *cursor++ = 'Z';
+        break;
+    case DateFormat::ISO_8601_BASIC:
+        cursor = WriteDigits(cursor, static_cast<int>(year), 4);
+        cursor = WriteDigits(cursor, month, 2);
+        cursor = WriteDigits(cursor, day, 2);
+        *cursor++ = 'T';
+        cursor = WriteDigits(cursor, hour, 2);
+        cursor = WriteDigits(cursor, minute, 2);
+        cursor = WriteDigits(cursor, second, 2);
+        *cursor++ = 'Z';
+        break;
+    case DateFormat::RFC822:
+    {
+        // 1970-01-01 was a Thursday.
+        const int64_t weekday = ((days % 7) + 11) % 7;
+        memcpy(cursor, WEEKDAY_NAMES[weekday], 3);
+        cursor += 3;
+        *cursor++ = ',';
+        *cursor++ = ' ';
+        cursor = WriteDigits(cursor, day, 2);
+        *cursor++ = ' ';
+        memcpy(cursor, MONTH_NAMES[month - 1], 3);
+        cursor += 3;
+        *cursor++ = ' ';
+        cursor = WriteDigits(cursor, static_cast<int>(year), 4);
+        *cursor++ = ' ';
+        cursor = WriteDigits(cursor, hour, 2);
+        *cursor++ = ':';
+        cursor = WriteDigits(cursor, minute, 2);
+        *cursor++ = ':';
+        cursor = WriteDigits(cursor, second, 2);
+        memcpy(cursor, " GMT", 4);
+        cursor += 4;
+        break;
+    }
+    default:
+        return 0;
+    }
+    return static_cast<size_t>(cursor - out);
+}
+
 DateTime::DateTime(const std::chrono::system_clock::time_point& timepointToAssign) : m_time(timepointToAssign), m_valid(true)
 {
 }
@@ -1133,6 +1363,13 @@ Aws::String DateTime::ToLocalTimeString(const char* formatStr) const
 
 Aws::String DateTime::ToGmtString(DateFormat format) const
 {
+    char formattedString[32];
+    size_t len = FormatFixedGmt(std::chrono::system_clock::to_time_t(m_time), format, formattedString);
+    if (len)
+    {
+        return Aws::String(formattedString, len);
+    }
+
     switch (format)
     {
     case DateFormat::ISO_8601:
@@ -1291,6 +1528,14 @@ std::chrono::milliseconds DateTime::operator-(const DateTime& other) const
 
 void DateTime::ConvertTimestampStringToTimePoint(const char* timestamp, DateFormat format)
 {
+    std::time_t fixedFormatTime;
+    if (TryParseFixedFormat(timestamp, format, fixedFormatTime))
+    {
+        m_valid = true;
+        m_time = std::chrono::system_clock::from_time_t(fixedFormatTime);
+        return;
+    }
+
     std::tm timeStruct;
     bool isUtc = true;
 
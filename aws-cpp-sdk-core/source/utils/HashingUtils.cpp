@@ -13,9 +13,14 @@
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/memory/stl/AWSList.h>
+#include <aws/core/utils/CPUFeatures.h>
 
 #include <iomanip>
 
+#if defined(AWS_CPU_X86_SIMD)
+#include <immintrin.h>
+#endif
+
 using namespace Aws::Utils;
 using namespace Aws::Utils::Base64;
 using namespace Aws::Utils::Crypto;
@@ -137,15 +142,73 @@ ByteBuffer HashingUtils::CalculateSHA256TreeHash(Aws::IOStream& stream)
     return TreeHashFinalCompute(input);
 }
 
+#if defined(AWS_CPU_X86_SIMD)
+// Looks up the characters of the high and low nibbles of 16 (or 32) bytes at once and interleaves them.
+AWS_TARGET_SSSE3 static size_t HexEncodeSSSE3(const unsigned char* in, size_t length, char* out)
+{
+    const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16, out += 32)
+    {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask));
+        const __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, nibbleMask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+    return i;
+}
+
+AWS_TARGET_AVX2 static size_t HexEncodeAVX2(const unsigned char* in, size_t length, char* out)
+{
+    const __m256i digits = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'));
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32, out += 64)
+    {
+        const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        const __m256i hi = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibbleMask));
+        const __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(bytes, nibbleMask));
+        // Unpacking works within 128 bit lanes, the lanes are put back in order when storing.
+        const __m256i first = _mm256_unpacklo_epi8(hi, lo);
+        const __m256i second = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    // Leaving the upper ymm halves dirty makes every following non-VEX SSE instruction pay a transition penalty.
+    _mm256_zeroupper();
+    return i + HexEncodeSSSE3(in + i, length - i, out);
+}
+#endif
+
 Aws::String HashingUtils::HexEncode(const ByteBuffer& message)
 {
-    Aws::String encoded;
-    encoded.reserve(2 * message.GetLength());
+    const size_t length = message.GetLength();
+    const unsigned char* data = message.GetUnderlyingData();
+    Aws::String encoded(2 * length, '0');
+    char* output = &encoded[0];
+
+    size_t i = 0;
+#if defined(AWS_CPU_X86_SIMD)
+    if (CPUFeatures::HasAVX2())
+    {
+        i = HexEncodeAVX2(data, length, output);
+    }
+    else if (CPUFeatures::HasSSSE3())
+    {
+        i = HexEncodeSSSE3(data, length, output);
+    }
+    output += 2 * i;
+#endif
 
-    for (unsigned i = 0; i < message.GetLength(); ++i)
+    for (; i < length; ++i)
     {
-        encoded.push_back("0123456789abcdef"[message[i] >> 4]);
-        encoded.push_back("0123456789abcdef"[message[i] & 0x0f]);
+        *output++ = "0123456789abcdef"[data[i] >> 4];
+        *output++ = "0123456789abcdef"[data[i] & 0x0f];
     }
 
     return encoded;
@@ -0,0 +1,120 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/PercentEncoder.h>
+#include <aws/core/utils/CPUFeatures.h>
+
+#include <cstring>
+
+#if defined(AWS_CPU_X86_SIMD)
+#include <immintrin.h>
+#endif
+
+using namespace Aws::Utils;
+
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+static inline char* EncodeByte(unsigned char c, const bool* unescaped, char* out)
+{
+    if (unescaped[c])
+    {
+        *out++ = static_cast<char>(c);
+    }
+    else
+    {
+        *out++ = '%';
+        *out++ = HEX_DIGITS[c >> 4];
+        *out++ = HEX_DIGITS[c & 0x0f];
+    }
+    return out;
+}
+
+#if defined(AWS_CPU_X86_SIMD)
+// Classifies 16 bytes at once: the low nibble selects the set of accepted high nibbles, the high nibble its bit in that set.
+// Chunks without anything to escape are copied as is, the others (including any non-ASCII byte) are encoded byte by byte.
+AWS_TARGET_SSSE3 static size_t EncodeSSSE3(const unsigned char* in, size_t length, char*& out,
+    const uint8_t* unescapedHighNibbles, const bool* unescaped)
+{
+    const __m128i highNibbleSets = _mm_loadu_si128(reinterpret_cast<const __m128i*>(unescapedHighNibbles));
+    const __m128i highNibbleBits = _mm_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, static_cast<char>(0x80),
+        0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i sets = _mm_shuffle_epi8(highNibbleSets, _mm_and_si128(chunk, nibbleMask));
+        const __m128i bits = _mm_shuffle_epi8(highNibbleBits, _mm_and_si128(_mm_srli_epi16(chunk, 4), nibbleMask));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(sets, bits), _mm_setzero_si128())) == 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), chunk);
+            out += 16;
+            continue;
+        }
+
+        for (size_t j = i; j < i + 16; ++j)
+        {
+            out = EncodeByte(in[j], unescaped, out);
+        }
+    }
+    return i;
+}
+#endif
+
+PercentEncoder::PercentEncoder(const char* unescapedChars)
+{
+    memset(m_unescaped, 0, sizeof(m_unescaped));
+    memset(m_unescapedHighNibbles, 0, sizeof(m_unescapedHighNibbles));
+
+    for (unsigned c = '0'; c <= '9'; ++c)
+    {
+        m_unescaped[c] = true;
+    }
+    for (unsigned c = 'A'; c <= 'Z'; ++c)
+    {
+        m_unescaped[c] = true;
+        m_unescaped[c - 'A' + 'a'] = true;
+    }
+    for (const char* c = unescapedChars; *c; ++c)
+    {
+        m_unescaped[static_cast<unsigned char>(*c)] = true;
+    }
+
+    for (unsigned c = 0; c < 128; ++c)
+    {
+        if (m_unescaped[c])
+        {
+            m_unescapedHighNibbles[c & 0x0f] |= static_cast<uint8_t>(1u << (c >> 4));
+        }
+    }
+}
+
+size_t PercentEncoder::Encode(const char* data, size_t length, char* output) const
+{
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(data);
+    char* out = output;
+
+    size_t i = 0;
+#if defined(AWS_CPU_X86_SIMD)
+    if (length >= 16 && CPUFeatures::HasSSSE3())
+    {
+        i = EncodeSSSE3(in, length, out, m_unescapedHighNibbles, m_unescaped);
+    }
+#endif
+
+    for (; i < length; ++i)
+    {
+        out = EncodeByte(in[i], m_unescaped, out);
+    }
+    return static_cast<size_t>(out - output);
+}
+
+void PercentEncoder::Append(const char* data, size_t length, Aws::String& output) const
+{
+    const size_t offset = output.size();
+    output.resize(offset + MaxEncodedLength(length));
+    output.resize(offset + Encode(data, length, &output[offset]));
+}
@@ -5,6 +5,7 @@
 
 
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/PercentEncoder.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <algorithm>
 #include <iomanip>
@@ -67,10 +68,14 @@ Aws::String StringUtils::ToUpper(const char* source)
 
 bool StringUtils::CaselessCompare(const char* value1, const char* value2)
 {
-    Aws::String value1Lower = ToLower(value1);
-    Aws::String value2Lower = ToLower(value2);
-
-    return value1Lower == value2Lower;
+    for (; *value1 && *value2; ++value1, ++value2)
+    {
+        if (::tolower(static_cast<unsigned char>(*value1)) != ::tolower(static_cast<unsigned char>(*value2)))
+        {
+            return false;
+        }
+    }
+    return *value1 == *value2;
 }
 
 Aws::Vector<Aws::String> StringUtils::Split(const Aws::String& toSplit, char splitOn)
@@ -148,26 +153,11 @@ Aws::Vector<Aws::String> StringUtils::SplitOnLine(const Aws::String& toSplit)
 
 Aws::String StringUtils::URLEncode(const char* unsafe)
 {
-    Aws::StringStream escaped;
-    escaped.fill('0');
-    escaped << std::hex << std::uppercase;
+    static const PercentEncoder encoder("-_.~");
 
-    size_t unsafeLength = strlen(unsafe);
-    for (auto i = unsafe, n = unsafe + unsafeLength; i != n; ++i)
-    {
-        char c = *i;
-        if (IsAlnum(c) || c == '-' || c == '_' || c == '.' || c == '~')
-        {
-            escaped << (char)c;
-        }
-        else
-        {
-            //this unsigned char cast allows us to handle unicode characters.
-            escaped << '%' << std::setw(2) << int((unsigned char)c) << std::setw(0);
-        }
-    }
-
-    return escaped.str();
+    Aws::String escaped;
+    encoder.Append(unsafe, strlen(unsafe), escaped);
+    return escaped;
 }
 
 Aws::String StringUtils::UTF8Escape(const char* unicodeString, const char* delimiter)
@@ -7,7 +7,7 @@
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/crypto/Factories.h>
-#include <aws/core/utils/crypto/SecureRandom.h>
+#include <aws/core/utils/UnreferencedParam.h>
 #include <iomanip>
 
 namespace Aws
@@ -71,12 +71,11 @@ namespace Aws
 
         UUID UUID::RandomUUID()
         {
-            auto secureRandom = Crypto::CreateSecureRandomBytesImplementation();
-            assert(secureRandom);
-
             unsigned char randomBytes[UUID_BINARY_SIZE];
             memset(randomBytes, 0, UUID_BINARY_SIZE);
-            secureRandom->GetBytes(randomBytes, UUID_BINARY_SIZE);
+            bool gotRandomBytes = Crypto::GetBufferedSecureRandomBytes(randomBytes, UUID_BINARY_SIZE);
+            assert(gotRandomBytes);
+            AWS_UNREFERENCED_PARAM(gotRandomBytes);
             //Set version bits to 0100
             //https://tools.ietf.org/html/rfc4122#section-4.1.3
             randomBytes[VERSION_LOCATION] = (randomBytes[VERSION_LOCATION] & VERSION_MASK) | VERSION;
@@ -7,6 +7,7 @@
 #include <aws/core/utils/crypto/Factories.h>
 #include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/utils/crypto/HMAC.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 #if ENABLE_BCRYPT_ENCRYPTION
     #include <aws/core/utils/crypto/bcrypt/CryptoImpl.h>
@@ -24,6 +25,13 @@
     #define NO_ENCRYPTION
 #endif
 
+#include <atomic>
+#include <cstring>
+
+#ifndef _WIN32
+    #include <pthread.h>
+#endif
+
 using namespace Aws::Utils;
 using namespace Aws::Utils::Crypto;
 
@@ -83,6 +91,27 @@ static std::shared_ptr<SecureRandomBytes>& GetSecureRandom()
     return s_SecureRandom;
 }
 
+// Bumped whenever the secure random implementation changes and in forked children, so per-thread buffers are discarded
+// instead of serving bytes from a previous implementation or bytes the parent process also has.
+static std::atomic<unsigned> s_secureRandomGeneration(0);
+
+static const size_t SECURE_RANDOM_BUFFER_SIZE = 256;
+
+struct SecureRandomBuffer
+{
+    unsigned char bytes[SECURE_RANDOM_BUFFER_SIZE];
+    size_t available;
+    unsigned generation;
+};
+
+// Trivial type, so it is zero initialized without any per-thread constructor or destructor.
+static thread_local SecureRandomBuffer s_secureRandomBuffer;
+
+static void InvalidateSecureRandomBuffers()
+{
+    s_secureRandomGeneration.fetch_add(1, std::memory_order_release);
+}
+
 static bool s_InitCleanupOpenSSLFlag(false);
 
 class DefaultMD5Factory : public HashFactory
@@ -683,6 +712,12 @@ void Aws::Utils::Crypto::InitCrypto()
     }
 
     GetSecureRandom() = GetSecureRandomFactory()->CreateImplementation();
+    InvalidateSecureRandomBuffers();
+
+#ifndef _WIN32
+    static const int registeredForkHandler = pthread_atfork(nullptr, nullptr, &InvalidateSecureRandomBuffers);
+    AWS_UNREFERENCED_PARAM(registeredForkHandler);
+#endif
 }
 
 void Aws::Utils::Crypto::CleanupCrypto()
@@ -732,6 +767,7 @@ void Aws::Utils::Crypto::CleanupCrypto()
     if(GetSecureRandomFactory())
     {
         GetSecureRandom() = nullptr;
+        InvalidateSecureRandomBuffers();
         GetSecureRandomFactory()->CleanupStaticState();
         GetSecureRandomFactory() = nullptr;
     }
@@ -893,3 +929,39 @@ std::shared_ptr<SecureRandomBytes> Aws::Utils::Crypto::CreateSecureRandomBytesIm
 {
     return GetSecureRandom();
 }
+
+bool Aws::Utils::Crypto::GetBufferedSecureRandomBytes(unsigned char* buffer, size_t bufferSize)
+{
+    const std::shared_ptr<SecureRandomBytes>& secureRandom = GetSecureRandom();
+    if (!secureRandom)
+    {
+        return false;
+    }
+
+    // Large requests are not worth buffering.
+    if (bufferSize > SECURE_RANDOM_BUFFER_SIZE / 4)
+    {
+        secureRandom->GetBytes(buffer, bufferSize);
+        return static_cast<bool>(*secureRandom);
+    }
+
+    SecureRandomBuffer& randomBuffer = s_secureRandomBuffer;
+    const unsigned generation = s_secureRandomGeneration.load(std::memory_order_acquire);
+    if (randomBuffer.generation != generation || randomBuffer.available < bufferSize)
+    {
+        randomBuffer.available = 0;
+        secureRandom->GetBytes(randomBuffer.bytes, SECURE_RANDOM_BUFFER_SIZE);
+        if (!*secureRandom)
+        {
+            return false;
+        }
+        randomBuffer.available = SECURE_RANDOM_BUFFER_SIZE;
+        randomBuffer.generation = generation;
+    }
+
+    // Hand out bytes from the end and wipe them, so no byte is ever handed out twice or kept around after use.
+    randomBuffer.available -= bufferSize;
+    memcpy(buffer, randomBuffer.bytes + randomBuffer.available, bufferSize);
+    memset(randomBuffer.bytes + randomBuffer.available, 0, bufferSize);
+    return true;
+}
@@ -4,6 +4,7 @@
  */
 #include <aws/core/utils/stream/ConcurrentStreamBuf.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <algorithm>
 #include <cstdint>
 #include <cassert>
 
@@ -15,14 +16,38 @@ namespace Aws
         {
             const char TAG[] = "ConcurrentStreamBuf";
             ConcurrentStreamBuf::ConcurrentStreamBuf(size_t bufferLength) :
-                m_putArea(bufferLength), // we access [0] of the put area below so we must initialize it.
+                m_buffer((std::max)(bufferLength, static_cast<size_t>(1))),
+                m_writePos(0),
+                m_readPos(0),
+                m_readerWaiting(false),
+                m_writerWaiting(false),
                 m_eof(false)
             {
-                m_getArea.reserve(bufferLength);
-                m_backbuf.reserve(bufferLength);
+                char* begin = reinterpret_cast<char*>(&m_buffer[0]);
+                setp(begin, begin + m_buffer.size());
+                setg(begin, begin, begin);
+            }
 
-                char* pbegin = reinterpret_cast<char*>(&m_putArea[0]);
-                setp(pbegin, pbegin + bufferLength);
+            // The waiting flag is raised under the lock before the last check of the condition, and the other side
+            // publishes its position before looking at the flag, so a wake up can't be missed.
+            template<typename Predicate>
+            void ConcurrentStreamBuf::WaitUntil(std::atomic<bool>& waiting, Predicate ready)
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                waiting.store(true);
+                m_signal.wait(lock, [&]{ return m_eof.load() || ready(); });
+                waiting.store(false);
+            }
+
+            void ConcurrentStreamBuf::Wake(const std::atomic<bool>& waiting)
+            {
+                if (waiting.load())
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_lock);
+                    }
+                    m_signal.notify_all();
+                }
             }
 
             void ConcurrentStreamBuf::SetEof()
@@ -39,19 +64,13 @@ namespace Aws
                 const size_t bitslen = pptr() - pbase();
                 if (bitslen)
                 {
-                    // scope the lock
+                    if (m_eof)
                     {
-                        std::unique_lock<std::mutex> lock(m_lock);
-                        m_signal.wait(lock, [this, bitslen]{ return m_eof || bitslen <= (m_backbuf.capacity() - m_backbuf.size()); });
-                        if (m_eof)
-                        {
-                            return;
-                        }
-                        std::copy(pbase(), pptr(), std::back_inserter(m_backbuf));
+                        return;
                     }
-                    m_signal.notify_one();
-                    char* pbegin = reinterpret_cast<char*>(&m_putArea[0]);
-                    setp(pbegin, pbegin + m_putArea.size());
+                    m_writePos.store(m_writePos.load(std::memory_order_relaxed) + bitslen);
+                    setp(pptr(), epptr());
+                    Wake(m_readerWaiting);
                 }
             }
 
@@ -67,53 +86,76 @@ namespace Aws
 
             int ConcurrentStreamBuf::underflow()
             {
+                // Hand the bytes read so far back to the writer.
+                const size_t consumed = gptr() - eback();
+                const uint64_t readPos = m_readPos.load(std::memory_order_relaxed) + consumed;
+                if (consumed)
                 {
-                    std::unique_lock<std::mutex> lock(m_lock);
-                    m_signal.wait(lock, [this]{ return m_backbuf.empty() == false || m_eof; });
+                    m_readPos.store(readPos);
+                    Wake(m_writerWaiting);
+                }
 
-                    if (m_eof && m_backbuf.empty())
+                uint64_t available = m_writePos.load() - readPos;
+                if (available == 0)
+                {
+                    WaitUntil(m_readerWaiting, [this, readPos]{ return m_writePos.load() != readPos; });
+                    // Bytes published before the end of the stream are still read.
+                    available = m_writePos.load() - readPos;
+                    if (available == 0)
                     {
+                        setg(eback(), eback(), eback());
                         return std::char_traits<char>::eof();
                     }
-
-                    m_getArea.clear(); // keep the get-area from growing unbounded.
-                    std::copy(m_backbuf.begin(), m_backbuf.end(), std::back_inserter(m_getArea));
-                    m_backbuf.clear();
                 }
-                m_signal.notify_one();
-                char* gbegin = reinterpret_cast<char*>(&m_getArea[0]);
-                setg(gbegin, gbegin, gbegin + m_getArea.size());
+
+                const size_t capacity = m_buffer.size();
+                const size_t start = static_cast<size_t>(readPos % capacity);
+                const size_t length = static_cast<size_t>((std::min)(available, static_cast<uint64_t>(capacity - start)));
+                char* gbegin = reinterpret_cast<char*>(&m_buffer[start]);
+                setg(gbegin, gbegin, gbegin + length);
                 return std::char_traits<char>::to_int_type(*gptr());
             }
 
             std::streamsize ConcurrentStreamBuf::showmanyc()
             {
-                std::unique_lock<std::mutex> lock(m_lock);
-                AWS_LOGSTREAM_TRACE(TAG, "stream how many character? " << m_backbuf.size());
-                return m_backbuf.size();
+                // Bytes published by the writer but not yet in the get area.
+                const uint64_t getAreaEnd = m_readPos.load(std::memory_order_relaxed) + (egptr() - eback());
+                const std::streamsize available = static_cast<std::streamsize>(m_writePos.load() - getAreaEnd);
+                AWS_LOGSTREAM_TRACE(TAG, "stream how many character? " << available);
+                return available;
             }
 
             int ConcurrentStreamBuf::overflow(int ch)
             {
                 const auto eof = std::char_traits<char>::eof();
 
+                FlushPutArea();
                 if (ch == eof)
                 {
-                    FlushPutArea();
                     return eof;
                 }
 
-                FlushPutArea();
+                // Back pressure: wait for the reader to free part of the ring.
+                const size_t capacity = m_buffer.size();
+                const uint64_t writePos = m_writePos.load(std::memory_order_relaxed);
+                uint64_t free = capacity - (writePos - m_readPos.load());
+                if (free == 0)
                 {
-                    std::unique_lock<std::mutex> lock(m_lock);
-                    if (m_eof)
-                    {
-                        return eof;
-                    }
-                    *pptr() = static_cast<char>(ch);
-                    pbump(1);
-                    return ch;
+                    WaitUntil(m_writerWaiting, [this, writePos, capacity]{ return writePos - m_readPos.load() < capacity; });
+                    free = capacity - (writePos - m_readPos.load());
+                }
+                if (m_eof)
+                {
+                    return eof;
                 }
+
+                const size_t start = static_cast<size_t>(writePos % capacity);
+                const size_t length = static_cast<size_t>((std::min)(free, static_cast<uint64_t>(capacity - start)));
+                char* pbegin = reinterpret_cast<char*>(&m_buffer[start]);
+                setp(pbegin, pbegin + length);
+                *pptr() = static_cast<char>(ch);
+                pbump(1);
+                return ch;
             }
 
             int ConcurrentStreamBuf::sync()
@@ -0,0 +1,282 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/stream/FileBodyStreamBuf.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            static const char FILE_BODY_STREAM_BUF_TAG[] = "FileBodyStreamBuf";
+            // Reads shorter than this go through m_buffer.
+            static const size_t SMALL_READ_SIZE = 8 * 1024;
+
+#ifdef _WIN32
+            FileBodyStreamBuf::FileBodyStreamBuf(const Aws::String& path, uint64_t offset, uint64_t length) :
+                m_file(INVALID_HANDLE_VALUE),
+                m_offset(offset),
+                m_length(0),
+                m_getAreaOffset(0)
+            {
+                setg(nullptr, nullptr, nullptr);
+                HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+                LARGE_INTEGER fileSize;
+                if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &fileSize))
+                {
+                    AWS_LOGSTREAM_ERROR(FILE_BODY_STREAM_BUF_TAG, "Unable to open " << path << ", error code: " << GetLastError());
+                    if (file != INVALID_HANDLE_VALUE)
+                    {
+                        CloseHandle(file);
+                    }
+                    return;
+                }
+                m_file = file;
+                const uint64_t size = static_cast<uint64_t>(fileSize.QuadPart);
+                m_offset = (std::min)(offset, size);
+                m_length = (std::min)(length, size - m_offset);
+            }
+
+            FileBodyStreamBuf::~FileBodyStreamBuf()
+            {
+                if (IsOpen())
+                {
+                    CloseHandle(m_file);
+                }
+            }
+
+            bool FileBodyStreamBuf::IsOpen() const
+            {
+                return m_file != INVALID_HANDLE_VALUE;
+            }
+
+            size_t FileBodyStreamBuf::ReadAt(uint64_t position, char* dest, size_t length)
+            {
+                size_t total = 0;
+                while (total < length)
+                {
+                    const uint64_t fileOffset = m_offset + position + total;
+                    OVERLAPPED overlapped = {};
+                    overlapped.Offset = static_cast<DWORD>(fileOffset);
+                    overlapped.OffsetHigh = static_cast<DWORD>(fileOffset >> 32);
+                    const DWORD toRead = static_cast<DWORD>((std::min)(length - total, static_cast<size_t>(1u << 30)));
+                    DWORD read = 0;
+                    if (!ReadFile(m_file, dest + total, toRead, &read, &overlapped) || read == 0)
+                    {
+                        break;
+                    }
+                    total += read;
+                }
+                return total;
+            }
+#else
+            FileBodyStreamBuf::FileBodyStreamBuf(const Aws::String& path, uint64_t offset, uint64_t length) :
+                m_file(-1),
+                m_offset(offset),
+                m_length(0),
+                m_getAreaOffset(0)
+            {
+                setg(nullptr, nullptr, nullptr);
+                int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                struct stat fileStat;
+                if (file < 0 || fstat(file, &fileStat) != 0)
+                {
+                    AWS_LOGSTREAM_ERROR(FILE_BODY_STREAM_BUF_TAG, "Unable to open " << path << ", errno: " << errno);
+                    if (file >= 0)
+                    {
+                        close(file);
+                    }
+                    return;
+                }
+                m_file = file;
+                const uint64_t size = static_cast<uint64_t>(fileStat.st_size);
+                m_offset = (std::min)(offset, size);
+                m_length = (std::min)(length, size - m_offset);
+#if defined(POSIX_FADV_SEQUENTIAL)
+                // Lets the kernel read ahead more aggressively, the body is usually read once from start to end.
+                posix_fadvise(m_file, static_cast<off_t>(m_offset), static_cast<off_t>(m_length), POSIX_FADV_SEQUENTIAL);
+#endif
+            }
+
+            FileBodyStreamBuf::~FileBodyStreamBuf()
+            {
+                if (IsOpen())
+                {
+                    close(m_file);
+                }
+            }
+
+            bool FileBodyStreamBuf::IsOpen() const
+            {
+                return m_file >= 0;
+            }
+
+            size_t FileBodyStreamBuf::ReadAt(uint64_t position, char* dest, size_t length)
+            {
+                size_t total = 0;
+                while (total < length)
+                {
+                    const ssize_t read = pread(m_file, dest + total, length - total, static_cast<off_t>(m_offset + position + total));
+                    if (read < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    if (read <= 0)
+                    {
+                        break;
+                    }
+                    total += static_cast<size_t>(read);
+                }
+                return total;
+            }
+#endif
+
+            uint64_t FileBodyStreamBuf::CurrentPosition() const
+            {
+                return m_getAreaOffset + static_cast<uint64_t>(gptr() - eback());
+            }
+
+            FileBodyStreamBuf::int_type FileBodyStreamBuf::underflow()
+            {
+                if (gptr() < egptr())
+                {
+                    return traits_type::to_int_type(*gptr());
+                }
+
+                const uint64_t position = CurrentPosition();
+                m_getAreaOffset = position;
+                setg(nullptr, nullptr, nullptr);
+                if (!IsOpen() || position >= m_length)
+                {
+                    return traits_type::eof();
+                }
+
+                m_buffer.resize(SMALL_READ_SIZE);
+                const size_t toRead = static_cast<size_t>((std::min)(static_cast<uint64_t>(m_buffer.size()), m_length - position));
+                const size_t read = ReadAt(position, m_buffer.data(), toRead);
+                if (read == 0)
+                {
+                    return traits_type::eof();
+                }
+                setg(m_buffer.data(), m_buffer.data(), m_buffer.data() + read);
+                return traits_type::to_int_type(*gptr());
+            }
+
+            std::streamsize FileBodyStreamBuf::xsgetn(char* s, std::streamsize n)
+            {
+                std::streamsize copied = 0;
+                // What is left in the get area first.
+                if (gptr() < egptr())
+                {
+                    copied = (std::min)(n, static_cast<std::streamsize>(egptr() - gptr()));
+                    memcpy(s, gptr(), static_cast<size_t>(copied));
+                    setg(eback(), gptr() + copied, egptr());
+                }
+                if (copied == n || !IsOpen())
+                {
+                    return copied;
+                }
+
+                const uint64_t position = CurrentPosition();
+                const size_t wanted = static_cast<size_t>((std::min)(static_cast<uint64_t>(n - copied), m_length - position));
+                if (wanted < SMALL_READ_SIZE)
+                {
+                    while (copied < n && underflow() != traits_type::eof())
+                    {
+                        const std::streamsize length = (std::min)(n - copied, static_cast<std::streamsize>(egptr() - gptr()));
+                        memcpy(s + copied, gptr(), static_cast<size_t>(length));
+                        setg(eback(), gptr() + length, egptr());
+                        copied += length;
+                    }
+                    return copied;
+                }
+
+                // Straight into the caller's buffer.
+                const size_t read = ReadAt(position, s + copied, wanted);
+                m_getAreaOffset = position + read;
+                setg(nullptr, nullptr, nullptr);
+                return copied + static_cast<std::streamsize>(read);
+            }
+
+            std::streamsize FileBodyStreamBuf::showmanyc()
+            {
+                const uint64_t remaining = m_length - CurrentPosition();
+                return remaining ? static_cast<std::streamsize>(remaining) : -1;
+            }
+
+            FileBodyStreamBuf::pos_type FileBodyStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+            {
+                off_type base = 0;
+                if (dir == std::ios_base::cur)
+                {
+                    base = static_cast<off_type>(CurrentPosition());
+                }
+                else if (dir == std::ios_base::end)
+                {
+                    base = static_cast<off_type>(m_length);
+                }
+                return seekpos(pos_type(base + off), which);
+            }
+
+            FileBodyStreamBuf::pos_type FileBodyStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+            {
+                const off_type offset = off_type(pos);
+                if ((which & std::ios_base::in) == 0 || !IsOpen() || offset < 0 || static_cast<uint64_t>(offset) > m_length)
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                const uint64_t position = static_cast<uint64_t>(offset);
+                // Stay in the buffered data if the position is in it.
+                if (eback() && position >= m_getAreaOffset && position <= m_getAreaOffset + static_cast<uint64_t>(egptr() - eback()))
+                {
+                    setg(eback(), eback() + (position - m_getAreaOffset), egptr());
+                    return pos;
+                }
+                m_getAreaOffset = position;
+                setg(nullptr, nullptr, nullptr);
+                return pos;
+            }
+
+            FileBodyStream::FileBodyStream(const Aws::String& path, uint64_t offset, uint64_t length) :
+                Aws::IOStream(&m_streambuf),
+                m_streambuf(path, offset, length)
+            {
+                pword(StreamIndex()) = &m_streambuf;
+                if (!m_streambuf.IsOpen())
+                {
+                    setstate(std::ios_base::failbit);
+                }
+            }
+
+            int FileBodyStream::StreamIndex()
+            {
+                static const int index = std::ios_base::xalloc();
+                return index;
+            }
+
+            FileBodyStreamBuf* FileBodyStream::GetFileBodyStreamBuf(std::ios& stream)
+            {
+                auto streambuf = static_cast<FileBodyStreamBuf*>(stream.pword(StreamIndex()));
+                // copyfmt copies the pword slots too: only trust it for the stream buf the stream actually reads from.
+                return streambuf && static_cast<std::streambuf*>(streambuf) == stream.rdbuf() ? streambuf : nullptr;
+            }
+        }
+    }
+}
@@ -0,0 +1,156 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/stream/SegmentedStreamBuf.h>
+#include <algorithm>
+#include <cstring>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            SegmentedStreamBuf::SegmentedStreamBuf() :
+                m_nextSegment(0),
+                m_getAreaOffset(0),
+                m_length(0)
+            {
+                setg(nullptr, nullptr, nullptr);
+            }
+
+            void SegmentedStreamBuf::Append(const unsigned char* data, size_t length)
+            {
+                if (length == 0)
+                {
+                    return;
+                }
+                m_segments.push_back(Segment { reinterpret_cast<const char*>(data), length, m_length });
+                m_length += length;
+            }
+
+            void SegmentedStreamBuf::Append(Aws::String&& data)
+            {
+                if (data.empty())
+                {
+                    return;
+                }
+                m_ownedData.push_back(std::move(data));
+                const Aws::String& owned = m_ownedData.back();
+                Append(reinterpret_cast<const unsigned char*>(owned.data()), owned.size());
+            }
+
+            size_t SegmentedStreamBuf::CurrentPosition() const
+            {
+                return m_getAreaOffset + static_cast<size_t>(gptr() - eback());
+            }
+
+            SegmentedStreamBuf::int_type SegmentedStreamBuf::underflow()
+            {
+                if (gptr() < egptr())
+                {
+                    return traits_type::to_int_type(*gptr());
+                }
+
+                if (m_nextSegment >= m_segments.size())
+                {
+                    m_getAreaOffset = m_length;
+                    setg(nullptr, nullptr, nullptr);
+                    return traits_type::eof();
+                }
+
+                const Segment& segment = m_segments[m_nextSegment++];
+                char* begin = const_cast<char*>(segment.data);
+                m_getAreaOffset = segment.offset;
+                setg(begin, begin, begin + segment.length);
+                return traits_type::to_int_type(*gptr());
+            }
+
+            std::streamsize SegmentedStreamBuf::xsgetn(char* s, std::streamsize n)
+            {
+                std::streamsize copied = 0;
+                while (copied < n)
+                {
+                    if (gptr() == egptr() && underflow() == traits_type::eof())
+                    {
+                        break;
+                    }
+                    const std::streamsize length = (std::min)(n - copied, static_cast<std::streamsize>(egptr() - gptr()));
+                    memcpy(s + copied, gptr(), static_cast<size_t>(length));
+                    setg(eback(), gptr() + length, egptr());
+                    copied += length;
+                }
+                return copied;
+            }
+
+            std::streamsize SegmentedStreamBuf::showmanyc()
+            {
+                const size_t remaining = m_length - CurrentPosition();
+                return remaining ? static_cast<std::streamsize>(remaining) : -1;
+            }
+
+            SegmentedStreamBuf::pos_type SegmentedStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+            {
+                off_type base = 0;
+                if (dir == std::ios_base::cur)
+                {
+                    base = static_cast<off_type>(CurrentPosition());
+                }
+                else if (dir == std::ios_base::end)
+                {
+                    base = static_cast<off_type>(m_length);
+                }
+                return seekpos(pos_type(base + off), which);
+            }
+
+            SegmentedStreamBuf::pos_type SegmentedStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+            {
+                const off_type offset = off_type(pos);
+                if ((which & std::ios_base::in) == 0 || offset < 0 || static_cast<size_t>(offset) > m_length)
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                const size_t position = static_cast<size_t>(offset);
+                if (position == m_length)
+                {
+                    m_nextSegment = m_segments.size();
+                    m_getAreaOffset = m_length;
+                    setg(nullptr, nullptr, nullptr);
+                    return pos;
+                }
+
+                // Last segment starting at or before the position, segments are never empty so it contains it.
+                auto it = std::upper_bound(m_segments.begin(), m_segments.end(), position,
+                    [](size_t value, const Segment& segment) { return value < segment.offset; });
+                const Segment& segment = *(it - 1);
+                char* begin = const_cast<char*>(segment.data);
+                m_nextSegment = static_cast<size_t>(it - m_segments.begin());
+                m_getAreaOffset = segment.offset;
+                setg(begin, begin + (position - segment.offset), begin + segment.length);
+                return pos;
+            }
+
+            SegmentedStream::SegmentedStream() :
+                Aws::IOStream(&m_streambuf)
+            {
+                pword(StreamIndex()) = &m_streambuf;
+            }
+
+            int SegmentedStream::StreamIndex()
+            {
+                static const int index = std::ios_base::xalloc();
+                return index;
+            }
+
+            SegmentedStreamBuf* SegmentedStream::GetSegmentedStreamBuf(std::ios& stream)
+            {
+                auto streambuf = static_cast<SegmentedStreamBuf*>(stream.pword(StreamIndex()));
+                // copyfmt copies the pword slots too: only trust it for the stream buf the stream actually reads from.
+                return streambuf && static_cast<std::streambuf*>(streambuf) == stream.rdbuf() ? streambuf : nullptr;
+            }
+        }
+    }
+}
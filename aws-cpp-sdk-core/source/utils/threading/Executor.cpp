@@ -5,6 +5,7 @@
 
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/threading/ThreadTask.h>
+#include <aws/core/utils/Probes.h>
 #include <thread>
 #include <cassert>
 
@@ -15,6 +16,7 @@ using namespace Aws::Utils::Threading;
 bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
 {
     auto main = [fx, this] { 
+        AWS_SDK_PROBE2(executor__start, this, static_cast<std::function<void()>*>(nullptr));
         fx(); 
         Detach(std::this_thread::get_id()); 
     };
@@ -28,6 +30,7 @@ bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
             std::thread t(main);
             const auto id = t.get_id(); // copy the id before we std::move the thread
             m_threads.emplace(id, std::move(t));
+            AWS_SDK_PROBE3(executor__submit, this, static_cast<std::function<void()>*>(nullptr), m_threads.size());
             m_state = State::Free;
             return true;
         }
@@ -124,6 +127,7 @@ bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fn)
         }
 
         m_tasks.push(fnCpy);
+        AWS_SDK_PROBE3(executor__submit, this, fnCpy, m_tasks.size());
     }
 
     m_sync.Release();
@@ -153,3 +157,9 @@ bool PooledThreadExecutor::HasTasks()
     std::lock_guard<std::mutex> locker(m_queueLock);
     return m_tasks.size() > 0;
 }
+
+size_t PooledThreadExecutor::GetQueueDepth() const
+{
+    std::lock_guard<std::mutex> locker(m_queueLock);
+    return m_tasks.size();
+}
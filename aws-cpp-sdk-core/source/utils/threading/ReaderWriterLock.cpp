@@ -4,61 +4,156 @@
  */
 
 #include <aws/core/utils/threading/ReaderWriterLock.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <cstdint>
-#include <limits>
+#include <functional>
+#include <new>
+#include <thread>
 #include <cassert>
 
 using namespace Aws::Utils::Threading;
 
-static const int64_t MaxReaders = (std::numeric_limits<std::int32_t>::max)();
+static const char READER_WRITER_LOCK_TAG[] = "ReaderWriterLock";
+static const size_t CACHE_LINE_SIZE = 64;
+static const size_t MAX_READER_SLOTS = 64;
+
+struct ReaderWriterLock::ReaderSlot
+{
+    std::atomic<int64_t> readers;
+    char padding[CACHE_LINE_SIZE - sizeof(std::atomic<int64_t>)];
+};
+
+// One slot per hardware thread (rounded up to a power of two), capped to bound the size of each lock.
+static size_t ReaderSlotCount()
+{
+    static const size_t slotCount = []()
+    {
+        const size_t hardwareThreads = std::thread::hardware_concurrency();
+        size_t count = 1;
+        while (count < hardwareThreads && count < MAX_READER_SLOTS)
+        {
+            count <<= 1;
+        }
+        return count;
+    }();
+    return slotCount;
+}
 
 ReaderWriterLock::ReaderWriterLock() :
     m_readers(0),
-    m_holdouts(0),
-    m_readerSem(0, static_cast<size_t>(MaxReaders)),
-    m_writerSem(0, 1)
+    m_readerSlots(nullptr),
+    m_readerSlotsMemory(nullptr),
+    m_writerActive(false)
 {
 }
 
-void ReaderWriterLock::LockReader()
+ReaderWriterLock::~ReaderWriterLock()
+{
+    assert(CountReaders() == 0);
+    Aws::Free(m_readerSlotsMemory);
+}
+
+// Most locks are never read by two threads at once, they only get slots (up to 4KB) once that happens.
+void ReaderWriterLock::AllocateReaderSlots()
 {
-    if (++m_readers < 0)
+    const size_t slotCount = ReaderSlotCount();
+    if (slotCount == 1 || m_readerSlots.load())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> locker(m_waitMutex);
+    if (m_readerSlots.load())
     {
-        m_readerSem.WaitOne();
+        return;
     }
+    m_readerSlotsMemory = Aws::Malloc(READER_WRITER_LOCK_TAG, slotCount * sizeof(ReaderSlot) + CACHE_LINE_SIZE);
+    const uintptr_t aligned = (reinterpret_cast<uintptr_t>(m_readerSlotsMemory) + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+    ReaderSlot* slots = reinterpret_cast<ReaderSlot*>(aligned);
+    for (size_t i = 0; i < slotCount; ++i)
+    {
+        new (&slots[i].readers) std::atomic<int64_t>(0);
+    }
+    m_readerSlots.store(slots);
 }
 
-void ReaderWriterLock::UnlockReader()
+// A reader may unlock on another counter than it locked on (slots allocated in between), only the sum of the counters
+// has to be the number of readers.
+std::atomic<int64_t>& ReaderWriterLock::CurrentThreadReaders()
 {
-    if (--m_readers < 0 && --m_holdouts == 0)
+    ReaderSlot* slots = m_readerSlots.load();
+    if (!slots)
     {
-        m_writerSem.Release();
+        return m_readers;
     }
+    // Thread ids are often aligned addresses, mix the bits before picking a slot.
+    const uint64_t hash = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) * 0x9E3779B97F4A7C15ULL;
+    return slots[(hash >> 32) & (ReaderSlotCount() - 1)].readers;
 }
 
-void ReaderWriterLock::LockWriter()
+int64_t ReaderWriterLock::CountReaders() const
 {
-    m_writerLock.lock();
-    if(const auto current = m_readers.fetch_sub(MaxReaders))
+    int64_t readers = m_readers.load();
+    const ReaderSlot* slots = m_readerSlots.load();
+    if (slots)
     {
-        assert(current > 0);
-        const auto holdouts = m_holdouts.fetch_add(current) + current;
-        assert(holdouts >= 0);
-        if(holdouts > 0)
+        for (size_t i = 0; i < ReaderSlotCount(); ++i)
         {
-            m_writerSem.WaitOne();
+            readers += slots[i].readers.load();
         }
     }
+    return readers;
+}
+
+// The reader increments its slot before checking for a writer and the writer flags itself before summing the slots
+// (both sequentially consistent), so either the reader sees the writer and backs out or the writer counts the reader.
+void ReaderWriterLock::LockReader()
+{
+    for (;;)
+    {
+        std::atomic<int64_t>& readers = CurrentThreadReaders();
+        const int64_t otherReaders = readers.fetch_add(1);
+        if (!m_writerActive.load())
+        {
+            if (otherReaders > 0 && &readers == &m_readers)
+            {
+                AllocateReaderSlots();
+            }
+            return;
+        }
+
+        readers.fetch_sub(1);
+        std::unique_lock<std::mutex> locker(m_waitMutex);
+        m_readersDone.notify_one();
+        m_writerDone.wait(locker, [this]() { return !m_writerActive.load(); });
+    }
+}
+
+void ReaderWriterLock::UnlockReader()
+{
+    CurrentThreadReaders().fetch_sub(1);
+    if (m_writerActive.load())
+    {
+        std::lock_guard<std::mutex> locker(m_waitMutex);
+        m_readersDone.notify_one();
+    }
+}
+
+void ReaderWriterLock::LockWriter()
+{
+    m_writerLock.lock();
+    m_writerActive.store(true);
+    std::unique_lock<std::mutex> locker(m_waitMutex);
+    m_readersDone.wait(locker, [this]() { return CountReaders() == 0; });
 }
 
 void ReaderWriterLock::UnlockWriter()
 {
-    assert(m_holdouts == 0);
-    const auto current = m_readers.fetch_add(MaxReaders) + MaxReaders;
-    assert(current >= 0);
-    for(int64_t r = 0; r < current; r++)
+    assert(m_writerActive.load());
     {
-        m_readerSem.Release();
+        std::lock_guard<std::mutex> locker(m_waitMutex);
+        m_writerActive.store(false);
     }
+    m_writerDone.notify_all();
     m_writerLock.unlock();
 }
@@ -5,6 +5,7 @@
 
 #include <aws/core/utils/threading/ThreadTask.h>
 #include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/Probes.h>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Threading;
@@ -28,6 +29,7 @@ void ThreadTask::MainTaskRunner()
             auto fn = m_executor.PopTask();
             if(fn)
             {
+                AWS_SDK_PROBE2(executor__start, &m_executor, fn);
                 (*fn)();
                 Aws::Delete(fn);               
             }
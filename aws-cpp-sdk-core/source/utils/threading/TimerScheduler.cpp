@@ -0,0 +1,193 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/threading/TimerScheduler.h>
+#include <algorithm>
+
+using namespace Aws::Utils::Threading;
+
+TimerScheduler::TimerScheduler(std::chrono::milliseconds tickDuration, size_t wheelSize) :
+    m_start(std::chrono::steady_clock::now()),
+    m_tickDuration((std::max)(tickDuration, std::chrono::milliseconds(1))),
+    m_wheelMask(0),
+    m_currentTick(0),
+    m_nextId(1),
+    m_shutdown(false)
+{
+    size_t slots = 1;
+    while (slots < wheelSize)
+    {
+        slots <<= 1;
+    }
+    m_wheel.resize(slots);
+    m_wheelMask = slots - 1;
+}
+
+TimerScheduler::~TimerScheduler()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_shutdown = true;
+    }
+    m_signal.notify_one();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    // Callbacks may schedule timers again, those are cancelled in turn.
+    Aws::Vector<std::function<void()>> cancelled;
+    std::unique_lock<std::mutex> locker(m_lock);
+    while (!m_timers.empty())
+    {
+        for (auto& slot : m_wheel)
+        {
+            for (auto& timer : slot)
+            {
+                if (timer.onCancel)
+                {
+                    cancelled.push_back(std::move(timer.onCancel));
+                }
+            }
+            slot.clear();
+        }
+        m_timers.clear();
+
+        locker.unlock();
+        for (auto& onCancel : cancelled)
+        {
+            onCancel();
+        }
+        cancelled.clear();
+        locker.lock();
+    }
+}
+
+uint64_t TimerScheduler::TickOf(std::chrono::steady_clock::time_point timePoint) const
+{
+    return static_cast<uint64_t>((timePoint - m_start) / m_tickDuration);
+}
+
+TimerScheduler::TimerId TimerScheduler::Schedule(std::chrono::milliseconds delay, std::function<void()>&& task)
+{
+    return Schedule(delay, std::move(task), nullptr);
+}
+
+TimerScheduler::TimerId TimerScheduler::Schedule(std::chrono::milliseconds delay, std::function<void()>&& task, std::function<void()>&& onCancel)
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> locker(m_lock);
+
+    if (!m_thread.joinable() && !m_shutdown)
+    {
+        m_thread = std::thread(&TimerScheduler::Run, this);
+    }
+    if (m_timers.empty())
+    {
+        // Nothing is pending, so there is nothing to catch up on from the ticks the wheel skipped while idle.
+        m_currentTick = (std::max)(m_currentTick, TickOf(now));
+    }
+
+    // Rounded up, a timer never fires before its delay has elapsed.
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_start) + (std::max)(delay, std::chrono::milliseconds(0));
+    uint64_t expiryTick = static_cast<uint64_t>((elapsed + m_tickDuration - std::chrono::nanoseconds(1)) / m_tickDuration);
+    expiryTick = (std::max)(expiryTick, m_currentTick);
+
+    const TimerId id = m_nextId++;
+    Slot& slot = m_wheel[static_cast<size_t>(expiryTick) & m_wheelMask];
+    slot.push_back(Timer{id, expiryTick, std::move(task), std::move(onCancel)});
+    m_timers.emplace(id, std::prev(slot.end()));
+    const bool wasIdle = m_timers.size() == 1;
+    locker.unlock();
+
+    if (wasIdle)
+    {
+        m_signal.notify_one();
+    }
+    return id;
+}
+
+bool TimerScheduler::Cancel(TimerId id)
+{
+    std::function<void()> onCancel;
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        auto it = m_timers.find(id);
+        if (it == m_timers.end())
+        {
+            return false;
+        }
+
+        onCancel = std::move(it->second->onCancel);
+        m_wheel[static_cast<size_t>(it->second->expiryTick) & m_wheelMask].erase(it->second);
+        m_timers.erase(it);
+    }
+
+    if (onCancel)
+    {
+        onCancel();
+    }
+    return true;
+}
+
+size_t TimerScheduler::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    return m_timers.size();
+}
+
+void TimerScheduler::Run()
+{
+    Aws::Vector<std::function<void()>> due;
+    std::unique_lock<std::mutex> locker(m_lock);
+    while (!m_shutdown)
+    {
+        if (m_timers.empty())
+        {
+            m_signal.wait(locker, [this] { return m_shutdown || !m_timers.empty(); });
+            continue;
+        }
+
+        const uint64_t nowTick = TickOf(std::chrono::steady_clock::now());
+        if (m_currentTick > nowTick)
+        {
+            m_signal.wait_until(locker, m_start + m_tickDuration * static_cast<long long>(m_currentTick));
+            continue;
+        }
+
+        // A late thread catches up on several ticks at once, visiting every slot at most once.
+        const uint64_t lastSlotTick = (std::min)(nowTick, m_currentTick + m_wheelMask);
+        for (uint64_t tick = m_currentTick; tick <= lastSlotTick; ++tick)
+        {
+            Slot& slot = m_wheel[static_cast<size_t>(tick) & m_wheelMask];
+            for (auto timer = slot.begin(); timer != slot.end();)
+            {
+                if (timer->expiryTick <= nowTick)
+                {
+                    due.push_back(std::move(timer->task));
+                    m_timers.erase(timer->id);
+                    timer = slot.erase(timer);
+                }
+                else
+                {
+                    ++timer;
+                }
+            }
+        }
+        m_currentTick = nowTick + 1;
+
+        if (!due.empty())
+        {
+            locker.unlock();
+            for (auto& task : due)
+            {
+                task();
+            }
+            due.clear();
+            locker.lock();
+        }
+    }
+}
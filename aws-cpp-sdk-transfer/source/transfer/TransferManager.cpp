@@ -361,6 +361,7 @@ namespace Aws
                     Aws::S3::Model::UploadPartRequest uploadPartRequest = m_transferConfig.uploadPartTemplate;
                     uploadPartRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
                     uploadPartRequest.SetContinueRequestHandler([handle](const Aws::Http::HttpRequest*) { return handle->ShouldContinue(); });
+                    uploadPartRequest.SetRequestPriority(Aws::Utils::AcquirePriority::LOW);
                     uploadPartRequest.SetDataSentEventHandler([self, handle, partPtr](const Aws::Http::HttpRequest*, long long amount){ partPtr->OnDataTransferred(amount, handle); self->TriggerUploadProgressCallback(handle); });
                     uploadPartRequest.SetRequestRetryHandler([partPtr](const AmazonWebServiceRequest&){ partPtr->Reset(); });
                     uploadPartRequest.WithBucket(handle->GetBucketName())
@@ -434,6 +435,7 @@ namespace Aws
             auto putObjectRequest = m_transferConfig.putObjectTemplate;
             putObjectRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
             putObjectRequest.SetContinueRequestHandler([handle](const Aws::Http::HttpRequest*) { return handle->ShouldContinue(); });
+            putObjectRequest.SetRequestPriority(Aws::Utils::AcquirePriority::LOW);
             putObjectRequest.WithBucket(handle->GetBucketName())
                 .WithKey(handle->GetKey())
                 .WithContentLength(static_cast<long long>(handle->GetBytesTotalSize()))
@@ -666,6 +668,7 @@ namespace Aws
             Aws::S3::Model::GetObjectRequest request;
             request.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
             request.SetContinueRequestHandler([handle](const Aws::Http::HttpRequest*) { return handle->ShouldContinue(); });
+            request.SetRequestPriority(Aws::Utils::AcquirePriority::LOW);
             request.SetRange(
                 FormatRangeSpecifier(
                     handle->GetBytesOffset(), 
@@ -836,6 +839,7 @@ namespace Aws
                     Aws::S3::Model::GetObjectRequest getObjectRangeRequest;
                     getObjectRangeRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
                     getObjectRangeRequest.SetContinueRequestHandler([handle](const Aws::Http::HttpRequest*) { return handle->ShouldContinue(); });
+                    getObjectRangeRequest.SetRequestPriority(Aws::Utils::AcquirePriority::LOW);
                     getObjectRangeRequest.SetBucket(handle->GetBucketName());
                     getObjectRangeRequest.WithKey(handle->GetKey());
                     getObjectRangeRequest.SetRange(FormatRangeSpecifier(rangeStart, rangeEnd));
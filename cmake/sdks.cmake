@@ -234,6 +234,10 @@ function(add_sdks)
         endif()
     endif()
 
+    if(ENABLE_BENCHMARKS)
+        add_subdirectory(aws-cpp-sdk-core-benchmarks)
+    endif()
+
     # the catch-all config needs to list all the targets in a dependency-sorted order
     include(dependencies)
     sort_links(EXPORTS)
@@ -164,6 +164,8 @@ public:
             Aws::MakeShared<MockAWSErrorMarshaller>("MockAWSClientWithStandardRetryStrategy")),
         m_countedRetryStrategy(std::static_pointer_cast<CountedStandardRetryStrategy>(config.retryStrategy)) { }
 
+    ~MockAWSClientWithStandardRetryStrategy() { ShutdownAsyncRetries(); }
+
     Aws::Client::HttpResponseOutcome MakeRequest(const Aws::AmazonWebServiceRequest& request)
     {
         m_countedRetryStrategy->ResetAttemptedRetriesCount();
@@ -173,6 +175,25 @@ public:
         return httpOutcome;
     }
 
+    Aws::Client::HttpResponseOutcome MakeRequest(const char* requestName,
+        std::chrono::steady_clock::time_point callDeadline = (std::chrono::steady_clock::time_point::max)())
+    {
+        m_countedRetryStrategy->ResetAttemptedRetriesCount();
+        const Aws::Http::URI uri("domain.com/something");
+        const auto method = Aws::Http::HttpMethod::HTTP_GET;
+        Aws::Client::HttpResponseOutcome httpOutcome(Aws::Client::AWSClient::AttemptExhaustively(uri, method, Aws::Auth::SIGV4_SIGNER, requestName,
+            nullptr, callDeadline));
+        return httpOutcome;
+    }
+
+    void MakeRequestAsync(const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request, const Aws::Client::HttpResponseOutcomeHandler& handler)
+    {
+        m_countedRetryStrategy->ResetAttemptedRetriesCount();
+        const Aws::Http::URI uri("domain.com/something");
+        const auto method = Aws::Http::HttpMethod::HTTP_GET;
+        Aws::Client::AWSClient::AttemptExhaustivelyAsync(uri, request, method, Aws::Auth::SIGV4_SIGNER, nullptr, handler);
+    }
+
     inline static const char* GetMockAccessKey() { return "AKIDEXAMPLE"; }
     inline static const char* GetMockSecretAccessKey() { return "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"; }
 